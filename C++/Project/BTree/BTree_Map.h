@@ -0,0 +1,927 @@
+#pragma once
+
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+
+//判断是否支持"SSE2"指令集
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BTREE_SSE2 1
+#else
+#define BTREE_SSE2 0
+#endif
+
+namespace Aoki
+{
+	/**
+	 * @brief BTree_Search Class
+	 * @details 节点内查找，keys 为升序数组。通用版本使用二分查找。
+	 */
+	template<typename Key, typename Compare>
+	struct BTree_Search
+	{
+		//第一个不小于 key 的位置
+		static std::size_t Lower_Bound(const Key* keys, std::size_t count, const Key& key, const Compare& compare)
+		{
+			return static_cast<std::size_t>(std::lower_bound(keys, keys + count, key, compare) - keys);
+		}
+
+		//第一个大于 key 的位置
+		static std::size_t Upper_Bound(const Key* keys, std::size_t count, const Key& key, const Compare& compare)
+		{
+			return static_cast<std::size_t>(std::upper_bound(keys, keys + count, key, compare) - keys);
+		}
+	};
+
+#if BTREE_SSE2
+	/**
+	 * @brief BTree_Search Class
+	 * @details int 键的节点内查找：一个节点只有几十个键，用 SSE2 一次比较 4 个键并统计小于(或不大于) key 的个数，
+	 *          没有难以预测的分支，比二分查找更快。
+	 */
+	template<>
+	struct BTree_Search<int, std::less<int>>
+	{
+		static std::size_t Count_Mask(int mask)
+		{
+			static const unsigned char bits[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+			return bits[mask];
+		}
+
+		static std::size_t Lower_Bound(const int* keys, std::size_t count, int key, const std::less<int>&)
+		{
+			const __m128i target = _mm_set1_epi32(key);
+			std::size_t result = 0, i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+				result += Count_Mask(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(block, target))));
+			}
+			for (; i < count; ++i)
+			{
+				result += keys[i] < key;
+			}
+			return result;
+		}
+
+		static std::size_t Upper_Bound(const int* keys, std::size_t count, int key, const std::less<int>&)
+		{
+			const __m128i target = _mm_set1_epi32(key);
+			std::size_t result = 0, i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+				result += 4 - Count_Mask(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(block, target))));
+			}
+			for (; i < count; ++i)
+			{
+				result += keys[i] <= key;
+			}
+			return result;
+		}
+	};
+#endif
+
+	/**
+	 * @brief BTree_Map Class
+	 * @tparam Key: 键类型(需要可默认构造与赋值)。
+	 * @tparam T: 值类型(需要可默认构造与赋值)。
+	 * @tparam Compare: 键的比较器。
+	 * @tparam NodeBytes: 每个节点中键与值(或孩子指针)所占的字节数，用于决定扇出。
+	 * @details 内存中的 B+ 树，键唯一。
+	 *          1. 所有数据保存在叶子节点中，内部节点只保存分隔键，叶子节点按键的顺序组成双向链表，范围查询只需顺序扫描叶子。
+	 *          2. 节点中键与值分别连续存放，查找时只访问键数组；默认每个节点约 512 字节(8 个缓存行)，树高很低。
+	 *          3. 分隔键 keys_[i] 不大于 children_[i + 1] 中的所有键，且大于 children_[i] 中的所有键。
+	 *          4. 除根节点外，每个节点至少半满；插入时节点满则分裂，删除后不足半满则向兄弟借或与兄弟合并。
+	 *          5. 支持从有序序列批量构建，自底向上直接填满各层节点，时间复杂度为 O(N)。
+	 * @note 迭代器解引用得到 std::pair<const Key&, T&> (键与值不相邻存放)，插入与删除后所有迭代器失效。
+	 */
+	template<typename Key, typename T, typename Compare = std::less<Key>, std::size_t NodeBytes = 512>
+	class BTree_Map
+	{
+		typedef BTree_Map<Key, T, Compare, NodeBytes> this_type;
+
+	public:
+		//配套类型
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef Compare key_compare;
+		typedef std::size_t size_type;
+
+		//节点容量
+		static constexpr size_type LEAF_CAPACITY =
+				NodeBytes / (sizeof(Key) + sizeof(T)) < 4 ? 4 : NodeBytes / (sizeof(Key) + sizeof(T));
+		static constexpr size_type INNER_CAPACITY =
+				NodeBytes / (sizeof(Key) + sizeof(void*)) < 4 ? 4 : NodeBytes / (sizeof(Key) + sizeof(void*));
+
+	private:
+		//节点
+		struct Node
+		{
+			bool isLeaf_;
+			size_type count_;
+		};
+
+		struct Leaf : public Node
+		{
+			Key keys_[LEAF_CAPACITY];
+			T values_[LEAF_CAPACITY];
+			Leaf* pPrev_;
+			Leaf* pNext_;
+		};
+
+		struct Inner : public Node
+		{
+			Key keys_[INNER_CAPACITY];
+			Node* children_[INNER_CAPACITY + 1];
+		};
+
+		typedef BTree_Search<Key, Compare> search_type;
+
+	public:
+		/**
+		 * @brief iterator Class
+		 * @details 前向迭代器，按键的升序沿叶子链表移动。
+		 */
+		class iterator
+		{
+			friend class BTree_Map;
+
+		public:
+			iterator() : pLeaf_(nullptr), index_(0)
+			{
+			}
+
+			std::pair<const Key&, T&> operator*() const
+			{
+				return std::pair<const Key&, T&>(pLeaf_->keys_[index_], pLeaf_->values_[index_]);
+			}
+
+			const key_type& key() const
+			{
+				return pLeaf_->keys_[index_];
+			}
+
+			mapped_type& value() const
+			{
+				return pLeaf_->values_[index_];
+			}
+
+			iterator& operator++()
+			{
+				if (++index_ == pLeaf_->count_)
+				{
+					pLeaf_ = pLeaf_->pNext_;
+					index_ = 0;
+				}
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator temp = *this;
+				++*this;
+				return temp;
+			}
+
+			bool operator==(const iterator& x) const
+			{
+				return pLeaf_ == x.pLeaf_ && index_ == x.index_;
+			}
+
+			bool operator!=(const iterator& x) const
+			{
+				return !(*this == x);
+			}
+
+		private:
+			iterator(Leaf* pLeaf, size_type index) : pLeaf_(pLeaf), index_(index)
+			{
+				//位于叶子末尾时移动到下一个叶子的开头
+				if (pLeaf_ != nullptr && index_ == pLeaf_->count_)
+				{
+					pLeaf_ = pLeaf_->pNext_;
+					index_ = 0;
+				}
+			}
+
+			Leaf* pLeaf_;
+			size_type index_;
+		};
+
+	public:
+		//构造函数和析构函数
+		explicit BTree_Map(const key_compare& compare = key_compare());
+
+		BTree_Map(const this_type& other);
+
+		~BTree_Map();
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other);
+
+		//元素访问
+		mapped_type& operator[](const key_type& key);
+
+		mapped_type& at(const key_type& key);
+
+		//迭代器
+		iterator begin() const;
+
+		iterator end() const;
+
+		//容量
+		bool empty() const;
+
+		size_type size() const;
+
+		size_type height() const;
+
+		//修改器
+		void clear();
+
+		std::pair<iterator, bool> insert(const key_type& key, const mapped_type& value);
+
+		size_type erase(const key_type& key);
+
+		//从按键严格升序排列的序列批量构建(覆盖原有数据)，元素需有 first 与 second 成员
+		template<typename InputIterator>
+		void bulk_load(InputIterator first, InputIterator last);
+
+		void swap(this_type& other);
+
+		//查找
+		iterator find(const key_type& key) const;
+
+		size_type count(const key_type& key) const;
+
+		iterator lower_bound(const key_type& key) const;
+
+		iterator upper_bound(const key_type& key) const;
+
+		//检查 B+ 树的性质
+		bool verify() const;
+
+	private:
+		//帮手函数
+		Leaf* DoCreateLeaf();
+
+		Inner* DoCreateInner();
+
+		void DoDestroy(Node* pNode);
+
+		Leaf* DoFindLeaf(const key_type& key) const;
+
+		bool DoInsert(Node* pNode, const key_type& key, const mapped_type& value, iterator& result, key_type& split, Node*& pSplit);
+
+		bool DoErase(Node* pNode, const key_type& key);
+
+		void DoFixChild(Inner* pParent, size_type index);
+
+		static void DoRemoveFromInner(Inner* pInner, size_type keyIndex, size_type childIndex);
+
+		bool DoVerify(const Node* pNode, size_type depth, const key_type* pLow, const key_type* pHigh, size_type& leafDepth, size_type& count) const;
+
+	private:
+		//成员变量
+		Node* pRoot_;
+		Leaf* pFirst_;
+		size_type size_;
+		size_type height_;
+		key_compare compare_;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	// BTree_Map Class 实现
+	///////////////////////////////////////////////////////////////////////
+
+	//构造函数和析构函数
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	BTree_Map<Key, T, Compare, NodeBytes>::BTree_Map(const key_compare& compare)
+			: pRoot_(nullptr), pFirst_(nullptr), size_(0), height_(0), compare_(compare)
+	{
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	BTree_Map<Key, T, Compare, NodeBytes>::BTree_Map(const this_type& other)
+			: pRoot_(nullptr), pFirst_(nullptr), size_(0), height_(0), compare_(other.compare_)
+	{
+		bulk_load(other.begin(), other.end());
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	BTree_Map<Key, T, Compare, NodeBytes>::~BTree_Map()
+	{
+		clear();
+	}
+
+	//重载赋值运算符
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::this_type& BTree_Map<Key, T, Compare, NodeBytes>::operator=(const this_type& other)
+	{
+		if (this != &other)
+		{
+			compare_ = other.compare_;
+			bulk_load(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	//元素访问
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::mapped_type& BTree_Map<Key, T, Compare, NodeBytes>::operator[](const key_type& key)
+	{
+		return insert(key, mapped_type()).first.value();
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::mapped_type& BTree_Map<Key, T, Compare, NodeBytes>::at(const key_type& key)
+	{
+		iterator it = find(key);
+		if (it == end())
+		{
+			throw std::out_of_range("BTree_Map::at");
+		}
+		return it.value();
+	}
+
+	//迭代器
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::iterator BTree_Map<Key, T, Compare, NodeBytes>::begin() const
+	{
+		return iterator(size_ == 0 ? nullptr : pFirst_, 0);
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::iterator BTree_Map<Key, T, Compare, NodeBytes>::end() const
+	{
+		return iterator();
+	}
+
+	//容量
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	bool BTree_Map<Key, T, Compare, NodeBytes>::empty() const
+	{
+		return size_ == 0;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::size_type BTree_Map<Key, T, Compare, NodeBytes>::size() const
+	{
+		return size_;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::size_type BTree_Map<Key, T, Compare, NodeBytes>::height() const
+	{
+		return height_;
+	}
+
+	//修改器
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	void BTree_Map<Key, T, Compare, NodeBytes>::clear()
+	{
+		DoDestroy(pRoot_);
+		pRoot_ = nullptr;
+		pFirst_ = nullptr;
+		size_ = height_ = 0;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	std::pair<typename BTree_Map<Key, T, Compare, NodeBytes>::iterator, bool>
+	BTree_Map<Key, T, Compare, NodeBytes>::insert(const key_type& key, const mapped_type& value)
+	{
+		if (pRoot_ == nullptr)
+		{
+			pFirst_ = DoCreateLeaf();
+			pRoot_ = pFirst_;
+			height_ = 1;
+		}
+		iterator result;
+		key_type split = key_type();
+		Node* pSplit = nullptr;
+		bool inserted = DoInsert(pRoot_, key, value, result, split, pSplit);
+		if (pSplit != nullptr)
+		{
+			//根节点分裂，树高加一
+			Inner* pRoot = DoCreateInner();
+			pRoot->count_ = 1;
+			pRoot->keys_[0] = split;
+			pRoot->children_[0] = pRoot_;
+			pRoot->children_[1] = pSplit;
+			pRoot_ = pRoot;
+			++height_;
+		}
+		size_ += inserted ? 1 : 0;
+		return std::pair<iterator, bool>(result, inserted);
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::size_type BTree_Map<Key, T, Compare, NodeBytes>::erase(const key_type& key)
+	{
+		if (pRoot_ == nullptr || !DoErase(pRoot_, key))
+		{
+			return 0;
+		}
+		--size_;
+		//根节点只剩一个孩子时，树高减一
+		if (!pRoot_->isLeaf_ && pRoot_->count_ == 0)
+		{
+			Inner* pOld = static_cast<Inner*>(pRoot_);
+			pRoot_ = pOld->children_[0];
+			delete pOld;
+			--height_;
+		}
+		return 1;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	template<typename InputIterator>
+	void BTree_Map<Key, T, Compare, NodeBytes>::bulk_load(InputIterator first, InputIterator last)
+	{
+		clear();
+		//1. 依次填满叶子节点
+		std::vector<Node*> level;
+		std::vector<key_type> lows;
+		Leaf* pLeaf = nullptr;
+		for (; first != last; ++first)
+		{
+			if (pLeaf == nullptr || pLeaf->count_ == LEAF_CAPACITY)
+			{
+				Leaf* pNew = DoCreateLeaf();
+				pNew->pPrev_ = pLeaf;
+				if (pLeaf != nullptr)
+				{
+					pLeaf->pNext_ = pNew;
+				}
+				pLeaf = pNew;
+				level.push_back(pLeaf);
+				lows.push_back((*first).first);
+			}
+			assert(size_ == 0 || pLeaf->count_ == 0 || compare_(pLeaf->keys_[pLeaf->count_ - 1], (*first).first));
+			pLeaf->keys_[pLeaf->count_] = (*first).first;
+			pLeaf->values_[pLeaf->count_] = (*first).second;
+			++pLeaf->count_;
+			++size_;
+		}
+		if (level.empty())
+		{
+			return;
+		}
+		pFirst_ = static_cast<Leaf*>(level.front());
+		//最后一个叶子不足半满时与前一个叶子平分
+		if (level.size() > 1 && pLeaf->count_ < LEAF_CAPACITY / 2)
+		{
+			Leaf* pPrev = pLeaf->pPrev_;
+			size_type move = (pPrev->count_ + pLeaf->count_) / 2 - pLeaf->count_;
+			std::move_backward(pLeaf->keys_, pLeaf->keys_ + pLeaf->count_, pLeaf->keys_ + pLeaf->count_ + move);
+			std::move_backward(pLeaf->values_, pLeaf->values_ + pLeaf->count_, pLeaf->values_ + pLeaf->count_ + move);
+			std::move(pPrev->keys_ + pPrev->count_ - move, pPrev->keys_ + pPrev->count_, pLeaf->keys_);
+			std::move(pPrev->values_ + pPrev->count_ - move, pPrev->values_ + pPrev->count_, pLeaf->values_);
+			pPrev->count_ -= move;
+			pLeaf->count_ += move;
+			lows.back() = pLeaf->keys_[0];
+		}
+		height_ = 1;
+		//2. 自底向上逐层构建内部节点，每个内部节点至多 INNER_CAPACITY + 1 个孩子
+		while (level.size() > 1)
+		{
+			const size_type fanout = INNER_CAPACITY + 1;
+			size_type groups = (level.size() + fanout - 1) / fanout;
+			std::vector<size_type> bounds(groups + 1);
+			for (size_type g = 0; g < groups; ++g)
+			{
+				bounds[g] = g * fanout;
+			}
+			bounds[groups] = level.size();
+			//最后一组孩子过少时与前一组平分
+			if (groups > 1 && bounds[groups] - bounds[groups - 1] < INNER_CAPACITY / 2 + 1)
+			{
+				bounds[groups - 1] = bounds[groups - 2] + (bounds[groups] - bounds[groups - 2]) / 2;
+			}
+			std::vector<Node*> parents;
+			std::vector<key_type> parentLows;
+			for (size_type g = 0; g < groups; ++g)
+			{
+				Inner* pInner = DoCreateInner();
+				pInner->children_[0] = level[bounds[g]];
+				for (size_type i = bounds[g] + 1; i < bounds[g + 1]; ++i)
+				{
+					pInner->keys_[pInner->count_] = lows[i];
+					pInner->children_[++pInner->count_] = level[i];
+				}
+				parents.push_back(pInner);
+				parentLows.push_back(lows[bounds[g]]);
+			}
+			level.swap(parents);
+			lows.swap(parentLows);
+			++height_;
+		}
+		pRoot_ = level.front();
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	void BTree_Map<Key, T, Compare, NodeBytes>::swap(this_type& other)
+	{
+		std::swap(pRoot_, other.pRoot_);
+		std::swap(pFirst_, other.pFirst_);
+		std::swap(size_, other.size_);
+		std::swap(height_, other.height_);
+		std::swap(compare_, other.compare_);
+	}
+
+	//查找
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::iterator BTree_Map<Key, T, Compare, NodeBytes>::find(const key_type& key) const
+	{
+		Leaf* pLeaf = DoFindLeaf(key);
+		if (pLeaf == nullptr)
+		{
+			return end();
+		}
+		size_type pos = search_type::Lower_Bound(pLeaf->keys_, pLeaf->count_, key, compare_);
+		if (pos == pLeaf->count_ || compare_(key, pLeaf->keys_[pos]))
+		{
+			return end();
+		}
+		return iterator(pLeaf, pos);
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::size_type BTree_Map<Key, T, Compare, NodeBytes>::count(const key_type& key) const
+	{
+		return find(key) == end() ? 0 : 1;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::iterator BTree_Map<Key, T, Compare, NodeBytes>::lower_bound(const key_type& key) const
+	{
+		Leaf* pLeaf = DoFindLeaf(key);
+		if (pLeaf == nullptr)
+		{
+			return end();
+		}
+		return iterator(pLeaf, search_type::Lower_Bound(pLeaf->keys_, pLeaf->count_, key, compare_));
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::iterator BTree_Map<Key, T, Compare, NodeBytes>::upper_bound(const key_type& key) const
+	{
+		Leaf* pLeaf = DoFindLeaf(key);
+		if (pLeaf == nullptr)
+		{
+			return end();
+		}
+		return iterator(pLeaf, search_type::Upper_Bound(pLeaf->keys_, pLeaf->count_, key, compare_));
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	bool BTree_Map<Key, T, Compare, NodeBytes>::verify() const
+	{
+		if (pRoot_ == nullptr)
+		{
+			return size_ == 0 && height_ == 0;
+		}
+		size_type leafDepth = 0, count = 0;
+		if (!DoVerify(pRoot_, 1, nullptr, nullptr, leafDepth, count) || count != size_ || leafDepth != height_)
+		{
+			return false;
+		}
+		//叶子链表按顺序覆盖全部元素
+		count = 0;
+		const Leaf* pPrev = nullptr;
+		for (const Leaf* pLeaf = pFirst_; pLeaf != nullptr; pPrev = pLeaf, pLeaf = pLeaf->pNext_)
+		{
+			if (pLeaf->pPrev_ != pPrev || (pPrev != nullptr && !compare_(pPrev->keys_[pPrev->count_ - 1], pLeaf->keys_[0])))
+			{
+				return false;
+			}
+			count += pLeaf->count_;
+		}
+		return count == size_;
+	}
+
+	//帮手函数
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::Leaf* BTree_Map<Key, T, Compare, NodeBytes>::DoCreateLeaf()
+	{
+		Leaf* pLeaf = new Leaf;
+		pLeaf->isLeaf_ = true;
+		pLeaf->count_ = 0;
+		pLeaf->pPrev_ = pLeaf->pNext_ = nullptr;
+		return pLeaf;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::Inner* BTree_Map<Key, T, Compare, NodeBytes>::DoCreateInner()
+	{
+		Inner* pInner = new Inner;
+		pInner->isLeaf_ = false;
+		pInner->count_ = 0;
+		return pInner;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	void BTree_Map<Key, T, Compare, NodeBytes>::DoDestroy(Node* pNode)
+	{
+		if (pNode == nullptr)
+		{
+			return;
+		}
+		if (pNode->isLeaf_)
+		{
+			delete static_cast<Leaf*>(pNode);
+			return;
+		}
+		Inner* pInner = static_cast<Inner*>(pNode);
+		for (size_type i = 0; i <= pInner->count_; ++i)
+		{
+			DoDestroy(pInner->children_[i]);
+		}
+		delete pInner;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	typename BTree_Map<Key, T, Compare, NodeBytes>::Leaf* BTree_Map<Key, T, Compare, NodeBytes>::DoFindLeaf(const key_type& key) const
+	{
+		Node* pNode = pRoot_;
+		while (pNode != nullptr && !pNode->isLeaf_)
+		{
+			Inner* pInner = static_cast<Inner*>(pNode);
+			pNode = pInner->children_[search_type::Upper_Bound(pInner->keys_, pInner->count_, key, compare_)];
+		}
+		return static_cast<Leaf*>(pNode);
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	bool BTree_Map<Key, T, Compare, NodeBytes>::DoInsert(Node* pNode, const key_type& key, const mapped_type& value, iterator& result,
+			key_type& split, Node*& pSplit)
+	{
+		pSplit = nullptr;
+		if (pNode->isLeaf_)
+		{
+			Leaf* pLeaf = static_cast<Leaf*>(pNode);
+			size_type pos = search_type::Lower_Bound(pLeaf->keys_, pLeaf->count_, key, compare_);
+			if (pos < pLeaf->count_ && !compare_(key, pLeaf->keys_[pos]))
+			{
+				result = iterator(pLeaf, pos);
+				return false;
+			}
+			if (pLeaf->count_ == LEAF_CAPACITY)
+			{
+				//叶子已满：后一半移入新叶子，再插入到对应的一半中
+				Leaf* pRight = DoCreateLeaf();
+				size_type half = LEAF_CAPACITY / 2;
+				std::move(pLeaf->keys_ + half, pLeaf->keys_ + LEAF_CAPACITY, pRight->keys_);
+				std::move(pLeaf->values_ + half, pLeaf->values_ + LEAF_CAPACITY, pRight->values_);
+				pRight->count_ = LEAF_CAPACITY - half;
+				pLeaf->count_ = half;
+				pRight->pNext_ = pLeaf->pNext_;
+				pRight->pPrev_ = pLeaf;
+				if (pLeaf->pNext_ != nullptr)
+				{
+					pLeaf->pNext_->pPrev_ = pRight;
+				}
+				pLeaf->pNext_ = pRight;
+				if (pos > half)
+				{
+					pLeaf = pRight;
+					pos -= half;
+				}
+				pSplit = pRight;
+			}
+			std::move_backward(pLeaf->keys_ + pos, pLeaf->keys_ + pLeaf->count_, pLeaf->keys_ + pLeaf->count_ + 1);
+			std::move_backward(pLeaf->values_ + pos, pLeaf->values_ + pLeaf->count_, pLeaf->values_ + pLeaf->count_ + 1);
+			pLeaf->keys_[pos] = key;
+			pLeaf->values_[pos] = value;
+			++pLeaf->count_;
+			if (pSplit != nullptr)
+			{
+				split = static_cast<Leaf*>(pSplit)->keys_[0];
+			}
+			result = iterator(pLeaf, pos);
+			return true;
+		}
+		Inner* pInner = static_cast<Inner*>(pNode);
+		size_type index = search_type::Upper_Bound(pInner->keys_, pInner->count_, key, compare_);
+		key_type childSplit = key_type();
+		Node* pChildSplit = nullptr;
+		bool inserted = DoInsert(pInner->children_[index], key, value, result, childSplit, pChildSplit);
+		if (pChildSplit == nullptr)
+		{
+			return inserted;
+		}
+		if (pInner->count_ < INNER_CAPACITY)
+		{
+			std::move_backward(pInner->keys_ + index, pInner->keys_ + pInner->count_, pInner->keys_ + pInner->count_ + 1);
+			std::move_backward(pInner->children_ + index + 1, pInner->children_ + pInner->count_ + 1, pInner->children_ + pInner->count_ + 2);
+			pInner->keys_[index] = childSplit;
+			pInner->children_[index + 1] = pChildSplit;
+			++pInner->count_;
+			return inserted;
+		}
+		//内部节点已满：先在临时数组中插入，再把中间的键上移，两侧分别留在原节点与新节点中
+		key_type keys[INNER_CAPACITY + 1];
+		Node* children[INNER_CAPACITY + 2];
+		std::move(pInner->keys_, pInner->keys_ + index, keys);
+		keys[index] = childSplit;
+		std::move(pInner->keys_ + index, pInner->keys_ + INNER_CAPACITY, keys + index + 1);
+		std::copy(pInner->children_, pInner->children_ + index + 1, children);
+		children[index + 1] = pChildSplit;
+		std::copy(pInner->children_ + index + 1, pInner->children_ + INNER_CAPACITY + 1, children + index + 2);
+		size_type middle = (INNER_CAPACITY + 1) / 2;
+		Inner* pRight = DoCreateInner();
+		std::move(keys, keys + middle, pInner->keys_);
+		std::copy(children, children + middle + 1, pInner->children_);
+		pInner->count_ = middle;
+		std::move(keys + middle + 1, keys + INNER_CAPACITY + 1, pRight->keys_);
+		std::copy(children + middle + 1, children + INNER_CAPACITY + 2, pRight->children_);
+		pRight->count_ = INNER_CAPACITY - middle;
+		split = keys[middle];
+		pSplit = pRight;
+		return inserted;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	bool BTree_Map<Key, T, Compare, NodeBytes>::DoErase(Node* pNode, const key_type& key)
+	{
+		if (pNode->isLeaf_)
+		{
+			Leaf* pLeaf = static_cast<Leaf*>(pNode);
+			size_type pos = search_type::Lower_Bound(pLeaf->keys_, pLeaf->count_, key, compare_);
+			if (pos == pLeaf->count_ || compare_(key, pLeaf->keys_[pos]))
+			{
+				return false;
+			}
+			std::move(pLeaf->keys_ + pos + 1, pLeaf->keys_ + pLeaf->count_, pLeaf->keys_ + pos);
+			std::move(pLeaf->values_ + pos + 1, pLeaf->values_ + pLeaf->count_, pLeaf->values_ + pos);
+			--pLeaf->count_;
+			return true;
+		}
+		Inner* pInner = static_cast<Inner*>(pNode);
+		size_type index = search_type::Upper_Bound(pInner->keys_, pInner->count_, key, compare_);
+		if (!DoErase(pInner->children_[index], key))
+		{
+			return false;
+		}
+		Node* pChild = pInner->children_[index];
+		if (pChild->count_ < (pChild->isLeaf_ ? LEAF_CAPACITY / 2 : INNER_CAPACITY / 2))
+		{
+			DoFixChild(pInner, index);
+		}
+		return true;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	void BTree_Map<Key, T, Compare, NodeBytes>::DoFixChild(Inner* pParent, size_type index)
+	{
+		Node* pLeftNode = index > 0 ? pParent->children_[index - 1] : nullptr;
+		Node* pRightNode = index < pParent->count_ ? pParent->children_[index + 1] : nullptr;
+		if (pParent->children_[index]->isLeaf_)
+		{
+			const size_type minimum = LEAF_CAPACITY / 2;
+			Leaf* pChild = static_cast<Leaf*>(pParent->children_[index]);
+			Leaf* pLeft = static_cast<Leaf*>(pLeftNode);
+			Leaf* pRight = static_cast<Leaf*>(pRightNode);
+			if (pLeft != nullptr && pLeft->count_ > minimum)
+			{
+				//向左兄弟借最大的元素
+				std::move_backward(pChild->keys_, pChild->keys_ + pChild->count_, pChild->keys_ + pChild->count_ + 1);
+				std::move_backward(pChild->values_, pChild->values_ + pChild->count_, pChild->values_ + pChild->count_ + 1);
+				--pLeft->count_;
+				pChild->keys_[0] = std::move(pLeft->keys_[pLeft->count_]);
+				pChild->values_[0] = std::move(pLeft->values_[pLeft->count_]);
+				++pChild->count_;
+				pParent->keys_[index - 1] = pChild->keys_[0];
+			}
+			else if (pRight != nullptr && pRight->count_ > minimum)
+			{
+				//向右兄弟借最小的元素
+				pChild->keys_[pChild->count_] = std::move(pRight->keys_[0]);
+				pChild->values_[pChild->count_] = std::move(pRight->values_[0]);
+				++pChild->count_;
+				std::move(pRight->keys_ + 1, pRight->keys_ + pRight->count_, pRight->keys_);
+				std::move(pRight->values_ + 1, pRight->values_ + pRight->count_, pRight->values_);
+				--pRight->count_;
+				pParent->keys_[index] = pRight->keys_[0];
+			}
+			else
+			{
+				//与兄弟合并：右侧叶子并入左侧叶子
+				if (pLeft == nullptr)
+				{
+					pLeft = pChild;
+					pChild = pRight;
+					++index;
+				}
+				std::move(pChild->keys_, pChild->keys_ + pChild->count_, pLeft->keys_ + pLeft->count_);
+				std::move(pChild->values_, pChild->values_ + pChild->count_, pLeft->values_ + pLeft->count_);
+				pLeft->count_ += pChild->count_;
+				pLeft->pNext_ = pChild->pNext_;
+				if (pChild->pNext_ != nullptr)
+				{
+					pChild->pNext_->pPrev_ = pLeft;
+				}
+				delete pChild;
+				DoRemoveFromInner(pParent, index - 1, index);
+			}
+			return;
+		}
+		const size_type minimum = INNER_CAPACITY / 2;
+		Inner* pChild = static_cast<Inner*>(pParent->children_[index]);
+		Inner* pLeft = static_cast<Inner*>(pLeftNode);
+		Inner* pRight = static_cast<Inner*>(pRightNode);
+		if (pLeft != nullptr && pLeft->count_ > minimum)
+		{
+			//左兄弟的最后一个孩子移到本节点开头，分隔键经父节点轮换
+			std::move_backward(pChild->keys_, pChild->keys_ + pChild->count_, pChild->keys_ + pChild->count_ + 1);
+			std::move_backward(pChild->children_, pChild->children_ + pChild->count_ + 1, pChild->children_ + pChild->count_ + 2);
+			pChild->keys_[0] = std::move(pParent->keys_[index - 1]);
+			pChild->children_[0] = pLeft->children_[pLeft->count_];
+			pParent->keys_[index - 1] = std::move(pLeft->keys_[pLeft->count_ - 1]);
+			--pLeft->count_;
+			++pChild->count_;
+		}
+		else if (pRight != nullptr && pRight->count_ > minimum)
+		{
+			//右兄弟的第一个孩子移到本节点末尾
+			pChild->keys_[pChild->count_] = std::move(pParent->keys_[index]);
+			pChild->children_[pChild->count_ + 1] = pRight->children_[0];
+			++pChild->count_;
+			pParent->keys_[index] = std::move(pRight->keys_[0]);
+			std::move(pRight->keys_ + 1, pRight->keys_ + pRight->count_, pRight->keys_);
+			std::move(pRight->children_ + 1, pRight->children_ + pRight->count_ + 1, pRight->children_);
+			--pRight->count_;
+		}
+		else
+		{
+			//与兄弟合并：父节点中的分隔键下移到两者之间
+			if (pLeft == nullptr)
+			{
+				pLeft = pChild;
+				pChild = pRight;
+				++index;
+			}
+			pLeft->keys_[pLeft->count_] = std::move(pParent->keys_[index - 1]);
+			std::move(pChild->keys_, pChild->keys_ + pChild->count_, pLeft->keys_ + pLeft->count_ + 1);
+			std::copy(pChild->children_, pChild->children_ + pChild->count_ + 1, pLeft->children_ + pLeft->count_ + 1);
+			pLeft->count_ += pChild->count_ + 1;
+			delete pChild;
+			DoRemoveFromInner(pParent, index - 1, index);
+		}
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	void BTree_Map<Key, T, Compare, NodeBytes>::DoRemoveFromInner(Inner* pInner, size_type keyIndex, size_type childIndex)
+	{
+		std::move(pInner->keys_ + keyIndex + 1, pInner->keys_ + pInner->count_, pInner->keys_ + keyIndex);
+		std::copy(pInner->children_ + childIndex + 1, pInner->children_ + pInner->count_ + 1, pInner->children_ + childIndex);
+		--pInner->count_;
+	}
+
+	template<typename Key, typename T, typename Compare, std::size_t NodeBytes>
+	bool BTree_Map<Key, T, Compare, NodeBytes>::DoVerify(const Node* pNode, size_type depth, const key_type* pLow, const key_type* pHigh,
+			size_type& leafDepth, size_type& count) const
+	{
+		//非根节点至少半满
+		if (pNode != pRoot_ && pNode->count_ < (pNode->isLeaf_ ? LEAF_CAPACITY / 2 : INNER_CAPACITY / 2))
+		{
+			return false;
+		}
+		if (pNode->isLeaf_)
+		{
+			const Leaf* pLeaf = static_cast<const Leaf*>(pNode);
+			for (size_type i = 0; i < pLeaf->count_; ++i)
+			{
+				if ((i > 0 && !compare_(pLeaf->keys_[i - 1], pLeaf->keys_[i]))
+						|| (pLow != nullptr && compare_(pLeaf->keys_[i], *pLow))
+						|| (pHigh != nullptr && !compare_(pLeaf->keys_[i], *pHigh)))
+				{
+					return false;
+				}
+			}
+			if (leafDepth == 0)
+			{
+				leafDepth = depth;
+			}
+			count += pLeaf->count_;
+			return leafDepth == depth;
+		}
+		const Inner* pInner = static_cast<const Inner*>(pNode);
+		for (size_type i = 0; i <= pInner->count_; ++i)
+		{
+			const key_type* pChildLow = i == 0 ? pLow : pInner->keys_ + i - 1;
+			const key_type* pChildHigh = i == pInner->count_ ? pHigh : pInner->keys_ + i;
+			if (!DoVerify(pInner->children_[i], depth + 1, pChildLow, pChildHigh, leafDepth, count))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
\ No newline at end of file
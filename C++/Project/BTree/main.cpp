@@ -0,0 +1,202 @@
+#include "BTree_Map.h"
+#include "../Map/Map.h"
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <random>
+#include <vector>
+#include <iostream>
+
+using std::printf;
+
+void Test_BTree_Map_01()
+{
+	printf("******************************01******************************\n");
+
+	Aoki::BTree_Map<int, int> m;
+	assert(m.empty() && m.size() == 0 && m.begin() == m.end() && m.verify());
+
+	for (int i = 20; i > 0; --i)
+	{
+		m.insert(i * 5, i);
+	}
+	assert(!m.insert(50, 0).second && m.at(50) == 10 && m.size() == 20 && m.verify());
+
+	for (auto it = m.begin(); it != m.end(); ++it)
+	{
+		std::cout << it.key() << ":" << it.value() << " ";
+	}
+	std::cout << std::endl;
+
+	//范围查询 [23, 61)
+	for (auto it = m.lower_bound(23); it != m.end() && it.key() < 61; ++it)
+	{
+		std::cout << (*it).first << " ";
+	}
+	std::cout << std::endl;
+
+	assert(m.upper_bound(100) == m.end() && m.lower_bound(100).key() == 100 && m.upper_bound(0).key() == 5);
+	assert(m.erase(50) == 1 && m.erase(50) == 0 && m.find(50) == m.end() && m.verify());
+
+	m[7] = 70;
+	Aoki::BTree_Map<int, int> copy(m);
+	copy[7] = 700;
+	assert(m[7] == 70 && copy[7] == 700 && copy.size() == m.size() && copy.verify());
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_BTree_Map_02()
+{
+	printf("******************************02******************************\n");
+
+	//随机插入与删除，与 std::map 对照(小节点使分裂、借用与合并频繁发生)
+	std::mt19937 random(20221019);
+	Aoki::BTree_Map<int, int, std::less<int>, 64> m;
+	std::map<int, int> ref;
+	for (int round = 0; round < 300000; ++round)
+	{
+		int key = static_cast<int>(random() % 20000);
+		if (random() % 5 < 2)
+		{
+			assert(m.erase(key) == ref.erase(key));
+		}
+		else
+		{
+			m[key] = round;
+			ref[key] = round;
+		}
+		if (round % 30000 == 0)
+		{
+			assert(m.verify());
+		}
+	}
+	assert(m.size() == ref.size() && m.verify());
+	auto it = m.begin();
+	for (auto& kv: ref)
+	{
+		assert(it.key() == kv.first && it.value() == kv.second);
+		++it;
+	}
+	assert(it == m.end());
+
+	//全部删除
+	for (auto& kv: ref)
+	{
+		m.erase(kv.first);
+	}
+	assert(m.empty() && m.height() == 1 && m.verify());
+
+	printf("%s\n", m.empty() ? "Good Luck!" : "Oops!");
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_BTree_Map_03()
+{
+	printf("******************************03******************************\n");
+
+	//批量构建后继续插入与删除
+	for (size_t size: { (size_t)0, (size_t)1, (size_t)63, (size_t)64, (size_t)65, (size_t)1000, (size_t)123457 })
+	{
+		std::vector<std::pair<long long, int>> data;
+		for (size_t i = 0; i < size; ++i)
+		{
+			data.emplace_back(static_cast<long long>(i) * 3, static_cast<int>(i));
+		}
+		Aoki::BTree_Map<long long, int> m;
+		m.bulk_load(data.begin(), data.end());
+		assert(m.size() == size && m.verify());
+		for (size_t i = 0; i < size; i += 7)
+		{
+			assert(m.at(static_cast<long long>(i) * 3) == static_cast<int>(i));
+			m.insert(static_cast<long long>(i) * 3 + 1, -1);
+			m.erase(static_cast<long long>(i) * 3);
+		}
+		assert(m.verify());
+		printf("size = %-8zu height = %zu\n", size, m.height());
+	}
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+//获取自 begin 起经过的时间(单位：毫秒)
+double Elapsed_Bench(std::chrono::steady_clock::time_point begin)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+//点查询与范围查询("span"个连续键求和)
+template<typename MapType>
+void Query_Bench(const char* name, const MapType& m, const std::vector<int>& probes, int span, double build)
+{
+	auto begin = std::chrono::steady_clock::now();
+	long long sum = 0;
+	for (int key: probes)
+	{
+		sum += m.find(key) != m.end() ? 1 : 0;
+	}
+	double point = Elapsed_Bench(begin);
+
+	begin = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < probes.size() / 100; ++i)
+	{
+		auto it = m.lower_bound(probes[i]);
+		for (int n = 0; n < span && it != m.end(); ++n, ++it)
+		{
+			sum += (*it).second;
+		}
+	}
+	double range = Elapsed_Bench(begin);
+
+	printf("%-20s%-12.1lf%-12.1lf%-12.1lf%lld\n", name, build, point, range, sum);
+}
+
+void Test_BTree_Map_04()
+{
+	printf("******************************04******************************\n");
+
+	//有序输入构建后进行随机点查询(1M 次)与范围查询(10K 次，每次 1000 个键)，单位：毫秒
+	const int size = 10000000;
+	const int span = 1000;
+	std::mt19937 random(42);
+	std::vector<int> probes(1000000);
+	for (int& key: probes)
+	{
+		key = static_cast<int>(random() % (2u * size));
+	}
+	std::vector<std::pair<int, int>> data(size);
+	for (int i = 0; i < size; ++i)
+	{
+		data[i] = std::make_pair(i * 2, i);
+	}
+
+	printf("%-20s%-12s%-12s%-12s%s\n", "Map", "Build", "Point", "Range", "Sum");
+	{
+		auto begin = std::chrono::steady_clock::now();
+		std::map<int, int> m(data.begin(), data.end());
+		Query_Bench("std::map", m, probes, span, Elapsed_Bench(begin));
+	}
+	{
+		auto begin = std::chrono::steady_clock::now();
+		Aoki::Map<int, int> m(data.begin(), data.end());
+		Query_Bench("Aoki::Map", m, probes, span, Elapsed_Bench(begin));
+	}
+	{
+		auto begin = std::chrono::steady_clock::now();
+		Aoki::BTree_Map<int, int> m;
+		m.bulk_load(data.begin(), data.end());
+		Query_Bench("Aoki::BTree_Map", m, probes, span, Elapsed_Bench(begin));
+	}
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_BTree_Map_01();
+	Test_BTree_Map_02();
+	Test_BTree_Map_03();
+	Test_BTree_Map_04();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <stdexcept>
+
+#include "RBTree.h"
+
+namespace Aoki
+{
+	//从 pair 中取出键
+	template<typename Pair>
+	struct Select_First
+	{
+		const typename Pair::first_type& operator()(const Pair& value) const
+		{
+			return value.first;
+		}
+	};
+
+	/**
+	 * @brief Map Class
+	 * @tparam Key: 键类型。
+	 * @tparam T: 值类型。
+	 * @tparam Compare: 键的比较器。
+	 * @details 以红黑树实现的有序映射，键唯一，插入、删除与查找的时间复杂度均为 O(logN)。
+	 */
+	template<typename Key, typename T, typename Compare = std::less<Key>>
+	class Map
+	{
+		typedef Map<Key, T, Compare> this_type;
+
+	public:
+		//配套类型
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef std::pair<const Key, T> value_type;
+		typedef Compare key_compare;
+		typedef RBTree<Key, value_type, Select_First<value_type>, Compare> base_type;
+		typedef typename base_type::iterator iterator;
+		typedef typename base_type::const_iterator const_iterator;
+		typedef typename base_type::reverse_iterator reverse_iterator;
+		typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+		typedef typename base_type::size_type size_type;
+
+	public:
+		//构造函数和析构函数
+		Map() : tree_()
+		{
+		}
+
+		explicit Map(const key_compare& compare) : tree_(compare)
+		{
+		}
+
+		template<typename InputIterator>
+		Map(InputIterator first, InputIterator last) : tree_()
+		{
+			insert(first, last);
+		}
+
+		Map(const this_type& other) = default;
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other) = default;
+
+		//元素访问
+		mapped_type& operator[](const key_type& key)
+		{
+			iterator it = tree_.lower_bound(key);
+			if (it == end() || tree_.key_comp()(key, it->first))
+			{
+				it = tree_.insert_unique(value_type(key, mapped_type())).first;
+			}
+			return it->second;
+		}
+
+		mapped_type& at(const key_type& key)
+		{
+			iterator it = tree_.find(key);
+			if (it == end())
+			{
+				throw std::out_of_range("Map::at");
+			}
+			return it->second;
+		}
+
+		const mapped_type& at(const key_type& key) const
+		{
+			const_iterator it = tree_.find(key);
+			if (it == end())
+			{
+				throw std::out_of_range("Map::at");
+			}
+			return it->second;
+		}
+
+		//迭代器
+		iterator begin()
+		{
+			return tree_.begin();
+		}
+
+		const_iterator begin() const
+		{
+			return tree_.begin();
+		}
+
+		iterator end()
+		{
+			return tree_.end();
+		}
+
+		const_iterator end() const
+		{
+			return tree_.end();
+		}
+
+		reverse_iterator rbegin()
+		{
+			return tree_.rbegin();
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return tree_.rbegin();
+		}
+
+		reverse_iterator rend()
+		{
+			return tree_.rend();
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return tree_.rend();
+		}
+
+		//容量
+		bool empty() const
+		{
+			return tree_.empty();
+		}
+
+		size_type size() const
+		{
+			return tree_.size();
+		}
+
+		//修改器
+		void clear()
+		{
+			tree_.clear();
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value)
+		{
+			return tree_.insert_unique(value);
+		}
+
+		template<typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+			{
+				tree_.insert_unique(*first);
+			}
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			return tree_.erase(pos);
+		}
+
+		size_type erase(const key_type& key)
+		{
+			return tree_.erase(key);
+		}
+
+		void swap(this_type& other)
+		{
+			tree_.swap(other.tree_);
+		}
+
+		//查找
+		iterator find(const key_type& key)
+		{
+			return tree_.find(key);
+		}
+
+		const_iterator find(const key_type& key) const
+		{
+			return tree_.find(key);
+		}
+
+		size_type count(const key_type& key) const
+		{
+			return tree_.count(key);
+		}
+
+		iterator lower_bound(const key_type& key)
+		{
+			return tree_.lower_bound(key);
+		}
+
+		const_iterator lower_bound(const key_type& key) const
+		{
+			return tree_.lower_bound(key);
+		}
+
+		iterator upper_bound(const key_type& key)
+		{
+			return tree_.upper_bound(key);
+		}
+
+		const_iterator upper_bound(const key_type& key) const
+		{
+			return tree_.upper_bound(key);
+		}
+
+		//观察器
+		key_compare key_comp() const
+		{
+			return tree_.key_comp();
+		}
+
+		//检查底层红黑树的性质(返回黑高，不满足时返回 0 )
+		size_type verify() const
+		{
+			return tree_.verify();
+		}
+
+	private:
+		//成员变量
+		base_type tree_;
+	};
+}
\ No newline at end of file
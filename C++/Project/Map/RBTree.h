@@ -0,0 +1,1066 @@
+#pragma once
+
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <functional>
+
+#include "../Iterator/Iterator.h"
+#include "../Pool/Node_Pool.h"
+
+namespace Aoki
+{
+	//节点颜色
+	enum RBTreeColor
+	{
+		RBTREE_RED,
+		RBTREE_BLACK
+	};
+
+	/**
+	 * @brief RBTreeNodeBase Class
+	 * @details 红黑树节点基类，只保存颜色与指针，旋转、调整与迭代器移动只依赖于此类(与数据类型无关)。
+	 */
+	struct RBTreeNodeBase
+	{
+		RBTreeNodeBase* pParent_;
+		RBTreeNodeBase* pLeft_;
+		RBTreeNodeBase* pRight_;
+		RBTreeColor color_;
+	};
+
+	/**
+	 * @brief RBTreeNode Class
+	 * @tparam T: 节点中存放数据的类型。
+	 */
+	template<typename T>
+	struct RBTreeNode : public RBTreeNodeBase
+	{
+		T data_;
+	};
+
+	/**
+	 * @brief Minimum_RBTree
+	 * @details 获取以 pNode 为根的子树中最左侧(最小)的节点。
+	 */
+	inline RBTreeNodeBase* Minimum_RBTree(RBTreeNodeBase* pNode)
+	{
+		while (pNode->pLeft_ != nullptr)
+		{
+			pNode = pNode->pLeft_;
+		}
+		return pNode;
+	}
+
+	/**
+	 * @brief Maximum_RBTree
+	 * @details 获取以 pNode 为根的子树中最右侧(最大)的节点。
+	 */
+	inline RBTreeNodeBase* Maximum_RBTree(RBTreeNodeBase* pNode)
+	{
+		while (pNode->pRight_ != nullptr)
+		{
+			pNode = pNode->pRight_;
+		}
+		return pNode;
+	}
+
+	/**
+	 * @brief Increment_RBTree
+	 * @details 获取中序遍历的下一个节点，最大节点的下一个节点为头节点( end() )。
+	 */
+	inline RBTreeNodeBase* Increment_RBTree(RBTreeNodeBase* pNode)
+	{
+		if (pNode->pRight_ != nullptr)
+		{
+			return Minimum_RBTree(pNode->pRight_);
+		}
+		RBTreeNodeBase* pParent = pNode->pParent_;
+		while (pNode == pParent->pRight_)
+		{
+			pNode = pParent;
+			pParent = pParent->pParent_;
+		}
+		//只有根节点且根节点没有右孩子时，循环停在头节点，此时不能再向上移动
+		return pNode->pRight_ != pParent ? pParent : pNode;
+	}
+
+	/**
+	 * @brief Decrement_RBTree
+	 * @details 获取中序遍历的上一个节点，头节点( end() )的上一个节点为最大节点。
+	 */
+	inline RBTreeNodeBase* Decrement_RBTree(RBTreeNodeBase* pNode)
+	{
+		//头节点为红色且其父节点(根节点)的父节点为其自身
+		if (pNode->color_ == RBTREE_RED && pNode->pParent_->pParent_ == pNode)
+		{
+			return pNode->pRight_;
+		}
+		if (pNode->pLeft_ != nullptr)
+		{
+			return Maximum_RBTree(pNode->pLeft_);
+		}
+		RBTreeNodeBase* pParent = pNode->pParent_;
+		while (pNode == pParent->pLeft_)
+		{
+			pNode = pParent;
+			pParent = pParent->pParent_;
+		}
+		return pParent;
+	}
+
+	/**
+	 * @brief Replace_RBTree
+	 * @details 用 pNew 替换 pOld 在其父节点中的位置( pNew 可为空)。
+	 */
+	inline void Replace_RBTree(RBTreeNodeBase* pOld, RBTreeNodeBase* pNew, RBTreeNodeBase*& pRoot)
+	{
+		if (pOld == pRoot)
+		{
+			pRoot = pNew;
+		}
+		else if (pOld == pOld->pParent_->pLeft_)
+		{
+			pOld->pParent_->pLeft_ = pNew;
+		}
+		else
+		{
+			pOld->pParent_->pRight_ = pNew;
+		}
+		if (pNew != nullptr)
+		{
+			pNew->pParent_ = pOld->pParent_;
+		}
+	}
+
+	/**
+	 * @brief Rotate_Left_RBTree
+	 * @details 以 pNode 为支点左旋。
+	 */
+	inline void Rotate_Left_RBTree(RBTreeNodeBase* pNode, RBTreeNodeBase*& pRoot)
+	{
+		RBTreeNodeBase* pChild = pNode->pRight_;
+		pNode->pRight_ = pChild->pLeft_;
+		if (pChild->pLeft_ != nullptr)
+		{
+			pChild->pLeft_->pParent_ = pNode;
+		}
+		Replace_RBTree(pNode, pChild, pRoot);
+		pChild->pLeft_ = pNode;
+		pNode->pParent_ = pChild;
+	}
+
+	/**
+	 * @brief Rotate_Right_RBTree
+	 * @details 以 pNode 为支点右旋。
+	 */
+	inline void Rotate_Right_RBTree(RBTreeNodeBase* pNode, RBTreeNodeBase*& pRoot)
+	{
+		RBTreeNodeBase* pChild = pNode->pLeft_;
+		pNode->pLeft_ = pChild->pRight_;
+		if (pChild->pRight_ != nullptr)
+		{
+			pChild->pRight_->pParent_ = pNode;
+		}
+		Replace_RBTree(pNode, pChild, pRoot);
+		pChild->pRight_ = pNode;
+		pNode->pParent_ = pChild;
+	}
+
+	/**
+	 * @brief Is_Red_RBTree
+	 * @details 判断节点是否为红色(空节点为黑色)。
+	 */
+	inline bool Is_Red_RBTree(const RBTreeNodeBase* pNode)
+	{
+		return pNode != nullptr && pNode->color_ == RBTREE_RED;
+	}
+
+	/**
+	 * @brief Insert_Rebalance_RBTree
+	 * @param pNode: 新节点。
+	 * @param pParent: 新节点的父节点(空树时为头节点)。
+	 * @param insertLeft: 是否作为左孩子插入。
+	 * @param pHeader: 头节点(其父节点为根节点，左、右孩子分别为最小、最大节点)。
+	 * @details 链接新节点并调整颜色与结构，消除连续的红色节点。
+	 */
+	inline void Insert_Rebalance_RBTree(RBTreeNodeBase* pNode, RBTreeNodeBase* pParent, bool insertLeft, RBTreeNodeBase* pHeader)
+	{
+		RBTreeNodeBase*& pRoot = pHeader->pParent_;
+		pNode->pParent_ = pParent;
+		pNode->pLeft_ = pNode->pRight_ = nullptr;
+		pNode->color_ = RBTREE_RED;
+		if (insertLeft)
+		{
+			pParent->pLeft_ = pNode;
+			if (pParent == pHeader)
+			{
+				pHeader->pParent_ = pNode;
+				pHeader->pRight_ = pNode;
+			}
+			else if (pParent == pHeader->pLeft_)
+			{
+				pHeader->pLeft_ = pNode;
+			}
+		}
+		else
+		{
+			pParent->pRight_ = pNode;
+			if (pParent == pHeader->pRight_)
+			{
+				pHeader->pRight_ = pNode;
+			}
+		}
+		while (pNode != pRoot && Is_Red_RBTree(pNode->pParent_))
+		{
+			RBTreeNodeBase* pFather = pNode->pParent_;
+			RBTreeNodeBase* pGrand = pFather->pParent_;
+			if (pFather == pGrand->pLeft_)
+			{
+				RBTreeNodeBase* pUncle = pGrand->pRight_;
+				//叔叔为红色：父、叔变黑，祖父变红，继续向上调整
+				if (Is_Red_RBTree(pUncle))
+				{
+					pFather->color_ = pUncle->color_ = RBTREE_BLACK;
+					pGrand->color_ = RBTREE_RED;
+					pNode = pGrand;
+					continue;
+				}
+				//叔叔为黑色：先转为同侧，再旋转祖父
+				if (pNode == pFather->pRight_)
+				{
+					Rotate_Left_RBTree(pFather, pRoot);
+					pNode = pFather;
+					pFather = pNode->pParent_;
+				}
+				pFather->color_ = RBTREE_BLACK;
+				pGrand->color_ = RBTREE_RED;
+				Rotate_Right_RBTree(pGrand, pRoot);
+			}
+			else
+			{
+				RBTreeNodeBase* pUncle = pGrand->pLeft_;
+				if (Is_Red_RBTree(pUncle))
+				{
+					pFather->color_ = pUncle->color_ = RBTREE_BLACK;
+					pGrand->color_ = RBTREE_RED;
+					pNode = pGrand;
+					continue;
+				}
+				if (pNode == pFather->pLeft_)
+				{
+					Rotate_Right_RBTree(pFather, pRoot);
+					pNode = pFather;
+					pFather = pNode->pParent_;
+				}
+				pFather->color_ = RBTREE_BLACK;
+				pGrand->color_ = RBTREE_RED;
+				Rotate_Left_RBTree(pGrand, pRoot);
+			}
+		}
+		pRoot->color_ = RBTREE_BLACK;
+	}
+
+	/**
+	 * @brief Erase_Rebalance_RBTree
+	 * @param pNode: 将要删除的节点。
+	 * @param pHeader: 头节点。
+	 * @details 将 pNode 从树中摘除并调整，使树重新满足红黑树的性质。
+	 * @note 此函数不会释放 pNode 的内存。
+	 */
+	inline void Erase_Rebalance_RBTree(RBTreeNodeBase* pNode, RBTreeNodeBase* pHeader)
+	{
+		RBTreeNodeBase*& pRoot = pHeader->pParent_;
+		//先更新最小、最大节点(被删除的最小节点没有左孩子，最大节点没有右孩子)
+		if (pNode == pHeader->pLeft_)
+		{
+			pHeader->pLeft_ = pNode->pRight_ != nullptr ? Minimum_RBTree(pNode->pRight_) : pNode->pParent_;
+		}
+		if (pNode == pHeader->pRight_)
+		{
+			pHeader->pRight_ = pNode->pLeft_ != nullptr ? Maximum_RBTree(pNode->pLeft_) : pNode->pParent_;
+		}
+		RBTreeNodeBase* pChild = nullptr;
+		RBTreeNodeBase* pParent = nullptr;
+		RBTreeColor removed = pNode->color_;
+		if (pNode->pLeft_ == nullptr || pNode->pRight_ == nullptr)
+		{
+			//至多一个孩子：用孩子替换被删除的节点
+			pChild = pNode->pLeft_ != nullptr ? pNode->pLeft_ : pNode->pRight_;
+			pParent = pNode->pParent_;
+			Replace_RBTree(pNode, pChild, pRoot);
+		}
+		else
+		{
+			//两个孩子：用后继替换被删除的节点，实际被移走的是后继原来的位置
+			RBTreeNodeBase* pNext = Minimum_RBTree(pNode->pRight_);
+			removed = pNext->color_;
+			pChild = pNext->pRight_;
+			if (pNext->pParent_ == pNode)
+			{
+				pParent = pNext;
+			}
+			else
+			{
+				pParent = pNext->pParent_;
+				Replace_RBTree(pNext, pNext->pRight_, pRoot);
+				pNext->pRight_ = pNode->pRight_;
+				pNext->pRight_->pParent_ = pNext;
+			}
+			Replace_RBTree(pNode, pNext, pRoot);
+			pNext->pLeft_ = pNode->pLeft_;
+			pNext->pLeft_->pParent_ = pNext;
+			pNext->color_ = pNode->color_;
+		}
+		if (removed == RBTREE_RED)
+		{
+			return;
+		}
+		//pChild 所在的一侧少了一个黑色节点
+		while (pChild != pRoot && !Is_Red_RBTree(pChild))
+		{
+			if (pChild == pParent->pLeft_)
+			{
+				RBTreeNodeBase* pSibling = pParent->pRight_;
+				if (Is_Red_RBTree(pSibling))
+				{
+					pSibling->color_ = RBTREE_BLACK;
+					pParent->color_ = RBTREE_RED;
+					Rotate_Left_RBTree(pParent, pRoot);
+					pSibling = pParent->pRight_;
+				}
+				if (!Is_Red_RBTree(pSibling->pLeft_) && !Is_Red_RBTree(pSibling->pRight_))
+				{
+					pSibling->color_ = RBTREE_RED;
+					pChild = pParent;
+					pParent = pChild->pParent_;
+					continue;
+				}
+				if (!Is_Red_RBTree(pSibling->pRight_))
+				{
+					pSibling->pLeft_->color_ = RBTREE_BLACK;
+					pSibling->color_ = RBTREE_RED;
+					Rotate_Right_RBTree(pSibling, pRoot);
+					pSibling = pParent->pRight_;
+				}
+				pSibling->color_ = pParent->color_;
+				pParent->color_ = RBTREE_BLACK;
+				pSibling->pRight_->color_ = RBTREE_BLACK;
+				Rotate_Left_RBTree(pParent, pRoot);
+				pChild = pRoot;
+			}
+			else
+			{
+				RBTreeNodeBase* pSibling = pParent->pLeft_;
+				if (Is_Red_RBTree(pSibling))
+				{
+					pSibling->color_ = RBTREE_BLACK;
+					pParent->color_ = RBTREE_RED;
+					Rotate_Right_RBTree(pParent, pRoot);
+					pSibling = pParent->pLeft_;
+				}
+				if (!Is_Red_RBTree(pSibling->pLeft_) && !Is_Red_RBTree(pSibling->pRight_))
+				{
+					pSibling->color_ = RBTREE_RED;
+					pChild = pParent;
+					pParent = pChild->pParent_;
+					continue;
+				}
+				if (!Is_Red_RBTree(pSibling->pLeft_))
+				{
+					pSibling->pRight_->color_ = RBTREE_BLACK;
+					pSibling->color_ = RBTREE_RED;
+					Rotate_Left_RBTree(pSibling, pRoot);
+					pSibling = pParent->pLeft_;
+				}
+				pSibling->color_ = pParent->color_;
+				pParent->color_ = RBTREE_BLACK;
+				pSibling->pLeft_->color_ = RBTREE_BLACK;
+				Rotate_Right_RBTree(pParent, pRoot);
+				pChild = pRoot;
+			}
+		}
+		if (pChild != nullptr)
+		{
+			pChild->color_ = RBTREE_BLACK;
+		}
+	}
+
+	/**
+	 * @brief RBTreeIterator Class
+	 * @tparam T: 节点中存放数据的类型。
+	 * @tparam Pointer: 指针类型。
+	 * @tparam Reference: 引用类型。
+	 * @details 双向迭代器，按中序(键的升序)移动。
+	 */
+	template<typename T, typename Pointer, typename Reference>
+	struct RBTreeIterator
+	{
+		typedef RBTreeIterator<T, Pointer, Reference> this_type;
+
+	public:
+		//配套类型
+		typedef RBTreeIterator<T, T*, T&> iterator;
+		typedef RBTreeIterator<T, const T*, const T&> const_iterator;
+		typedef RBTreeNode<T> node_type;
+		typedef Pointer pointer;
+		typedef Reference reference;
+		typedef std::size_t size_type;
+
+	public:
+		//成员变量
+		RBTreeNodeBase* pNode_;
+
+	public:
+		RBTreeIterator();
+
+		explicit RBTreeIterator(const RBTreeNodeBase* pNode);
+
+		RBTreeIterator(const iterator& x);
+
+		this_type& operator=(const this_type& x) = default;
+
+		reference operator*() const;
+
+		pointer operator->() const;
+
+		this_type& operator++();
+
+		this_type operator++(int);
+
+		this_type& operator--();
+
+		this_type operator--(int);
+	};
+
+	/**
+	 * @brief RBTree Class
+	 * @tparam Key: 键类型。
+	 * @tparam Value: 节点中存放数据的类型。
+	 * @tparam KeyOfValue: 从数据中取出键的函数对象。
+	 * @tparam Compare: 键的比较器。
+	 * @details 红黑树，键唯一，作为 Map 与 Set 的底层容器。
+	 *          头节点的父节点为根节点，左、右孩子分别为最小、最大节点，头节点即为 end()。
+	 *          节点从树自带的 Node_Pool 中申请，插入与删除不会逐个调用 new/delete。
+	 */
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare = std::less<Key>>
+	class RBTree
+	{
+		typedef RBTree<Key, Value, KeyOfValue, Compare> this_type;
+
+	public:
+		//配套类型
+		typedef Key key_type;
+		typedef Value value_type;
+		typedef Compare key_compare;
+		typedef Value* pointer;
+		typedef const Value* const_pointer;
+		typedef Value& reference;
+		typedef const Value& const_reference;
+		typedef RBTreeIterator<Value, Value*, Value&> iterator;
+		typedef RBTreeIterator<Value, const Value*, const Value&> const_iterator;
+		typedef Aoki::reverse_iterator<iterator, Value*, Value&> reverse_iterator;
+		typedef Aoki::reverse_iterator<const_iterator, const Value*, const Value&> const_reverse_iterator;
+		typedef std::size_t size_type;
+		typedef RBTreeNode<Value> node_type;
+
+	public:
+		//构造函数和析构函数
+		RBTree();
+
+		explicit RBTree(const key_compare& compare);
+
+		RBTree(const this_type& other);
+
+		~RBTree();
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other);
+
+		//迭代器
+		iterator begin();
+
+		const_iterator begin() const;
+
+		iterator end();
+
+		const_iterator end() const;
+
+		reverse_iterator rbegin();
+
+		const_reverse_iterator rbegin() const;
+
+		reverse_iterator rend();
+
+		const_reverse_iterator rend() const;
+
+		//容量
+		bool empty() const;
+
+		size_type size() const;
+
+		//修改器
+		void clear();
+
+		std::pair<iterator, bool> insert_unique(const value_type& value);
+
+		iterator erase(const_iterator pos);
+
+		size_type erase(const key_type& key);
+
+		void swap(this_type& other);
+
+		//查找
+		iterator find(const key_type& key);
+
+		const_iterator find(const key_type& key) const;
+
+		size_type count(const key_type& key) const;
+
+		iterator lower_bound(const key_type& key);
+
+		const_iterator lower_bound(const key_type& key) const;
+
+		iterator upper_bound(const key_type& key);
+
+		const_iterator upper_bound(const key_type& key) const;
+
+		//观察器
+		key_compare key_comp() const;
+
+		//检查红黑树的性质(返回黑高，不满足时返回 0 )
+		size_type verify() const;
+
+	private:
+		//帮手函数
+		void DoInit();
+
+		node_type* DoCreateNode(const value_type& value);
+
+		void DoDestroyNode(node_type* pNode);
+
+		node_type* DoCopy(const node_type* pSource, RBTreeNodeBase* pParent);
+
+		void DoErase(node_type* pNode);
+
+		RBTreeNodeBase* DoLowerBound(const key_type& key) const;
+
+		RBTreeNodeBase* DoUpperBound(const key_type& key) const;
+
+		size_type DoVerify(const RBTreeNodeBase* pNode, const RBTreeNodeBase* pParent) const;
+
+		static const key_type& DoKey(const RBTreeNodeBase* pNode);
+
+	private:
+		//成员变量
+		RBTreeNodeBase* pHeader_;
+		size_type size_;
+		key_compare compare_;
+		Aoki::Node_Pool<node_type> pool_;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	// RBTreeIterator Class 实现
+	///////////////////////////////////////////////////////////////////////
+
+	template<typename T, typename Pointer, typename Reference>
+	RBTreeIterator<T, Pointer, Reference>::RBTreeIterator() : pNode_(nullptr)
+	{
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	RBTreeIterator<T, Pointer, Reference>::RBTreeIterator(const RBTreeNodeBase* pNode)
+			: pNode_(const_cast<RBTreeNodeBase*>(pNode))
+	{
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	RBTreeIterator<T, Pointer, Reference>::RBTreeIterator(const iterator& x) : pNode_(x.pNode_)
+	{
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	typename RBTreeIterator<T, Pointer, Reference>::reference RBTreeIterator<T, Pointer, Reference>::operator*() const
+	{
+		return static_cast<node_type*>(pNode_)->data_;
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	typename RBTreeIterator<T, Pointer, Reference>::pointer RBTreeIterator<T, Pointer, Reference>::operator->() const
+	{
+		return &(static_cast<node_type*>(pNode_)->data_);
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	typename RBTreeIterator<T, Pointer, Reference>::this_type& RBTreeIterator<T, Pointer, Reference>::operator++()
+	{
+		pNode_ = Increment_RBTree(pNode_);
+		return *this;
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	typename RBTreeIterator<T, Pointer, Reference>::this_type RBTreeIterator<T, Pointer, Reference>::operator++(int)
+	{
+		this_type temp = *this;
+		pNode_ = Increment_RBTree(pNode_);
+		return temp;
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	typename RBTreeIterator<T, Pointer, Reference>::this_type& RBTreeIterator<T, Pointer, Reference>::operator--()
+	{
+		pNode_ = Decrement_RBTree(pNode_);
+		return *this;
+	}
+
+	template<typename T, typename Pointer, typename Reference>
+	typename RBTreeIterator<T, Pointer, Reference>::this_type RBTreeIterator<T, Pointer, Reference>::operator--(int)
+	{
+		this_type temp = *this;
+		pNode_ = Decrement_RBTree(pNode_);
+		return temp;
+	}
+
+	template<typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB>
+	bool operator==(const RBTreeIterator<T, PointerA, ReferenceA>& a, const RBTreeIterator<T, PointerB, ReferenceB>& b)
+	{
+		return a.pNode_ == b.pNode_;
+	}
+
+	template<typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB>
+	bool operator!=(const RBTreeIterator<T, PointerA, ReferenceA>& a, const RBTreeIterator<T, PointerB, ReferenceB>& b)
+	{
+		return a.pNode_ != b.pNode_;
+	}
+
+	///////////////////////////////////////////////////////////////////////
+	// RBTree Class 实现
+	///////////////////////////////////////////////////////////////////////
+
+	//构造函数和析构函数
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	RBTree<Key, Value, KeyOfValue, Compare>::RBTree() : pHeader_(new RBTreeNodeBase), size_(0), compare_()
+	{
+		DoInit();
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	RBTree<Key, Value, KeyOfValue, Compare>::RBTree(const key_compare& compare)
+			: pHeader_(new RBTreeNodeBase), size_(0), compare_(compare)
+	{
+		DoInit();
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	RBTree<Key, Value, KeyOfValue, Compare>::RBTree(const this_type& other)
+			: pHeader_(new RBTreeNodeBase), size_(0), compare_(other.compare_)
+	{
+		DoInit();
+		*this = other;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	RBTree<Key, Value, KeyOfValue, Compare>::~RBTree()
+	{
+		clear();
+		delete pHeader_;
+		pHeader_ = nullptr;
+	}
+
+	//重载赋值运算符
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::this_type&
+	RBTree<Key, Value, KeyOfValue, Compare>::operator=(const this_type& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			compare_ = other.compare_;
+			if (other.pHeader_->pParent_ != nullptr)
+			{
+				//按结构复制，不需要重新比较与调整
+				pHeader_->pParent_ = DoCopy(static_cast<const node_type*>(other.pHeader_->pParent_), pHeader_);
+				pHeader_->pLeft_ = Minimum_RBTree(pHeader_->pParent_);
+				pHeader_->pRight_ = Maximum_RBTree(pHeader_->pParent_);
+				size_ = other.size_;
+			}
+		}
+		return *this;
+	}
+
+	//迭代器
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::iterator RBTree<Key, Value, KeyOfValue, Compare>::begin()
+	{
+		return iterator(pHeader_->pLeft_);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::const_iterator RBTree<Key, Value, KeyOfValue, Compare>::begin() const
+	{
+		return const_iterator(pHeader_->pLeft_);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::iterator RBTree<Key, Value, KeyOfValue, Compare>::end()
+	{
+		return iterator(pHeader_);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::const_iterator RBTree<Key, Value, KeyOfValue, Compare>::end() const
+	{
+		return const_iterator(pHeader_);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::reverse_iterator RBTree<Key, Value, KeyOfValue, Compare>::rbegin()
+	{
+		return reverse_iterator(end());
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::const_reverse_iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::rbegin() const
+	{
+		return const_reverse_iterator(end());
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::reverse_iterator RBTree<Key, Value, KeyOfValue, Compare>::rend()
+	{
+		return reverse_iterator(begin());
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::const_reverse_iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::rend() const
+	{
+		return const_reverse_iterator(begin());
+	}
+
+	//容量
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	bool RBTree<Key, Value, KeyOfValue, Compare>::empty() const
+	{
+		return size_ == 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::size_type RBTree<Key, Value, KeyOfValue, Compare>::size() const
+	{
+		return size_;
+	}
+
+	//修改器
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	void RBTree<Key, Value, KeyOfValue, Compare>::clear()
+	{
+		DoErase(static_cast<node_type*>(pHeader_->pParent_));
+		DoInit();
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	std::pair<typename RBTree<Key, Value, KeyOfValue, Compare>::iterator, bool>
+	RBTree<Key, Value, KeyOfValue, Compare>::insert_unique(const value_type& value)
+	{
+		const key_type& key = KeyOfValue()(value);
+		RBTreeNodeBase* pParent = pHeader_;
+		RBTreeNodeBase* pCur = pHeader_->pParent_;
+		bool insertLeft = true;
+		while (pCur != nullptr)
+		{
+			pParent = pCur;
+			insertLeft = compare_(key, DoKey(pCur));
+			pCur = insertLeft ? pCur->pLeft_ : pCur->pRight_;
+		}
+		//键等价的节点只可能是插入位置的前驱
+		iterator prev(pParent);
+		if (insertLeft)
+		{
+			if (prev == begin())
+			{
+				prev.pNode_ = nullptr;
+			}
+			else
+			{
+				--prev;
+			}
+		}
+		if (prev.pNode_ != nullptr && prev.pNode_ != pHeader_ && !compare_(DoKey(prev.pNode_), key))
+		{
+			return std::pair<iterator, bool>(prev, false);
+		}
+		node_type* pNode = DoCreateNode(value);
+		Insert_Rebalance_RBTree(pNode, pParent, insertLeft, pHeader_);
+		++size_;
+		return std::pair<iterator, bool>(iterator(pNode), true);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::erase(const_iterator pos)
+	{
+		iterator next(pos.pNode_);
+		++next;
+		Erase_Rebalance_RBTree(pos.pNode_, pHeader_);
+		DoDestroyNode(static_cast<node_type*>(pos.pNode_));
+		--size_;
+		return next;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::size_type
+	RBTree<Key, Value, KeyOfValue, Compare>::erase(const key_type& key)
+	{
+		iterator it = find(key);
+		if (it == end())
+		{
+			return 0;
+		}
+		erase(const_iterator(it));
+		return 1;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	void RBTree<Key, Value, KeyOfValue, Compare>::swap(this_type& other)
+	{
+		std::swap(pHeader_, other.pHeader_);
+		std::swap(size_, other.size_);
+		std::swap(compare_, other.compare_);
+		pool_.swap(other.pool_);
+	}
+
+	//查找
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::find(const key_type& key)
+	{
+		RBTreeNodeBase* pNode = DoLowerBound(key);
+		return (pNode == pHeader_ || compare_(key, DoKey(pNode))) ? end() : iterator(pNode);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::const_iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::find(const key_type& key) const
+	{
+		RBTreeNodeBase* pNode = DoLowerBound(key);
+		return (pNode == pHeader_ || compare_(key, DoKey(pNode))) ? end() : const_iterator(pNode);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::size_type
+	RBTree<Key, Value, KeyOfValue, Compare>::count(const key_type& key) const
+	{
+		return find(key) == end() ? 0 : 1;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::lower_bound(const key_type& key)
+	{
+		return iterator(DoLowerBound(key));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::const_iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::lower_bound(const key_type& key) const
+	{
+		return const_iterator(DoLowerBound(key));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::upper_bound(const key_type& key)
+	{
+		return iterator(DoUpperBound(key));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::const_iterator
+	RBTree<Key, Value, KeyOfValue, Compare>::upper_bound(const key_type& key) const
+	{
+		return const_iterator(DoUpperBound(key));
+	}
+
+	//观察器
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::key_compare RBTree<Key, Value, KeyOfValue, Compare>::key_comp() const
+	{
+		return compare_;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::size_type RBTree<Key, Value, KeyOfValue, Compare>::verify() const
+	{
+		const RBTreeNodeBase* pRoot = pHeader_->pParent_;
+		if (pRoot == nullptr)
+		{
+			return size_ == 0 && pHeader_->pLeft_ == pHeader_ && pHeader_->pRight_ == pHeader_ ? 1 : 0;
+		}
+		if (pRoot->color_ != RBTREE_BLACK || pHeader_->pLeft_ != Minimum_RBTree(const_cast<RBTreeNodeBase*>(pRoot))
+				|| pHeader_->pRight_ != Maximum_RBTree(const_cast<RBTreeNodeBase*>(pRoot)))
+		{
+			return 0;
+		}
+		size_type count = 0;
+		for (const_iterator it = begin(), prev = end(); it != end(); prev = it, ++it, ++count)
+		{
+			if (prev != end() && !compare_(DoKey(prev.pNode_), DoKey(it.pNode_)))
+			{
+				return 0;
+			}
+		}
+		return count == size_ ? DoVerify(pRoot, pHeader_) : 0;
+	}
+
+	//帮手函数
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	void RBTree<Key, Value, KeyOfValue, Compare>::DoInit()
+	{
+		//头节点为红色，以便与根节点区分(见 Decrement_RBTree )
+		pHeader_->color_ = RBTREE_RED;
+		pHeader_->pParent_ = nullptr;
+		pHeader_->pLeft_ = pHeader_;
+		pHeader_->pRight_ = pHeader_;
+		size_ = 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::node_type*
+	RBTree<Key, Value, KeyOfValue, Compare>::DoCreateNode(const value_type& value)
+	{
+		void* pMemory = pool_.allocate();
+		node_type* pNode = static_cast<node_type*>(pMemory);
+		try
+		{
+			::new(static_cast<void*>(&pNode->data_)) value_type(value);
+		}
+		catch (...)
+		{
+			pool_.deallocate(pMemory);
+			throw;
+		}
+		return pNode;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	void RBTree<Key, Value, KeyOfValue, Compare>::DoDestroyNode(node_type* pNode)
+	{
+		pNode->data_.~value_type();
+		pool_.deallocate(pNode);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::node_type*
+	RBTree<Key, Value, KeyOfValue, Compare>::DoCopy(const node_type* pSource, RBTreeNodeBase* pParent)
+	{
+		//右子树递归复制，左子树循环复制，递归深度不超过树高
+		node_type* pTop = DoCreateNode(pSource->data_);
+		pTop->color_ = pSource->color_;
+		pTop->pParent_ = pParent;
+		pTop->pLeft_ = pTop->pRight_ = nullptr;
+		if (pSource->pRight_ != nullptr)
+		{
+			pTop->pRight_ = DoCopy(static_cast<const node_type*>(pSource->pRight_), pTop);
+		}
+		RBTreeNodeBase* pPrev = pTop;
+		pSource = static_cast<const node_type*>(pSource->pLeft_);
+		while (pSource != nullptr)
+		{
+			node_type* pNode = DoCreateNode(pSource->data_);
+			pNode->color_ = pSource->color_;
+			pNode->pLeft_ = pNode->pRight_ = nullptr;
+			pPrev->pLeft_ = pNode;
+			pNode->pParent_ = pPrev;
+			if (pSource->pRight_ != nullptr)
+			{
+				pNode->pRight_ = DoCopy(static_cast<const node_type*>(pSource->pRight_), pNode);
+			}
+			pPrev = pNode;
+			pSource = static_cast<const node_type*>(pSource->pLeft_);
+		}
+		return pTop;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	void RBTree<Key, Value, KeyOfValue, Compare>::DoErase(node_type* pNode)
+	{
+		while (pNode != nullptr)
+		{
+			DoErase(static_cast<node_type*>(pNode->pRight_));
+			node_type* pLeft = static_cast<node_type*>(pNode->pLeft_);
+			DoDestroyNode(pNode);
+			pNode = pLeft;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	RBTreeNodeBase* RBTree<Key, Value, KeyOfValue, Compare>::DoLowerBound(const key_type& key) const
+	{
+		RBTreeNodeBase* pResult = pHeader_;
+		RBTreeNodeBase* pCur = pHeader_->pParent_;
+		while (pCur != nullptr)
+		{
+			if (compare_(DoKey(pCur), key))
+			{
+				pCur = pCur->pRight_;
+			}
+			else
+			{
+				pResult = pCur;
+				pCur = pCur->pLeft_;
+			}
+		}
+		return pResult;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	RBTreeNodeBase* RBTree<Key, Value, KeyOfValue, Compare>::DoUpperBound(const key_type& key) const
+	{
+		RBTreeNodeBase* pResult = pHeader_;
+		RBTreeNodeBase* pCur = pHeader_->pParent_;
+		while (pCur != nullptr)
+		{
+			if (compare_(key, DoKey(pCur)))
+			{
+				pResult = pCur;
+				pCur = pCur->pLeft_;
+			}
+			else
+			{
+				pCur = pCur->pRight_;
+			}
+		}
+		return pResult;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	typename RBTree<Key, Value, KeyOfValue, Compare>::size_type
+	RBTree<Key, Value, KeyOfValue, Compare>::DoVerify(const RBTreeNodeBase* pNode, const RBTreeNodeBase* pParent) const
+	{
+		if (pNode == nullptr)
+		{
+			return 1;
+		}
+		if (pNode->pParent_ != pParent
+				|| (Is_Red_RBTree(pNode) && (Is_Red_RBTree(pNode->pLeft_) || Is_Red_RBTree(pNode->pRight_))))
+		{
+			return 0;
+		}
+		size_type left = DoVerify(pNode->pLeft_, pNode);
+		size_type right = DoVerify(pNode->pRight_, pNode);
+		if (left == 0 || left != right)
+		{
+			return 0;
+		}
+		return left + (pNode->color_ == RBTREE_BLACK ? 1 : 0);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Compare>
+	const typename RBTree<Key, Value, KeyOfValue, Compare>::key_type&
+	RBTree<Key, Value, KeyOfValue, Compare>::DoKey(const RBTreeNodeBase* pNode)
+	{
+		return KeyOfValue()(static_cast<const node_type*>(pNode)->data_);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "RBTree.h"
+
+namespace Aoki
+{
+	//键即为数据本身
+	template<typename T>
+	struct Identity
+	{
+		const T& operator()(const T& value) const
+		{
+			return value;
+		}
+	};
+
+	/**
+	 * @brief Set Class
+	 * @tparam Key: 键类型。
+	 * @tparam Compare: 键的比较器。
+	 * @details 以红黑树实现的有序集合，键唯一，插入、删除与查找的时间复杂度均为 O(logN)。
+	 *          键不可修改，因此迭代器与常量迭代器相同。
+	 */
+	template<typename Key, typename Compare = std::less<Key>>
+	class Set
+	{
+		typedef Set<Key, Compare> this_type;
+
+	public:
+		//配套类型
+		typedef Key key_type;
+		typedef Key value_type;
+		typedef Compare key_compare;
+		typedef RBTree<Key, Key, Identity<Key>, Compare> base_type;
+		typedef typename base_type::const_iterator iterator;
+		typedef typename base_type::const_iterator const_iterator;
+		typedef typename base_type::const_reverse_iterator reverse_iterator;
+		typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+		typedef typename base_type::size_type size_type;
+
+	public:
+		//构造函数和析构函数
+		Set() : tree_()
+		{
+		}
+
+		explicit Set(const key_compare& compare) : tree_(compare)
+		{
+		}
+
+		template<typename InputIterator>
+		Set(InputIterator first, InputIterator last) : tree_()
+		{
+			insert(first, last);
+		}
+
+		Set(const this_type& other) = default;
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other) = default;
+
+		//迭代器
+		iterator begin() const
+		{
+			return tree_.begin();
+		}
+
+		iterator end() const
+		{
+			return tree_.end();
+		}
+
+		reverse_iterator rbegin() const
+		{
+			return tree_.rbegin();
+		}
+
+		reverse_iterator rend() const
+		{
+			return tree_.rend();
+		}
+
+		//容量
+		bool empty() const
+		{
+			return tree_.empty();
+		}
+
+		size_type size() const
+		{
+			return tree_.size();
+		}
+
+		//修改器
+		void clear()
+		{
+			tree_.clear();
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value)
+		{
+			std::pair<typename base_type::iterator, bool> result = tree_.insert_unique(value);
+			return std::pair<iterator, bool>(result.first, result.second);
+		}
+
+		template<typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+			{
+				tree_.insert_unique(*first);
+			}
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			return tree_.erase(pos);
+		}
+
+		size_type erase(const key_type& key)
+		{
+			return tree_.erase(key);
+		}
+
+		void swap(this_type& other)
+		{
+			tree_.swap(other.tree_);
+		}
+
+		//查找
+		iterator find(const key_type& key) const
+		{
+			return tree_.find(key);
+		}
+
+		size_type count(const key_type& key) const
+		{
+			return tree_.count(key);
+		}
+
+		iterator lower_bound(const key_type& key) const
+		{
+			return tree_.lower_bound(key);
+		}
+
+		iterator upper_bound(const key_type& key) const
+		{
+			return tree_.upper_bound(key);
+		}
+
+		//观察器
+		key_compare key_comp() const
+		{
+			return tree_.key_comp();
+		}
+
+		//检查底层红黑树的性质(返回黑高，不满足时返回 0 )
+		size_type verify() const
+		{
+			return tree_.verify();
+		}
+
+	private:
+		//成员变量
+		base_type tree_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include "Map.h"
+#include "Set.h"
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+using std::printf;
+
+void Test_Map_01()
+{
+	printf("******************************01******************************\n");
+
+	Aoki::Map<std::string, int> m;
+	assert(m.empty() && (m.size() == 0));
+
+	m["banana"] = 3;
+	m["apple"] = 1;
+	m["cherry"] = 5;
+	m.insert(std::make_pair(std::string("date"), 7));
+	assert(!m.insert(std::make_pair(std::string("apple"), 100)).second);
+	assert(m.size() == 4 && m.at("apple") == 1 && m.count("fig") == 0);
+
+	for (auto& kv: m)
+	{
+		std::cout << kv.first << ":" << kv.second << " ";
+	}
+	std::cout << std::endl;
+
+	for (auto rit = m.rbegin(); rit != m.rend(); ++rit)
+	{
+		std::cout << (*rit).first << " ";
+	}
+	std::cout << std::endl;
+
+	assert(m.erase("banana") == 1 && m.erase("banana") == 0);
+	assert(m.lower_bound("b")->first == "cherry" && m.upper_bound("cherry")->first == "date");
+
+	Aoki::Map<std::string, int> copy(m);
+	copy["apple"] = 2;
+	assert(m["apple"] == 1 && copy["apple"] == 2 && copy.verify() != 0);
+
+	bool thrown = false;
+	try
+	{
+		m.at("fig");
+	}
+	catch (const std::out_of_range&)
+	{
+		thrown = true;
+	}
+	assert(thrown);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Map_02()
+{
+	printf("******************************02******************************\n");
+
+	//随机插入与删除，与 std::map 对照
+	std::mt19937 random(20221019);
+	Aoki::Map<int, int> m;
+	std::map<int, int> ref;
+	for (int round = 0; round < 200000; ++round)
+	{
+		int key = static_cast<int>(random() % 5000);
+		if (random() % 3 == 0)
+		{
+			assert(m.erase(key) == ref.erase(key));
+		}
+		else
+		{
+			m[key] = round;
+			ref[key] = round;
+		}
+		if (round % 20000 == 0)
+		{
+			assert(m.verify() != 0);
+		}
+	}
+	assert(m.size() == ref.size() && m.verify() != 0);
+	assert(std::equal(m.begin(), m.end(), ref.begin(),
+			[](const std::pair<const int, int>& a, const std::pair<const int, int>& b)
+			{
+				return a.first == b.first && a.second == b.second;
+			}));
+
+	//按迭代器删除区间
+	auto it = m.lower_bound(1000);
+	while (it != m.end() && it->first < 2000)
+	{
+		it = m.erase(it);
+	}
+	ref.erase(ref.lower_bound(1000), ref.lower_bound(2000));
+	assert(m.size() == ref.size() && m.verify() != 0);
+
+	printf("%s\n", m.size() == ref.size() ? "Good Luck!" : "Oops!");
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Set_03()
+{
+	printf("******************************03******************************\n");
+
+	int arr[] = { 5, 3, 8, 1, 9, 3, 5, 7 };
+	Aoki::Set<int> s(arr, arr + sizeof(arr) / sizeof(arr[0]));
+	assert(s.size() == 6 && s.verify() != 0);
+	for (auto i: s)
+	{
+		std::cout << i << " ";
+	}
+	std::cout << std::endl;
+
+	Aoki::Set<int, std::greater<int>> r(arr, arr + sizeof(arr) / sizeof(arr[0]));
+	for (auto i: r)
+	{
+		std::cout << i << " ";
+	}
+	std::cout << std::endl;
+
+	assert(*s.lower_bound(4) == 5 && s.find(4) == s.end());
+	s.erase(s.begin());
+	assert(*s.begin() == 3);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+//获取自 begin 起经过的时间(单位：毫秒)
+double Elapsed_Bench(std::chrono::steady_clock::time_point begin)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+template<typename MapType>
+void Run_Bench(const char* name, const std::vector<int>& keys)
+{
+	auto begin = std::chrono::steady_clock::now();
+	MapType m;
+	for (int key: keys)
+	{
+		m[key] = key;
+	}
+	double insert = Elapsed_Bench(begin);
+
+	begin = std::chrono::steady_clock::now();
+	long long sum = 0;
+	for (int key: keys)
+	{
+		sum += m.find(key)->second;
+	}
+	double find = Elapsed_Bench(begin);
+
+	begin = std::chrono::steady_clock::now();
+	for (auto& kv: m)
+	{
+		sum += kv.second;
+	}
+	double iterate = Elapsed_Bench(begin);
+
+	begin = std::chrono::steady_clock::now();
+	for (int key: keys)
+	{
+		m.erase(key);
+	}
+	double erase = Elapsed_Bench(begin);
+
+	printf("%-12s%-12.1lf%-12.1lf%-12.1lf%-12.1lf%lld\n", name, insert, find, iterate, erase, sum);
+}
+
+void Test_Map_04()
+{
+	printf("******************************04******************************\n");
+
+	//随机键上的插入、查找、遍历与删除耗时(单位：毫秒)
+	const int size = 1000000;
+	std::vector<int> keys(size);
+	for (int i = 0; i < size; ++i)
+	{
+		keys[i] = i;
+	}
+	std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+	printf("%-12s%-12s%-12s%-12s%-12s%s\n", "Map", "Insert", "Find", "Iterate", "Erase", "Sum");
+	Run_Bench<std::map<int, int>>("std::map", keys);
+	Run_Bench<Aoki::Map<int, int>>("Aoki::Map", keys);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_Map_01();
+	Test_Map_02();
+	Test_Set_03();
+	Test_Map_04();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+#include "Mapped_File.h"
+
+#include <cstdio>
+#include <cerrno>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+//构造函数和析构函数
+Aoki::Mapped_File::Mapped_File() : data_(nullptr), size_(0), mapped_(false), open_(false)
+{
+}
+
+Aoki::Mapped_File::Mapped_File(const char* path) : data_(nullptr), size_(0), mapped_(false), open_(false)
+{
+	open(path);
+}
+
+Aoki::Mapped_File::~Mapped_File()
+{
+	close();
+}
+
+//打开与关闭
+bool Aoki::Mapped_File::open(const char* path)
+{
+	close();
+#if !defined(_WIN32)
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+	struct stat st = {};
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+	{
+		void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p != MAP_FAILED)
+		{
+			madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+			data_ = static_cast<char*>(p);
+			size_ = (size_type)st.st_size;
+			mapped_ = open_ = true;
+			::close(fd);
+			return true;
+		}
+	}
+	//无法映射时一次性读入堆内存(容量按两倍增长)
+	size_type capacity = st.st_size > 0 ? (size_type)st.st_size : 65536;
+	data_ = new char[capacity];
+	while (true)
+	{
+		if (size_ == capacity)
+		{
+			char* tmp = new char[capacity * 2];
+			std::memcpy(tmp, data_, size_);
+			delete[] data_;
+			data_ = tmp;
+			capacity *= 2;
+		}
+		ssize_t n = ::read(fd, data_ + size_, capacity - size_);
+		if (n < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (n < 0)
+		{
+			//读取出错时不能当作已读完，释放缓冲区并返回失败
+			delete[] data_;
+			data_ = nullptr;
+			size_ = 0;
+			::close(fd);
+			return false;
+		}
+		if (n == 0)
+		{
+			break;
+		}
+		size_ += (size_type)n;
+	}
+	::close(fd);
+#else
+	FILE* file = std::fopen(path, "rb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+	size_type capacity = 65536;
+	data_ = new char[capacity];
+	while (true)
+	{
+		if (size_ == capacity)
+		{
+			char* tmp = new char[capacity * 2];
+			std::memcpy(tmp, data_, size_);
+			delete[] data_;
+			data_ = tmp;
+			capacity *= 2;
+		}
+		size_type n = std::fread(data_ + size_, 1, capacity - size_, file);
+		if (n == 0)
+		{
+			break;
+		}
+		size_ += n;
+	}
+	bool failed = std::ferror(file) != 0;
+	std::fclose(file);
+	if (failed)
+	{
+		delete[] data_;
+		data_ = nullptr;
+		size_ = 0;
+		return false;
+	}
+#endif
+	mapped_ = false;
+	open_ = true;
+	return true;
+}
+
+void Aoki::Mapped_File::close()
+{
+	if (!open_)
+	{
+		return;
+	}
+#if !defined(_WIN32)
+	if (mapped_)
+	{
+		munmap(data_, size_);
+	}
+	else
+	{
+		delete[] data_;
+	}
+#else
+	delete[] data_;
+#endif
+	data_ = nullptr;
+	size_ = 0;
+	mapped_ = open_ = false;
+}
+
+bool Aoki::Mapped_File::is_open() const
+{
+	return open_;
+}
+
+bool Aoki::Mapped_File::is_mapped() const
+{
+	return mapped_;
+}
+
+//访问
+const char* Aoki::Mapped_File::data() const
+{
+	return data_;
+}
+
+Aoki::Mapped_File::size_type Aoki::Mapped_File::size() const
+{
+	return size_;
+}
+
+Aoki::Line_Splitter Aoki::Mapped_File::lines() const
+{
+	return Line_Splitter(data_, data_ + size_);
+}
+
+std::vector<Aoki::Line_View> Aoki::Mapped_File::split(size_type parts) const
+{
+	std::vector<Line_View> chunks;
+	if (size_ == 0)
+	{
+		return chunks;
+	}
+	parts = parts == 0 ? 1 : parts;
+	const char* first = data_;
+	const char* last = data_ + size_;
+	for (size_type i = 1; i <= parts && first != last; ++i)
+	{
+		//先按字节数等分，再把分界点向后移到下一个换行符之后
+		const char* cut = i == parts ? last : data_ + size_ / parts * i;
+		if (cut < first)
+		{
+			cut = first;
+		}
+		if (cut != last)
+		{
+			auto pos = static_cast<const char*>(std::memchr(cut, '\n', static_cast<size_type>(last - cut)));
+			cut = pos == nullptr ? last : pos + 1;
+		}
+		if (cut != first)
+		{
+			chunks.emplace_back(first, static_cast<size_type>(cut - first));
+			first = cut;
+		}
+	}
+	return chunks;
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <cstring>
+#include <cstddef>
+
+#include "../String/String.h"
+
+namespace Aoki
+{
+	/**
+	 * @brief Line_View Class
+	 * @details 指向一段已存在字符的只读视图(不以 '\0' 结尾，不拥有内存)，复制视图不会复制字符。
+	 *          需要独立保存时调用 to_string() 显式复制为 Aoki::String 。
+	 */
+	class Line_View
+	{
+	public:
+		//配套类型
+		typedef std::size_t size_type;
+		typedef const char* const_iterator;
+
+	public:
+		Line_View() : data_(nullptr), size_(0)
+		{
+		}
+
+		Line_View(const char* data, size_type size) : data_(data), size_(size)
+		{
+		}
+
+		const char* data() const
+		{
+			return data_;
+		}
+
+		size_type size() const
+		{
+			return size_;
+		}
+
+		bool empty() const
+		{
+			return size_ == 0;
+		}
+
+		char operator[](size_type pos) const
+		{
+			return data_[pos];
+		}
+
+		const_iterator begin() const
+		{
+			return data_;
+		}
+
+		const_iterator end() const
+		{
+			return data_ + size_;
+		}
+
+		String to_string() const
+		{
+			return String(data_ == nullptr ? "" : data_, size_);
+		}
+
+		bool operator==(const char* s) const
+		{
+			return std::strlen(s) == size_ && std::memcmp(data_, s, size_) == 0;
+		}
+
+	private:
+		//成员变量
+		const char* data_;
+		size_type size_;
+	};
+
+	/**
+	 * @brief Line_Splitter Class
+	 * @details 在 [first, last) 中按 '\n' 逐行切分(用 memchr 查找)，得到的每一行都是 Line_View ，不复制字符。
+	 *          行尾的 "\r" 会被去掉，最后一行可以没有换行符。
+	 */
+	class Line_Splitter
+	{
+	public:
+		Line_Splitter(const char* first, const char* last) : cur_(first), last_(last)
+		{
+		}
+
+		//读取下一行，没有剩余的行时返回 false
+		bool next(Line_View& line)
+		{
+			if (cur_ == last_)
+			{
+				return false;
+			}
+			auto pos = static_cast<const char*>(std::memchr(cur_, '\n', static_cast<std::size_t>(last_ - cur_)));
+			const char* end = pos == nullptr ? last_ : pos;
+			std::size_t size = static_cast<std::size_t>(end - cur_);
+			if (size > 0 && end[-1] == '\r')
+			{
+				--size;
+			}
+			line = Line_View(cur_, size);
+			cur_ = pos == nullptr ? last_ : pos + 1;
+			return true;
+		}
+
+	private:
+		//成员变量
+		const char* cur_;
+		const char* last_;
+	};
+
+	/**
+	 * @brief Mapped_File Class
+	 * @details 只读文件映射：POSIX 系统上用 mmap 把整个文件映射到内存，并以 madvise(MADV_SEQUENTIAL) 提示内核按顺序预读；
+	 *          映射失败(如管道、空文件)或不支持 mmap 的平台退化为一次性读入堆内存。
+	 *          文件内容通过 data()/size() 直接访问，按行读取时得到的是指向映射区域的 Line_View ，不复制字符。
+	 * @note 文件关闭后所有 Line_View 失效。
+	 */
+	class Mapped_File
+	{
+	public:
+		//配套类型
+		typedef std::size_t size_type;
+
+	public:
+		//构造函数和析构函数
+		Mapped_File();
+
+		explicit Mapped_File(const char* path);
+
+		Mapped_File(const Mapped_File& other) = delete;
+
+		~Mapped_File();
+
+		//重载赋值运算符
+		Mapped_File& operator=(const Mapped_File& other) = delete;
+
+		//打开与关闭
+		bool open(const char* path);
+
+		void close();
+
+		bool is_open() const;
+
+		//是否为内存映射(为 false 时内容是读入堆内存的副本)
+		bool is_mapped() const;
+
+		//访问
+		const char* data() const;
+
+		size_type size() const;
+
+		//按行切分整个文件
+		Line_Splitter lines() const;
+
+		//把文件切分为至多 parts 段，每段(除最后一段外)都以 '\n' 结尾，不会把一行拆到两段中
+		std::vector<Line_View> split(size_type parts) const;
+
+		/**
+		 * @brief for_each_line
+		 * @param threads: 线程数(为 0 时使用硬件线程数)。
+		 * @param func: 对每一行调用 func(worker, line)，worker 为线程编号，同一线程内按文件顺序调用。
+		 * @details 按换行符对齐切分文件后，每个线程处理一段。各线程只读共享的映射区域，func 中的累加应写入各自 worker 的位置。
+		 * @return 实际使用的线程数。
+		 */
+		template<typename Func>
+		size_type for_each_line(size_type threads, Func func) const;
+
+	private:
+		//成员变量
+		char* data_;
+		size_type size_;
+		bool mapped_;
+		bool open_;
+	};
+
+	template<typename Func>
+	Mapped_File::size_type Mapped_File::for_each_line(size_type threads, Func func) const
+	{
+		if (threads == 0)
+		{
+			threads = std::thread::hardware_concurrency() == 0 ? 1 : std::thread::hardware_concurrency();
+		}
+		std::vector<Line_View> chunks = split(threads);
+		auto work = [&func, &chunks](size_type worker)
+		{
+			Line_Splitter splitter(chunks[worker].begin(), chunks[worker].end());
+			Line_View line;
+			while (splitter.next(line))
+			{
+				func(worker, line);
+			}
+		};
+		//当前线程处理第一段，其余各段交给新线程
+		std::vector<std::thread> workers;
+		for (size_type i = 1; i < chunks.size(); ++i)
+		{
+			workers.emplace_back(work, i);
+		}
+		if (!chunks.empty())
+		{
+			work(0);
+		}
+		for (auto& t: workers)
+		{
+			t.join();
+		}
+		return chunks.size();
+	}
+}
\ No newline at end of file
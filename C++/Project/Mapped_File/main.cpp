@@ -0,0 +1,167 @@
+#include "Mapped_File.h"
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using std::printf;
+
+void Test_Mapped_File_01()
+{
+	printf("******************************01******************************\n");
+
+	const char* path = "Mapped_File_Test.txt";
+	{
+		std::ofstream out(path, std::ios::binary);
+		out << "Killua\r\nAoki\n\nGon Freecss\nlast";
+	}
+
+	Aoki::Mapped_File file(path);
+	assert(file.is_open() && file.size() == 30);
+	std::cout << "mapped = " << std::boolalpha << file.is_mapped() << std::endl;
+
+	const char* expect[] = { "Killua", "Aoki", "", "Gon Freecss", "last" };
+	Aoki::Line_Splitter splitter = file.lines();
+	Aoki::Line_View line;
+	size_t index = 0;
+	while (splitter.next(line))
+	{
+		assert(line == expect[index]);
+		//显式复制为 Aoki::String
+		Aoki::String copy = line.to_string();
+		std::cout << "[" << copy << "] ";
+		++index;
+	}
+	std::cout << std::endl;
+	assert(index == 5);
+
+	//任意段数的切分都按行对齐，且拼接后与原文件相同
+	for (size_t parts = 1; parts <= 40; ++parts)
+	{
+		std::vector<Aoki::Line_View> chunks = file.split(parts);
+		assert(!chunks.empty() && chunks.size() <= parts);
+		const char* cur = file.data();
+		for (size_t i = 0; i < chunks.size(); ++i)
+		{
+			assert(chunks[i].data() == cur && !chunks[i].empty());
+			assert(i + 1 == chunks.size() || chunks[i][chunks[i].size() - 1] == '\n');
+			cur += chunks[i].size();
+		}
+		assert(cur == file.data() + file.size());
+	}
+
+	file.close();
+	assert(!file.is_open() && !file.open("Not_Exist.txt"));
+	//目录可以打开但读取出错，不能当作空文件
+	assert(!file.open(".") && !file.is_open() && file.data() == nullptr && file.size() == 0);
+	std::remove(path);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+//获取自 begin 起经过的时间(单位：秒)
+double Elapsed_Bench(std::chrono::steady_clock::time_point begin)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void Test_Mapped_File_02()
+{
+	printf("******************************02******************************\n");
+
+	//生成约"400MB"的文本文件，统计行数与字节数，吞吐量单位：GB/s (文件已在页缓存中)
+	const char* path = "Mapped_File_Bench.txt";
+	{
+		std::ofstream out(path, std::ios::binary);
+		std::string line;
+		unsigned int seed = 42;
+		for (int i = 0; i < 8000000; ++i)
+		{
+			seed = seed * 1103515245u + 12345u;
+			line.assign(8 + (seed >> 16) % 90, (char)('a' + i % 26));
+			out << line << '\n';
+		}
+	}
+
+	printf("%-28s%-12s%-12s%-14s%s\n", "Reader", "Time(s)", "GB/s", "Lines", "Bytes");
+	auto report = [](const char* name, double seconds, size_t total, size_t lines, size_t bytes)
+	{
+		printf("%-28s%-12.3lf%-12.2lf%-14zu%zu\n", name, seconds, (double)total / seconds / 1e9, lines, bytes);
+	};
+
+	size_t total = 0;
+	{
+		std::ifstream in(path, std::ios::binary);
+		Aoki::String line;
+		size_t lines = 0, bytes = 0;
+		auto begin = std::chrono::steady_clock::now();
+		while (Aoki::getline(in, line))
+		{
+			++lines;
+			bytes += line.size();
+		}
+		total = bytes + lines;
+		report("Aoki::getline", Elapsed_Bench(begin), total, lines, bytes);
+	}
+	{
+		std::ifstream in(path, std::ios::binary);
+		Aoki::Line_Reader reader(in);
+		size_t bytes = 0;
+		auto begin = std::chrono::steady_clock::now();
+		while (reader.next())
+		{
+			bytes += reader.line().size();
+		}
+		report("Aoki::Line_Reader", Elapsed_Bench(begin), total, reader.count(), bytes);
+	}
+	{
+		auto begin = std::chrono::steady_clock::now();
+		Aoki::Mapped_File file(path);
+		Aoki::Line_Splitter splitter = file.lines();
+		Aoki::Line_View line;
+		size_t lines = 0, bytes = 0;
+		while (splitter.next(line))
+		{
+			++lines;
+			bytes += line.size();
+		}
+		report("Aoki::Mapped_File", Elapsed_Bench(begin), total, lines, bytes);
+	}
+	for (size_t threads: { (size_t)2, (size_t)4, (size_t)std::thread::hardware_concurrency() })
+	{
+		auto begin = std::chrono::steady_clock::now();
+		Aoki::Mapped_File file(path);
+		//每个线程的计数放在不同的缓存行上，避免伪共享
+		struct alignas(64) Counter
+		{
+			size_t lines = 0;
+			size_t bytes = 0;
+		};
+		std::vector<Counter> counters(threads == 0 ? 1 : threads);
+		size_t used = file.for_each_line(threads, [&counters](size_t worker, const Aoki::Line_View& line)
+		{
+			++counters[worker].lines;
+			counters[worker].bytes += line.size();
+		});
+		size_t lines = 0, bytes = 0;
+		for (const Counter& c: counters)
+		{
+			lines += c.lines;
+			bytes += c.bytes;
+		}
+		char name[64];
+		std::snprintf(name, sizeof(name), "Aoki::Mapped_File x%zu", used);
+		report(name, Elapsed_Bench(begin), total, lines, bytes);
+	}
+	std::remove(path);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_Mapped_File_01();
+	Test_Mapped_File_02();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <utility>
+
+namespace Aoki
+{
+	/**
+	 * @brief Node_Pool Class
+	 * @tparam T: 节点类型。
+	 * @tparam SlabCount: 每次向系统申请的大块内存中所含的节点个数。
+	 * @details 定长节点内存池：一次申请可容纳 SlabCount 个节点的大块内存并逐个切分，释放的节点挂入空闲链表以供复用，
+	 *          全部大块内存在内存池析构时统一释放。只负责内存的申请与释放，节点的构造与析构由使用者完成。
+	 */
+	template<typename T, std::size_t SlabCount = 1024>
+	class Node_Pool
+	{
+		typedef Node_Pool<T, SlabCount> this_type;
+
+	public:
+		//配套类型
+		typedef T value_type;
+		typedef std::size_t size_type;
+
+	public:
+		//构造函数和析构函数
+		Node_Pool();
+
+		Node_Pool(const this_type& other) = delete;
+
+		~Node_Pool();
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other) = delete;
+
+		//申请与释放
+		void* allocate();
+
+		void deallocate(void* p);
+
+		//容量
+		size_type used() const;
+
+		size_type slabs() const;
+
+		//修改器
+		void swap(this_type& other);
+
+	private:
+		//空闲节点(与节点共用同一块内存)
+		union Block
+		{
+			Block* pNext_;
+			alignas(T) unsigned char data_[sizeof(T)];
+		};
+
+		//大块内存
+		struct Slab
+		{
+			Slab* pNext_;
+			Block blocks_[SlabCount];
+		};
+
+	private:
+		//成员变量
+		Slab* pSlabs_;
+		Block* pFree_;
+		Block* pCursor_;
+		Block* pLimit_;
+		size_type used_;
+		size_type slabs_;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	// Node_Pool Class 实现
+	///////////////////////////////////////////////////////////////////////
+
+	//构造函数和析构函数
+	template<typename T, std::size_t SlabCount>
+	Node_Pool<T, SlabCount>::Node_Pool()
+			: pSlabs_(nullptr), pFree_(nullptr), pCursor_(nullptr), pLimit_(nullptr), used_(0), slabs_(0)
+	{
+	}
+
+	template<typename T, std::size_t SlabCount>
+	Node_Pool<T, SlabCount>::~Node_Pool()
+	{
+		while (pSlabs_ != nullptr)
+		{
+			Slab* pNext = pSlabs_->pNext_;
+			::operator delete(pSlabs_);
+			pSlabs_ = pNext;
+		}
+	}
+
+	//申请与释放
+	template<typename T, std::size_t SlabCount>
+	void* Node_Pool<T, SlabCount>::allocate()
+	{
+		++used_;
+		if (pFree_ != nullptr)
+		{
+			Block* pBlock = pFree_;
+			pFree_ = pBlock->pNext_;
+			return pBlock;
+		}
+		if (pCursor_ == pLimit_)
+		{
+			Slab* pSlab = static_cast<Slab*>(::operator new(sizeof(Slab)));
+			pSlab->pNext_ = pSlabs_;
+			pSlabs_ = pSlab;
+			pCursor_ = pSlab->blocks_;
+			pLimit_ = pSlab->blocks_ + SlabCount;
+			++slabs_;
+		}
+		return pCursor_++;
+	}
+
+	template<typename T, std::size_t SlabCount>
+	void Node_Pool<T, SlabCount>::deallocate(void* p)
+	{
+		if (p == nullptr)
+		{
+			return;
+		}
+		Block* pBlock = static_cast<Block*>(p);
+		pBlock->pNext_ = pFree_;
+		pFree_ = pBlock;
+		--used_;
+	}
+
+	//容量
+	template<typename T, std::size_t SlabCount>
+	typename Node_Pool<T, SlabCount>::size_type Node_Pool<T, SlabCount>::used() const
+	{
+		return used_;
+	}
+
+	template<typename T, std::size_t SlabCount>
+	typename Node_Pool<T, SlabCount>::size_type Node_Pool<T, SlabCount>::slabs() const
+	{
+		return slabs_;
+	}
+
+	//修改器
+	template<typename T, std::size_t SlabCount>
+	void Node_Pool<T, SlabCount>::swap(this_type& other)
+	{
+		std::swap(pSlabs_, other.pSlabs_);
+		std::swap(pFree_, other.pFree_);
+		std::swap(pCursor_, other.pCursor_);
+		std::swap(pLimit_, other.pLimit_);
+		std::swap(used_, other.used_);
+		std::swap(slabs_, other.slabs_);
+	}
+}
\ No newline at end of file
@@ -283,10 +283,7 @@ void Aoki::String::reserve(size_type new_cap)
 	if (new_cap > capacity_)
 	{
 		auto tmp = new char[new_cap + 1];
-		for (size_type i = 0; i < size_; ++i)
-		{
-			tmp[i] = str_[i];
-		}
+		std::memcpy(tmp, str_, size_);
 		delete[] str_;
 		str_ = tmp;
 		str_[size_] = '\0';
@@ -328,7 +325,7 @@ Aoki::String& Aoki::String::insert(size_type index, size_type count, char ch)
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
+		reserve(recommend(size_ + count));
 	}
 	for (size_type i = size_; i > index; --i)
 	{
@@ -350,7 +347,7 @@ Aoki::String& Aoki::String::insert(size_type index, const char* s)
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
+		reserve(recommend(size_ + count));
 	}
 	for (size_type i = size_; i > index; --i)
 	{
@@ -371,7 +368,7 @@ Aoki::String& Aoki::String::insert(size_type index, const char* s, size_type cou
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
+		reserve(recommend(size_ + count));
 	}
 	for (size_type i = size_; i > index; --i)
 	{
@@ -393,7 +390,7 @@ Aoki::String& Aoki::String::insert(size_type index, const String& str)
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
+		reserve(recommend(size_ + count));
 	}
 	for (size_type i = size_; i > index; --i)
 	{
@@ -417,7 +414,7 @@ Aoki::String& Aoki::String::insert(size_type index, const String& str, size_type
 	assert(size_ + count_ <= max_size());
 	if (size_ + count_ > capacity_)
 	{
-		reserve(size_ + count_);
+		reserve(recommend(size_ + count_));
 	}
 	for (size_type i = size_; i > index; --i)
 	{
@@ -503,7 +500,7 @@ Aoki::String& Aoki::String::append(size_type count, char ch)
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
+		reserve(recommend(size_ + count));
 	}
 	while (count--)
 	{
@@ -515,15 +512,15 @@ Aoki::String& Aoki::String::append(size_type count, char ch)
 
 Aoki::String& Aoki::String::append(const String& str)
 {
-	assert(size_ + str.size_ <= max_size());
-	if (size_ + str.size_ > capacity_)
-	{
-		reserve(size_ + str.size_);
-	}
-	for (size_type i = 0; i < str.size_; ++i)
+	//先记下长度并在扩容后再取"str.str_"，使追加自身时读取的是新缓冲区
+	auto count = str.size_;
+	assert(size_ + count <= max_size());
+	if (size_ + count > capacity_)
 	{
-		str_[size_++] = str[i];
+		reserve(recommend(size_ + count));
 	}
+	std::memcpy(str_ + size_, str.str_, count);
+	size_ += count;
 	str_[size_] = '\0';
 	return *this;
 }
@@ -533,17 +530,15 @@ Aoki::String& Aoki::String::append(const String& str, size_type pos, size_type c
 	assert(pos <= str.size_);
 	if (count == npos || pos + count > str.size_)
 	{
-		count = str.size_;
+		count = str.size_ - pos;
 	}
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
-	}
-	while (count--)
-	{
-		str_[size_++] = str[pos++];
+		reserve(recommend(size_ + count));
 	}
+	std::memcpy(str_ + size_, str.str_ + pos, count);
+	size_ += count;
 	str_[size_] = '\0';
 	return *this;
 }
@@ -553,12 +548,10 @@ Aoki::String& Aoki::String::append(const char* s, size_type count)
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
-	}
-	while (count--)
-	{
-		str_[size_++] = *s++;
+		reserve(recommend(size_ + count));
 	}
+	std::memcpy(str_ + size_, s, count);
+	size_ += count;
 	str_[size_] = '\0';
 	return *this;
 }
@@ -569,12 +562,10 @@ Aoki::String& Aoki::String::append(const char* s)
 	assert(size_ + count <= max_size());
 	if (size_ + count > capacity_)
 	{
-		reserve(size_ + count);
-	}
-	while (count--)
-	{
-		str_[size_++] = *s++;
+		reserve(recommend(size_ + count));
 	}
+	std::memcpy(str_ + size_, s, count);
+	size_ += count;
 	str_[size_] = '\0';
 	return *this;
 }
@@ -892,6 +883,12 @@ Aoki::String::size_type Aoki::String::find(char ch, size_type pos) const
 }
 
 //帮手函数
+Aoki::String::size_type Aoki::String::recommend(size_type new_size) const
+{
+	size_type doubled = capacity_ < max_size() / 2 ? capacity_ * 2 : max_size();
+	return new_size > doubled ? new_size : doubled;
+}
+
 Aoki::String::const_iterator
 Aoki::String::search(const_iterator first1, const_iterator last1, const_iterator first2, const_iterator last2) const
 {
@@ -1085,41 +1082,166 @@ void Aoki::swap(Aoki::String& lhs, Aoki::String& rhs)
 std::istream& Aoki::operator>>(std::istream& is, Aoki::String& str)
 {
 	str.clear();
-	char ch;
-	do
+	//sentry 负责跳过开头的空白字符
+	std::istream::sentry sentry(is);
+	if (!sentry)
 	{
-		ch = is.get();
-		if (ch == ' ' || ch == '\n')
-			break;
-		str.push_back(ch);
-	} while (true);
+		return is;
+	}
+	std::streambuf* sb = is.rdbuf();
+	char chunk[256];
+	Aoki::String::size_type count = 0;
+	int ch = sb->sgetc();
+	//先攒满一小块再整段追加，而不是逐个字符 push_back
+	while (ch != EOF && !std::isspace(ch))
+	{
+		chunk[count++] = (char)ch;
+		if (count == sizeof(chunk))
+		{
+			str.append(chunk, count);
+			count = 0;
+		}
+		ch = sb->snextc();
+	}
+	str.append(chunk, count);
+	if (ch == EOF)
+	{
+		is.setstate(str.empty() ? std::ios_base::eofbit | std::ios_base::failbit : std::ios_base::eofbit);
+	}
 	return is;
 }
 
 std::ostream& Aoki::operator<<(std::ostream& os, const Aoki::String& str)
 {
-	for (Aoki::String::size_type i = 0; i < str.size(); ++i)
-	{
-		os << str[i];
-	}
+	os.write(str.data(), (std::streamsize)str.size());
 	return os;
 }
 
 std::istream& Aoki::getline(std::istream& input, Aoki::String& str, char delim)
 {
 	str.clear();
-	char ch;
-	do
+	bool extracted = false;
+	while (true)
 	{
-		ch = input.get();
-		if (ch == delim)
+		//保证至少有一段空闲空间，istream::getline 直接把字符写入内部数组(由流缓冲区成块查找分隔符)
+		if (str.capacity_ - str.size_ < 128)
+		{
+			str.reserve(str.recommend(str.size_ + 128));
+		}
+		Aoki::String::size_type room = str.capacity_ - str.size_;
+		input.getline(str.str_ + str.size_, (std::streamsize)room + 1, delim);
+		auto count = (Aoki::String::size_type)input.gcount();
+		extracted = extracted || count > 0;
+		if (input.rdstate() == std::ios_base::goodbit)
+		{
+			//读到分隔符(已被取出但不写入)
+			str.size_ += count - 1;
+			break;
+		}
+		str.size_ += count;
+		if (input.eof())
+		{
+			//读到输入末尾：若本次调用已读出字符，则只保留"eofbit"
+			if (extracted)
+			{
+				input.clear(std::ios_base::eofbit);
+			}
 			break;
-		str.push_back(ch);
-	} while (true);
+		}
+		if (input.bad() || count != room)
+		{
+			break;
+		}
+		//空间用尽但仍未遇到分隔符，扩容后继续读取
+		input.clear();
+	}
+	str.str_[str.size_] = '\0';
 	return input;
 }
 
 std::istream& Aoki::getline(std::istream& input, Aoki::String& str)
 {
 	return Aoki::getline(input, str, '\n');
+}
+
+//构造函数和析构函数
+Aoki::Line_Reader::Line_Reader(std::istream& input, char delim, size_type chunk)
+		: input_(input), delim_(delim), buffer_(new char[chunk == 0 ? 1 : chunk]), chunk_(chunk == 0 ? 1 : chunk),
+		  begin_(0), end_(0), count_(0), eof_(false), line_()
+{
+}
+
+Aoki::Line_Reader::~Line_Reader()
+{
+	delete[] buffer_;
+}
+
+//读取
+bool Aoki::Line_Reader::next()
+{
+	line_.clear();
+	bool any = false;
+	while (true)
+	{
+		if (begin_ == end_ && !refill())
+		{
+			//最后一行没有分隔符
+			if (any)
+			{
+				++count_;
+			}
+			return any;
+		}
+		any = true;
+		const char* first = buffer_ + begin_;
+		auto pos = (const char*)std::memchr(first, delim_, end_ - begin_);
+		if (pos != nullptr)
+		{
+			line_.append(first, (size_type)(pos - first));
+			begin_ += (size_type)(pos - first) + 1;
+			++count_;
+			return true;
+		}
+		//本块中没有分隔符，整块追加后读取下一块
+		line_.append(first, end_ - begin_);
+		begin_ = end_;
+	}
+}
+
+bool Aoki::Line_Reader::next(String& line)
+{
+	if (!next())
+	{
+		return false;
+	}
+	line.assign(line_.data(), line_.size());
+	return true;
+}
+
+const Aoki::String& Aoki::Line_Reader::line() const
+{
+	return line_;
+}
+
+Aoki::Line_Reader::size_type Aoki::Line_Reader::count() const
+{
+	return count_;
+}
+
+//帮手函数
+bool Aoki::Line_Reader::refill()
+{
+	if (eof_)
+	{
+		return false;
+	}
+	std::streamsize n = input_.rdbuf()->sgetn(buffer_, (std::streamsize)chunk_);
+	begin_ = 0;
+	end_ = n > 0 ? (size_type)n : 0;
+	if (n <= 0)
+	{
+		eof_ = true;
+		input_.setstate(std::ios_base::eofbit);
+	}
+	return end_ > 0;
 }
\ No newline at end of file
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <iostream>
-#include <cstring>          //使用"strlen"函数。
+#include <cstring>          //使用"strlen"、"memcpy"与"memchr"函数。
+#include <cctype>           //使用"isspace"函数。
 #include <cassert>          //以断言宏检查错误(替代异常)。
 
 namespace Aoki
@@ -212,6 +213,17 @@ namespace Aoki
 		const_iterator
 		search(const_iterator first1, const_iterator last1, const_iterator first2, const_iterator last2) const;
 
+		/**
+		 * @brief recommend
+		 * @details 追加元素时计算新容量：至少为 new_size ，且不小于当前容量的两倍，使连续追加的均摊时间复杂度为 O(1)。
+		 */
+		size_type recommend(size_type new_size) const;
+
+		//流输入直接写入内部数组
+		friend std::istream& operator>>(std::istream& is, String& str);
+
+		friend std::istream& getline(std::istream& input, String& str, char delim);
+
 	private:
 		//成员变量
 		char* str_;
@@ -276,4 +288,56 @@ namespace Aoki
 	std::istream& getline(std::istream& input, String& str, char delim);
 
 	std::istream& getline(std::istream& input, String& str);
+
+	/**
+	 * @brief Line_Reader Class
+	 * @details 按行读取输入流：每次用 sgetn 从流缓冲区读取一大块数据，用 memchr 查找分隔符，整段追加到行中。
+	 *          读出的行保存在同一个 String 中，其容量在多次调用之间复用，读取大文件时几乎不再申请内存。
+	 * @note Line_Reader 会预先读取流中的数据，使用期间不应再直接从该流读取。
+	 */
+	class Line_Reader
+	{
+	public:
+		//配套类型
+		typedef String::size_type size_type;
+
+	public:
+		//构造函数和析构函数
+		explicit Line_Reader(std::istream& input, char delim = '\n', size_type chunk = 65536);
+
+		Line_Reader(const Line_Reader& other) = delete;
+
+		~Line_Reader();
+
+		//重载赋值运算符
+		Line_Reader& operator=(const Line_Reader& other) = delete;
+
+		//读取下一行(不含分隔符)，输入结束时返回 false
+		bool next();
+
+		//读取下一行并复制到 line 中
+		bool next(String& line);
+
+		//当前行
+		const String& line() const;
+
+		//已读取的行数
+		size_type count() const;
+
+	private:
+		//帮手函数
+		bool refill();
+
+	private:
+		//成员变量
+		std::istream& input_;
+		char delim_;
+		char* buffer_;
+		size_type chunk_;
+		size_type begin_;
+		size_type end_;
+		size_type count_;
+		bool eof_;
+		String line_;
+	};
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "String.h"
 #include <string>
 #include <cstdio>
+#include <chrono>
+#include <fstream>
+#include <sstream>
 
 using std::printf;
 
@@ -722,6 +725,119 @@ void Test_String_12()
 	printf("*****************************EXIT*****************************\n\n");
 }
 
+void Test_String_13()
+{
+	printf("******************************13******************************\n");
+
+	//getline：空行、超长行(多次扩容)、末尾没有换行符的最后一行
+	std::string longLine(100000, 'x');
+	std::istringstream in("first line\n\n" + longLine + "\nlast");
+	Aoki::String line;
+	assert(Aoki::getline(in, line) && line == "first line");
+	assert(Aoki::getline(in, line) && line.empty());
+	assert(Aoki::getline(in, line) && line.size() == longLine.size() && line == longLine.c_str());
+	assert(Aoki::getline(in, line) && line == "last" && in.eof());
+	assert(!Aoki::getline(in, line) && line.empty());
+
+	//operator>>：跳过空白，按空白分隔
+	std::istringstream words("  Killua\tAoki \n\n Gon");
+	Aoki::String word;
+	words >> word;
+	assert(word == "Killua");
+	words >> word;
+	assert(word == "Aoki");
+	words >> word;
+	assert(word == "Gon" && words.eof() && !words.fail());
+	words >> word;
+	assert(words.fail());
+
+	//operator<<：整段写出
+	std::ostringstream out;
+	out << Aoki::String("Killua") << ' ' << Aoki::String("Aoki");
+	assert(out.str() == "Killua Aoki");
+
+	//Line_Reader：块大小小于行长，行跨越多个块
+	std::istringstream text("alpha\nbeta\n\ngamma delta\nepsilon");
+	Aoki::Line_Reader reader(text, '\n', 4);
+	const char* expect[] = { "alpha", "beta", "", "gamma delta", "epsilon" };
+	size_t index = 0;
+	while (reader.next())
+	{
+		assert(reader.line() == expect[index]);
+		std::cout << "[" << reader.line() << "] ";
+		++index;
+	}
+	std::cout << std::endl;
+	assert(index == 5 && reader.count() == 5 && !reader.next());
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+//获取自 begin 起经过的时间(单位：毫秒)
+double Elapsed_Bench(std::chrono::steady_clock::time_point begin)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void Test_String_14()
+{
+	printf("******************************14******************************\n");
+
+	//生成约"200MB"的文本文件(长度不一的行)，分别逐行读取并统计总字节数，单位：毫秒
+	const char* path = "String_Bench.txt";
+	{
+		std::ofstream out(path, std::ios::binary);
+		std::string line;
+		unsigned int seed = 42;
+		for (int i = 0; i < 4000000; ++i)
+		{
+			seed = seed * 1103515245u + 12345u;
+			line.assign(8 + (seed >> 16) % 90, (char)('a' + i % 26));
+			out << line << '\n';
+		}
+	}
+
+	printf("%-24s%-12s%-12s%s\n", "Reader", "Time(ms)", "Lines", "Bytes");
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::string line;
+		size_t lines = 0, bytes = 0;
+		auto begin = std::chrono::steady_clock::now();
+		while (std::getline(in, line))
+		{
+			++lines;
+			bytes += line.size();
+		}
+		printf("%-24s%-12.1lf%-12zu%zu\n", "std::getline", Elapsed_Bench(begin), lines, bytes);
+	}
+	{
+		std::ifstream in(path, std::ios::binary);
+		Aoki::String line;
+		size_t lines = 0, bytes = 0;
+		auto begin = std::chrono::steady_clock::now();
+		while (Aoki::getline(in, line))
+		{
+			++lines;
+			bytes += line.size();
+		}
+		printf("%-24s%-12.1lf%-12zu%zu\n", "Aoki::getline", Elapsed_Bench(begin), lines, bytes);
+	}
+	{
+		std::ifstream in(path, std::ios::binary);
+		Aoki::Line_Reader reader(in);
+		size_t bytes = 0;
+		auto begin = std::chrono::steady_clock::now();
+		while (reader.next())
+		{
+			bytes += reader.line().size();
+		}
+		printf("%-24s%-12.1lf%-12zu%zu\n", "Aoki::Line_Reader", Elapsed_Bench(begin), reader.count(), bytes);
+	}
+	std::remove(path);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
 int main()
 {
 	Test_String_01();
@@ -736,5 +852,7 @@ int main()
 	Test_String_10();
 	Test_String_11();
 	Test_String_12();
+	Test_String_13();
+	Test_String_14();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,807 @@
+#pragma once
+
+#include <new>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+//判断是否支持"SSE2"指令集
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HASH_TABLE_SSE2 1
+#else
+#define HASH_TABLE_SSE2 0
+#endif
+
+namespace Aoki
+{
+	//控制字节：空槽位为 CTRL_EMPTY ，墓碑为 CTRL_DELETED ，已占用的槽位保存哈希值的低 7 位(最高位为 0 )
+	enum : std::int8_t
+	{
+		CTRL_EMPTY = -128,
+		CTRL_DELETED = -2
+	};
+
+	//每组控制字节的个数
+	constexpr std::size_t HASH_GROUP_WIDTH = 16;
+
+	/**
+	 * @brief Hash_Group Class
+	 * @details 一组(16 个)连续的控制字节，支持 SSE2 时一条比较指令即可得到整组的匹配结果，否则逐字节比较。
+	 *          匹配结果为位掩码，第 i 位为 1 表示第 i 个控制字节满足条件。
+	 */
+	class Hash_Group
+	{
+	public:
+		explicit Hash_Group(const std::int8_t* pCtrl)
+		{
+#if HASH_TABLE_SSE2
+			ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl));
+#else
+			std::memcpy(ctrl_, pCtrl, HASH_GROUP_WIDTH);
+#endif
+		}
+
+		//控制字节等于 h2 的位置
+		std::uint32_t Match(std::int8_t h2) const
+		{
+#if HASH_TABLE_SSE2
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < HASH_GROUP_WIDTH; ++i)
+			{
+				mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+			}
+			return mask;
+#endif
+		}
+
+		//空槽位的位置
+		std::uint32_t Match_Empty() const
+		{
+			return Match(CTRL_EMPTY);
+		}
+
+		//空槽位或墓碑的位置(两者的最高位都为 1 )
+		std::uint32_t Match_Free() const
+		{
+#if HASH_TABLE_SSE2
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < HASH_GROUP_WIDTH; ++i)
+			{
+				mask |= static_cast<std::uint32_t>(ctrl_[i] < 0) << i;
+			}
+			return mask;
+#endif
+		}
+
+	private:
+#if HASH_TABLE_SSE2
+		__m128i ctrl_;
+#else
+		std::int8_t ctrl_[HASH_GROUP_WIDTH];
+#endif
+	};
+
+	//获取掩码中最低位 1 的位置(掩码不为 0 )
+	inline std::size_t Lowest_Bit_Hash(std::uint32_t mask)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+		std::size_t index = 0;
+		while ((mask & 1) == 0)
+		{
+			mask >>= 1;
+			++index;
+		}
+		return index;
+#endif
+	}
+
+	//判断哈希函数与比较器是否都支持异构查找(都定义了 is_transparent )
+	template<typename T, typename = void>
+	struct Is_Transparent : std::false_type
+	{
+	};
+
+	template<typename T>
+	struct Is_Transparent<T, decltype(static_cast<void>(sizeof(typename T::is_transparent)))> : std::true_type
+	{
+	};
+
+	template<typename HashTable>
+	class Hash_Table_Iterator;
+
+	/**
+	 * @brief Hash_Table Class
+	 * @tparam Key: 键类型。
+	 * @tparam Value: 槽位中存放数据的类型。
+	 * @tparam KeyOfValue: 从数据中取出键的函数对象。
+	 * @tparam Hash: 哈希函数。
+	 * @tparam KeyEqual: 键的判等器。
+	 * @details 开放定址哈希表，作为 Unordered_Map 与 Unordered_Set 的底层容器。
+	 *          1. 数据与控制字节分别保存在两个连续数组中，不为每个元素单独申请节点。
+	 *          2. 线性探测：键的起始槽位由哈希值的高位决定，每次取 16 个控制字节与哈希值的低 7 位整组比较，
+	 *             只有控制字节相同的槽位才比较键，遇到含空槽位的组即可结束查找。
+	 *          3. 删除时将后续同一簇中可以前移的元素向前移动(后移删除)，删除后探测长度不会变长。
+	 *             只有当簇跨越数组末尾、需要把开头的元素移到被删除的槽位之后时，改为留下墓碑并停止后移，
+	 *             否则边遍历边删除会再次访问到这个已经访问过的元素；墓碑计入负载，扩容或重新散列时清除。
+	 *          4. 槽位数为 2 的幂，元素个数超过 槽位数 * 最大负载因子 时扩容为两倍并重新插入。
+	 *          5. 控制字节数组末尾额外复制开头的 15 个控制字节，使跨越数组末尾的一组也能一次读取。
+	 */
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	class Hash_Table
+	{
+		typedef Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual> this_type;
+
+		friend class Hash_Table_Iterator<this_type>;
+
+		friend class Hash_Table_Iterator<const this_type>;
+
+	public:
+		//配套类型
+		typedef Key key_type;
+		typedef Value value_type;
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
+		typedef Value& reference;
+		typedef const Value& const_reference;
+		typedef std::size_t size_type;
+		typedef Hash_Table_Iterator<this_type> iterator;
+		typedef Hash_Table_Iterator<const this_type> const_iterator;
+
+	public:
+		//构造函数和析构函数
+		explicit Hash_Table(size_type count = 0, const hasher& hash = hasher(), const key_equal& equal = key_equal());
+
+		Hash_Table(const this_type& other);
+
+		~Hash_Table();
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other);
+
+		//迭代器
+		iterator begin();
+
+		const_iterator begin() const;
+
+		iterator end();
+
+		const_iterator end() const;
+
+		//容量
+		bool empty() const;
+
+		size_type size() const;
+
+		//修改器
+		void clear();
+
+		template<typename V>
+		std::pair<iterator, bool> insert_unique(V&& value);
+
+		iterator erase(const_iterator pos);
+
+		template<typename K>
+		size_type erase_key(const K& key);
+
+		void swap(this_type& other);
+
+		//查找
+		template<typename K>
+		iterator find(const K& key);
+
+		template<typename K>
+		const_iterator find(const K& key) const;
+
+		//哈希策略
+		size_type bucket_count() const;
+
+		float load_factor() const;
+
+		float max_load_factor() const;
+
+		void max_load_factor(float factor);
+
+		void rehash(size_type count);
+
+		void reserve(size_type count);
+
+		//观察器
+		hasher hash_function() const;
+
+		key_equal key_eq() const;
+
+	private:
+		//帮手函数
+		template<typename K>
+		size_type DoHash(const K& key) const;
+
+		template<typename K>
+		size_type DoFind(const K& key, size_type hash) const;
+
+		size_type DoFindEmpty(size_type hash) const;
+
+		void DoSetCtrl(size_type index, std::int8_t ctrl);
+
+		void DoAllocate(size_type capacity);
+
+		void DoDeallocate();
+
+		void DoDestroyAll();
+
+		void DoResize(size_type capacity);
+
+		size_type DoCapacityFor(size_type count) const;
+
+		size_type DoNext(size_type index) const;
+
+		static const key_type& DoKey(const value_type& value);
+
+		static std::int8_t DoH2(size_type hash);
+
+	private:
+		//成员变量
+		std::int8_t* pCtrl_;
+		value_type* pSlots_;
+		size_type capacity_;
+		size_type size_;
+		size_type deleted_;
+		size_type growthLimit_;
+		float maxLoadFactor_;
+		hasher hash_;
+		key_equal equal_;
+	};
+
+	/**
+	 * @brief Hash_Table_Iterator Class
+	 * @tparam HashTable: 哈希表类型(常量迭代器使用 const 限定的哈希表类型)。
+	 * @details 前向迭代器，按槽位顺序移动并跳过空槽位与墓碑。
+	 */
+	template<typename HashTable>
+	class Hash_Table_Iterator
+	{
+		typedef Hash_Table_Iterator<HashTable> this_type;
+
+		typedef typename std::remove_const<HashTable>::type table_type;
+
+		friend table_type;
+
+		friend class Hash_Table_Iterator<const table_type>;
+
+	public:
+		//配套类型
+		typedef typename table_type::value_type value_type;
+		typedef typename std::conditional<std::is_const<HashTable>::value, const value_type&, value_type&>::type reference;
+		typedef typename std::conditional<std::is_const<HashTable>::value, const value_type*, value_type*>::type pointer;
+		typedef std::forward_iterator_tag iterator_category;
+		typedef std::ptrdiff_t difference_type;
+
+	public:
+		Hash_Table_Iterator() : pTable_(nullptr), index_(0)
+		{
+		}
+
+		Hash_Table_Iterator(HashTable* pTable, std::size_t index) : pTable_(pTable), index_(index)
+		{
+		}
+
+		//普通迭代器可以转换为常量迭代器
+		Hash_Table_Iterator(const Hash_Table_Iterator<table_type>& x) : pTable_(x.pTable_), index_(x.index_)
+		{
+		}
+
+		this_type& operator=(const this_type& x) = default;
+
+		reference operator*() const
+		{
+			return pTable_->pSlots_[index_];
+		}
+
+		pointer operator->() const
+		{
+			return pTable_->pSlots_ + index_;
+		}
+
+		this_type& operator++()
+		{
+			index_ = pTable_->DoNext(index_ + 1);
+			return *this;
+		}
+
+		this_type operator++(int)
+		{
+			this_type temp = *this;
+			index_ = pTable_->DoNext(index_ + 1);
+			return temp;
+		}
+
+		bool operator==(const this_type& x) const
+		{
+			return index_ == x.index_;
+		}
+
+		bool operator!=(const this_type& x) const
+		{
+			return index_ != x.index_;
+		}
+
+	private:
+		//成员变量
+		HashTable* pTable_;
+		std::size_t index_;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	// Hash_Table Class 实现
+	///////////////////////////////////////////////////////////////////////
+
+	//构造函数和析构函数
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::Hash_Table(size_type count, const hasher& hash, const key_equal& equal)
+			: pCtrl_(nullptr), pSlots_(nullptr), capacity_(0), size_(0), deleted_(0), growthLimit_(0), maxLoadFactor_(0.875f),
+			  hash_(hash), equal_(equal)
+	{
+		if (count > 0)
+		{
+			reserve(count);
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::Hash_Table(const this_type& other)
+			: pCtrl_(nullptr), pSlots_(nullptr), capacity_(0), size_(0), deleted_(0), growthLimit_(0),
+			  maxLoadFactor_(other.maxLoadFactor_), hash_(other.hash_), equal_(other.equal_)
+	{
+		*this = other;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::~Hash_Table()
+	{
+		DoDestroyAll();
+		DoDeallocate();
+	}
+
+	//重载赋值运算符
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::this_type&
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::operator=(const this_type& other)
+	{
+		if (this != &other)
+		{
+			DoDestroyAll();
+			DoDeallocate();
+			hash_ = other.hash_;
+			equal_ = other.equal_;
+			maxLoadFactor_ = other.maxLoadFactor_;
+			if (other.capacity_ > 0)
+			{
+				//槽位数相同，逐槽位复制即可保持探测序列不变
+				DoAllocate(other.capacity_);
+				for (size_type i = 0; i < capacity_; ++i)
+				{
+					if (other.pCtrl_[i] >= 0)
+					{
+						::new(static_cast<void*>(pSlots_ + i)) value_type(other.pSlots_[i]);
+						DoSetCtrl(i, other.pCtrl_[i]);
+						++size_;
+					}
+					else if (other.pCtrl_[i] == CTRL_DELETED)
+					{
+						DoSetCtrl(i, CTRL_DELETED);
+						++deleted_;
+					}
+				}
+			}
+		}
+		return *this;
+	}
+
+	//迭代器
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::iterator Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::begin()
+	{
+		return iterator(this, DoNext(0));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::const_iterator
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::begin() const
+	{
+		return const_iterator(this, DoNext(0));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::iterator Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::end()
+	{
+		return iterator(this, capacity_);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::const_iterator
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::end() const
+	{
+		return const_iterator(this, capacity_);
+	}
+
+	//容量
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	bool Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::empty() const
+	{
+		return size_ == 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size() const
+	{
+		return size_;
+	}
+
+	//修改器
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::clear()
+	{
+		DoDestroyAll();
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	template<typename V>
+	std::pair<typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::iterator, bool>
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::insert_unique(V&& value)
+	{
+		const key_type& key = KeyOfValue()(value);
+		size_type hash = DoHash(key);
+		size_type index = DoFind(key, hash);
+		if (index != capacity_)
+		{
+			return std::pair<iterator, bool>(iterator(this, index), false);
+		}
+		//墓碑同样占用槽位，过多时以相同或更大的槽位数重新散列
+		if (size_ + deleted_ >= growthLimit_)
+		{
+			DoResize(DoCapacityFor(size_ + 1));
+		}
+		index = DoFindEmpty(hash);
+		if (pCtrl_[index] == CTRL_DELETED)
+		{
+			--deleted_;
+		}
+		::new(static_cast<void*>(pSlots_ + index)) value_type(std::forward<V>(value));
+		DoSetCtrl(index, DoH2(hash));
+		++size_;
+		return std::pair<iterator, bool>(iterator(this, index), true);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::iterator
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::erase(const_iterator pos)
+	{
+		const size_type mask = capacity_ - 1;
+		size_type hole = pos.index_;
+		pSlots_[hole].~value_type();
+		DoSetCtrl(hole, CTRL_EMPTY);
+		--size_;
+		//后移删除：空洞之后同一簇中的元素，若其起始槽位不在 (空洞, 当前位置] 之间，则前移填补空洞
+		for (size_type cur = (hole + 1) & mask; pCtrl_[cur] != CTRL_EMPTY; cur = (cur + 1) & mask)
+		{
+			if (pCtrl_[cur] == CTRL_DELETED)
+			{
+				continue;
+			}
+			size_type home = (DoHash(DoKey(pSlots_[cur])) >> 7) & mask;
+			if (((cur - home) & mask) >= ((cur - hole) & mask))
+			{
+				//开头的元素不能移到 pos 之后(遍历时会再次访问)，留下墓碑使后续元素仍能被找到
+				if (cur < pos.index_ && hole >= pos.index_)
+				{
+					DoSetCtrl(hole, CTRL_DELETED);
+					++deleted_;
+					break;
+				}
+				::new(static_cast<void*>(pSlots_ + hole)) value_type(std::move(pSlots_[cur]));
+				pSlots_[cur].~value_type();
+				DoSetCtrl(hole, pCtrl_[cur]);
+				DoSetCtrl(cur, CTRL_EMPTY);
+				hole = cur;
+			}
+		}
+		//被删除的槽位可能已由后面的元素填补，因此从该槽位开始寻找下一个元素
+		return iterator(this, DoNext(pos.index_));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	template<typename K>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::erase_key(const K& key)
+	{
+		size_type index = DoFind(key, DoHash(key));
+		if (index == capacity_)
+		{
+			return 0;
+		}
+		erase(const_iterator(this, index));
+		return 1;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::swap(this_type& other)
+	{
+		std::swap(pCtrl_, other.pCtrl_);
+		std::swap(pSlots_, other.pSlots_);
+		std::swap(capacity_, other.capacity_);
+		std::swap(size_, other.size_);
+		std::swap(deleted_, other.deleted_);
+		std::swap(growthLimit_, other.growthLimit_);
+		std::swap(maxLoadFactor_, other.maxLoadFactor_);
+		std::swap(hash_, other.hash_);
+		std::swap(equal_, other.equal_);
+	}
+
+	//查找
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	template<typename K>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::iterator
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::find(const K& key)
+	{
+		return iterator(this, DoFind(key, DoHash(key)));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	template<typename K>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::const_iterator
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::find(const K& key) const
+	{
+		return const_iterator(this, DoFind(key, DoHash(key)));
+	}
+
+	//哈希策略
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::bucket_count() const
+	{
+		return capacity_;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	float Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::load_factor() const
+	{
+		return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / static_cast<float>(capacity_);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	float Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::max_load_factor() const
+	{
+		return maxLoadFactor_;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::max_load_factor(float factor)
+	{
+		//至少保留一个空槽位，保证探测能够结束
+		maxLoadFactor_ = factor < 0.125f ? 0.125f : (factor > 0.9375f ? 0.9375f : factor);
+		rehash(0);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::rehash(size_type count)
+	{
+		//槽位数不小于 count ，且能在最大负载因子之内容纳现有元素
+		size_type capacity = DoCapacityFor(size_);
+		while (capacity < count)
+		{
+			capacity <<= 1;
+		}
+		if (capacity != capacity_)
+		{
+			DoResize(capacity);
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::reserve(size_type count)
+	{
+		if (count > growthLimit_)
+		{
+			DoResize(DoCapacityFor(count));
+		}
+	}
+
+	//观察器
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::hasher
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::hash_function() const
+	{
+		return hash_;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::key_equal
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::key_eq() const
+	{
+		return equal_;
+	}
+
+	//帮手函数
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	template<typename K>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoHash(const K& key) const
+	{
+		//std::hash<int> 等哈希函数可能直接返回键本身，乘以黄金分割常数使高位与低位都充分混合
+		std::uint64_t hash = static_cast<std::uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ULL;
+		return static_cast<size_type>(hash ^ (hash >> 32));
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	template<typename K>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoFind(const K& key, size_type hash) const
+	{
+		if (capacity_ == 0)
+		{
+			return capacity_;
+		}
+		const size_type mask = capacity_ - 1;
+		const std::int8_t h2 = DoH2(hash);
+		size_type pos = (hash >> 7) & mask;
+		while (true)
+		{
+			Hash_Group group(pCtrl_ + pos);
+			std::uint32_t match = group.Match(h2);
+			while (match != 0)
+			{
+				size_type index = (pos + Lowest_Bit_Hash(match)) & mask;
+				if (equal_(DoKey(pSlots_[index]), key))
+				{
+					return index;
+				}
+				match &= match - 1;
+			}
+			if (group.Match_Empty() != 0)
+			{
+				return capacity_;
+			}
+			pos = (pos + HASH_GROUP_WIDTH) & mask;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoFindEmpty(size_type hash) const
+	{
+		const size_type mask = capacity_ - 1;
+		size_type pos = (hash >> 7) & mask;
+		while (true)
+		{
+			std::uint32_t empty = Hash_Group(pCtrl_ + pos).Match_Free();
+			if (empty != 0)
+			{
+				return (pos + Lowest_Bit_Hash(empty)) & mask;
+			}
+			pos = (pos + HASH_GROUP_WIDTH) & mask;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoSetCtrl(size_type index, std::int8_t ctrl)
+	{
+		pCtrl_[index] = ctrl;
+		//同步末尾的副本
+		if (index < HASH_GROUP_WIDTH - 1)
+		{
+			pCtrl_[capacity_ + index] = ctrl;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoAllocate(size_type capacity)
+	{
+		pCtrl_ = new std::int8_t[capacity + HASH_GROUP_WIDTH - 1];
+		std::memset(pCtrl_, CTRL_EMPTY, capacity + HASH_GROUP_WIDTH - 1);
+		pSlots_ = static_cast<value_type*>(::operator new(sizeof(value_type) * capacity));
+		capacity_ = capacity;
+		size_ = deleted_ = 0;
+		growthLimit_ = static_cast<size_type>(static_cast<float>(capacity) * maxLoadFactor_);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoDeallocate()
+	{
+		delete[] pCtrl_;
+		::operator delete(pSlots_);
+		pCtrl_ = nullptr;
+		pSlots_ = nullptr;
+		capacity_ = size_ = deleted_ = growthLimit_ = 0;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoDestroyAll()
+	{
+		for (size_type i = 0; i < capacity_ && size_ > 0; ++i)
+		{
+			if (pCtrl_[i] >= 0)
+			{
+				pSlots_[i].~value_type();
+				DoSetCtrl(i, CTRL_EMPTY);
+				--size_;
+			}
+		}
+		//清除剩余的墓碑
+		if (deleted_ > 0)
+		{
+			std::memset(pCtrl_, CTRL_EMPTY, capacity_ + HASH_GROUP_WIDTH - 1);
+			deleted_ = 0;
+		}
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	void Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoResize(size_type capacity)
+	{
+		std::int8_t* pOldCtrl = pCtrl_;
+		value_type* pOldSlots = pSlots_;
+		size_type oldCapacity = capacity_;
+		size_type oldSize = size_;
+		DoAllocate(capacity);
+		for (size_type i = 0; i < oldCapacity; ++i)
+		{
+			if (pOldCtrl[i] >= 0)
+			{
+				//新表中的键互不相同，直接寻找空槽位
+				size_type hash = DoHash(DoKey(pOldSlots[i]));
+				size_type index = DoFindEmpty(hash);
+				::new(static_cast<void*>(pSlots_ + index)) value_type(std::move(pOldSlots[i]));
+				pOldSlots[i].~value_type();
+				DoSetCtrl(index, DoH2(hash));
+			}
+		}
+		size_ = oldSize;
+		delete[] pOldCtrl;
+		::operator delete(pOldSlots);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoCapacityFor(size_type count) const
+	{
+		//槽位数至少为一组，且为 2 的幂
+		size_type capacity = HASH_GROUP_WIDTH;
+		while (static_cast<float>(capacity) * maxLoadFactor_ < static_cast<float>(count))
+		{
+			capacity <<= 1;
+		}
+		return capacity;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::size_type
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoNext(size_type index) const
+	{
+		while (index < capacity_ && pCtrl_[index] < 0)
+		{
+			++index;
+		}
+		return index < capacity_ ? index : capacity_;
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	const typename Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::key_type&
+	Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoKey(const value_type& value)
+	{
+		return KeyOfValue()(value);
+	}
+
+	template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename KeyEqual>
+	std::int8_t Hash_Table<Key, Value, KeyOfValue, Hash, KeyEqual>::DoH2(size_type hash)
+	{
+		return static_cast<std::int8_t>(hash & 0x7F);
+	}
+}
\ No newline at end of file
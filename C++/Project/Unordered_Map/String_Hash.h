@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstring>
+#include <cstdint>
+
+#include "../String/String.h"
+
+namespace Aoki
+{
+	/**
+	 * @brief String_Hash Class
+	 * @details Aoki::String 的哈希函数(FNV-1a)，支持异构查找：String 与 const char* 内容相同时哈希值相同，
+	 *          因此以 String 为键的容器可以直接用 const char* 查找，不必先构造临时的 String 。
+	 */
+	struct String_Hash
+	{
+		typedef void is_transparent;
+
+		std::size_t operator()(const char* str, std::size_t size) const
+		{
+			std::uint64_t hash = 0xCBF29CE484222325ULL;
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				hash ^= static_cast<unsigned char>(str[i]);
+				hash *= 0x100000001B3ULL;
+			}
+			return static_cast<std::size_t>(hash);
+		}
+
+		std::size_t operator()(const String& str) const
+		{
+			return (*this)(str.c_str(), str.size());
+		}
+
+		std::size_t operator()(const char* str) const
+		{
+			return (*this)(str, std::strlen(str));
+		}
+	};
+
+	/**
+	 * @brief String_Equal Class
+	 * @details Aoki::String 的判等器，支持与 const char* 比较(异构查找)。
+	 */
+	struct String_Equal
+	{
+		typedef void is_transparent;
+
+		bool operator()(const String& lhs, const String& rhs) const
+		{
+			return lhs.size() == rhs.size() && std::memcmp(lhs.c_str(), rhs.c_str(), lhs.size()) == 0;
+		}
+
+		bool operator()(const String& lhs, const char* rhs) const
+		{
+			return std::strcmp(lhs.c_str(), rhs) == 0;
+		}
+
+		bool operator()(const char* lhs, const String& rhs) const
+		{
+			return std::strcmp(lhs, rhs.c_str()) == 0;
+		}
+	};
+}
\ No newline at end of file
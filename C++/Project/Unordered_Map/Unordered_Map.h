@@ -0,0 +1,268 @@
+#pragma once
+
+#include <stdexcept>
+
+#include "Hash_Table.h"
+
+namespace Aoki
+{
+	//从 pair 中取出键
+	template<typename Pair>
+	struct Select_First_Hash
+	{
+		const typename Pair::first_type& operator()(const Pair& value) const
+		{
+			return value.first;
+		}
+	};
+
+	/**
+	 * @brief Unordered_Map Class
+	 * @tparam Key: 键类型。
+	 * @tparam T: 值类型。
+	 * @tparam Hash: 哈希函数。
+	 * @tparam KeyEqual: 键的判等器。
+	 * @details 以开放定址哈希表实现的无序映射，键唯一，插入、删除与查找的平均时间复杂度均为 O(1)。
+	 *          哈希函数与判等器都定义了 is_transparent 时，查找、计数与删除可以直接使用与键可比较的其他类型(异构查找)。
+	 * @note 插入可能引起扩容，扩容后所有迭代器、指针与引用失效；删除会移动同一簇中的元素，指向其他元素的迭代器也可能失效。
+	 */
+	template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class Unordered_Map
+	{
+		typedef Unordered_Map<Key, T, Hash, KeyEqual> this_type;
+
+		//仅在支持异构查找时启用模板版本
+		template<typename K>
+		using enable_if_transparent = typename std::enable_if<Is_Transparent<Hash>::value && Is_Transparent<KeyEqual>::value, K>::type;
+
+	public:
+		//配套类型
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef std::pair<const Key, T> value_type;
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
+		typedef Hash_Table<Key, value_type, Select_First_Hash<value_type>, Hash, KeyEqual> base_type;
+		typedef typename base_type::iterator iterator;
+		typedef typename base_type::const_iterator const_iterator;
+		typedef typename base_type::size_type size_type;
+
+	public:
+		//构造函数和析构函数
+		explicit Unordered_Map(size_type count = 0, const hasher& hash = hasher(), const key_equal& equal = key_equal())
+				: table_(count, hash, equal)
+		{
+		}
+
+		template<typename InputIterator>
+		Unordered_Map(InputIterator first, InputIterator last, size_type count = 0) : table_(count)
+		{
+			insert(first, last);
+		}
+
+		Unordered_Map(const this_type& other) = default;
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other) = default;
+
+		//元素访问
+		mapped_type& operator[](const key_type& key)
+		{
+			iterator it = table_.find(key);
+			if (it == end())
+			{
+				it = table_.insert_unique(value_type(key, mapped_type())).first;
+			}
+			return it->second;
+		}
+
+		mapped_type& at(const key_type& key)
+		{
+			iterator it = table_.find(key);
+			if (it == end())
+			{
+				throw std::out_of_range("Unordered_Map::at");
+			}
+			return it->second;
+		}
+
+		const mapped_type& at(const key_type& key) const
+		{
+			const_iterator it = table_.find(key);
+			if (it == end())
+			{
+				throw std::out_of_range("Unordered_Map::at");
+			}
+			return it->second;
+		}
+
+		//迭代器
+		iterator begin()
+		{
+			return table_.begin();
+		}
+
+		const_iterator begin() const
+		{
+			return table_.begin();
+		}
+
+		iterator end()
+		{
+			return table_.end();
+		}
+
+		const_iterator end() const
+		{
+			return table_.end();
+		}
+
+		//容量
+		bool empty() const
+		{
+			return table_.empty();
+		}
+
+		size_type size() const
+		{
+			return table_.size();
+		}
+
+		//修改器
+		void clear()
+		{
+			table_.clear();
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value)
+		{
+			return table_.insert_unique(value);
+		}
+
+		std::pair<iterator, bool> insert(value_type&& value)
+		{
+			return table_.insert_unique(std::move(value));
+		}
+
+		template<typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+			{
+				table_.insert_unique(value_type(*first));
+			}
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			return table_.erase(pos);
+		}
+
+		size_type erase(const key_type& key)
+		{
+			return table_.erase_key(key);
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		size_type erase(const K& key)
+		{
+			return table_.erase_key(key);
+		}
+
+		void swap(this_type& other)
+		{
+			table_.swap(other.table_);
+		}
+
+		//查找
+		iterator find(const key_type& key)
+		{
+			return table_.find(key);
+		}
+
+		const_iterator find(const key_type& key) const
+		{
+			return table_.find(key);
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		iterator find(const K& key)
+		{
+			return table_.find(key);
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		const_iterator find(const K& key) const
+		{
+			return table_.find(key);
+		}
+
+		size_type count(const key_type& key) const
+		{
+			return table_.find(key) == end() ? 0 : 1;
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		size_type count(const K& key) const
+		{
+			return table_.find(key) == end() ? 0 : 1;
+		}
+
+		bool contains(const key_type& key) const
+		{
+			return table_.find(key) != end();
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		bool contains(const K& key) const
+		{
+			return table_.find(key) != end();
+		}
+
+		//哈希策略
+		size_type bucket_count() const
+		{
+			return table_.bucket_count();
+		}
+
+		float load_factor() const
+		{
+			return table_.load_factor();
+		}
+
+		float max_load_factor() const
+		{
+			return table_.max_load_factor();
+		}
+
+		void max_load_factor(float factor)
+		{
+			table_.max_load_factor(factor);
+		}
+
+		void rehash(size_type count)
+		{
+			table_.rehash(count);
+		}
+
+		void reserve(size_type count)
+		{
+			table_.reserve(count);
+		}
+
+		//观察器
+		hasher hash_function() const
+		{
+			return table_.hash_function();
+		}
+
+		key_equal key_eq() const
+		{
+			return table_.key_eq();
+		}
+
+	private:
+		//成员变量
+		base_type table_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "Hash_Table.h"
+
+namespace Aoki
+{
+	//键即为数据本身
+	template<typename T>
+	struct Identity_Hash
+	{
+		const T& operator()(const T& value) const
+		{
+			return value;
+		}
+	};
+
+	/**
+	 * @brief Unordered_Set Class
+	 * @tparam Key: 键类型。
+	 * @tparam Hash: 哈希函数。
+	 * @tparam KeyEqual: 键的判等器。
+	 * @details 以开放定址哈希表实现的无序集合，键唯一，插入、删除与查找的平均时间复杂度均为 O(1)。
+	 *          键不可修改，因此迭代器与常量迭代器相同。
+	 */
+	template<typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class Unordered_Set
+	{
+		typedef Unordered_Set<Key, Hash, KeyEqual> this_type;
+
+		//仅在支持异构查找时启用模板版本
+		template<typename K>
+		using enable_if_transparent = typename std::enable_if<Is_Transparent<Hash>::value && Is_Transparent<KeyEqual>::value, K>::type;
+
+	public:
+		//配套类型
+		typedef Key key_type;
+		typedef Key value_type;
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
+		typedef Hash_Table<Key, Key, Identity_Hash<Key>, Hash, KeyEqual> base_type;
+		typedef typename base_type::const_iterator iterator;
+		typedef typename base_type::const_iterator const_iterator;
+		typedef typename base_type::size_type size_type;
+
+	public:
+		//构造函数和析构函数
+		explicit Unordered_Set(size_type count = 0, const hasher& hash = hasher(), const key_equal& equal = key_equal())
+				: table_(count, hash, equal)
+		{
+		}
+
+		template<typename InputIterator>
+		Unordered_Set(InputIterator first, InputIterator last, size_type count = 0) : table_(count)
+		{
+			insert(first, last);
+		}
+
+		Unordered_Set(const this_type& other) = default;
+
+		//重载赋值运算符
+		this_type& operator=(const this_type& other) = default;
+
+		//迭代器
+		iterator begin() const
+		{
+			return table_.begin();
+		}
+
+		iterator end() const
+		{
+			return table_.end();
+		}
+
+		//容量
+		bool empty() const
+		{
+			return table_.empty();
+		}
+
+		size_type size() const
+		{
+			return table_.size();
+		}
+
+		//修改器
+		void clear()
+		{
+			table_.clear();
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value)
+		{
+			std::pair<typename base_type::iterator, bool> result = table_.insert_unique(value);
+			return std::pair<iterator, bool>(result.first, result.second);
+		}
+
+		template<typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+			{
+				table_.insert_unique(value_type(*first));
+			}
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			return table_.erase(pos);
+		}
+
+		size_type erase(const key_type& key)
+		{
+			return table_.erase_key(key);
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		size_type erase(const K& key)
+		{
+			return table_.erase_key(key);
+		}
+
+		void swap(this_type& other)
+		{
+			table_.swap(other.table_);
+		}
+
+		//查找
+		iterator find(const key_type& key) const
+		{
+			return table_.find(key);
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		iterator find(const K& key) const
+		{
+			return table_.find(key);
+		}
+
+		size_type count(const key_type& key) const
+		{
+			return table_.find(key) == end() ? 0 : 1;
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		size_type count(const K& key) const
+		{
+			return table_.find(key) == end() ? 0 : 1;
+		}
+
+		bool contains(const key_type& key) const
+		{
+			return table_.find(key) != end();
+		}
+
+		template<typename K, typename = enable_if_transparent<K>>
+		bool contains(const K& key) const
+		{
+			return table_.find(key) != end();
+		}
+
+		//哈希策略
+		size_type bucket_count() const
+		{
+			return table_.bucket_count();
+		}
+
+		float load_factor() const
+		{
+			return table_.load_factor();
+		}
+
+		float max_load_factor() const
+		{
+			return table_.max_load_factor();
+		}
+
+		void max_load_factor(float factor)
+		{
+			table_.max_load_factor(factor);
+		}
+
+		void rehash(size_type count)
+		{
+			table_.rehash(count);
+		}
+
+		void reserve(size_type count)
+		{
+			table_.reserve(count);
+		}
+
+	private:
+		//成员变量
+		base_type table_;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,264 @@
+#include "Unordered_Map.h"
+#include "Unordered_Set.h"
+#include "String_Hash.h"
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+
+using std::printf;
+
+void Test_Unordered_Map_01()
+{
+	printf("******************************01******************************\n");
+
+	Aoki::Unordered_Map<std::string, int> m;
+	assert(m.empty() && (m.size() == 0) && m.bucket_count() == 0);
+
+	m["banana"] = 3;
+	m["apple"] = 1;
+	m["cherry"] = 5;
+	m.insert(std::make_pair(std::string("date"), 7));
+	assert(!m.insert(std::make_pair(std::string("apple"), 100)).second);
+	assert(m.size() == 4 && m.at("apple") == 1 && m.count("fig") == 0 && m.contains("date"));
+
+	for (auto& kv: m)
+	{
+		std::cout << kv.first << ":" << kv.second << " ";
+	}
+	std::cout << std::endl;
+
+	assert(m.erase("banana") == 1 && m.erase("banana") == 0 && m.size() == 3);
+
+	Aoki::Unordered_Map<std::string, int> copy(m);
+	copy["apple"] = 2;
+	assert(m["apple"] == 1 && copy["apple"] == 2);
+
+	bool thrown = false;
+	try
+	{
+		m.at("fig");
+	}
+	catch (const std::out_of_range&)
+	{
+		thrown = true;
+	}
+	assert(thrown);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Unordered_Map_02()
+{
+	printf("******************************02******************************\n");
+
+	//随机插入与删除，与 std::unordered_map 对照(小范围的键使删除频繁触发后移)
+	std::mt19937 random(20221019);
+	Aoki::Unordered_Map<int, int> m;
+	std::unordered_map<int, int> ref;
+	for (int round = 0; round < 500000; ++round)
+	{
+		int key = static_cast<int>(random() % 4096);
+		if (random() % 2 == 0)
+		{
+			assert(m.erase(key) == ref.erase(key));
+		}
+		else
+		{
+			m[key] = round;
+			ref[key] = round;
+		}
+	}
+	assert(m.size() == ref.size());
+	size_t visited = 0;
+	for (auto& kv: m)
+	{
+		assert(ref.at(kv.first) == kv.second);
+		++visited;
+	}
+	assert(visited == ref.size());
+
+	//按迭代器删除全部偶数键
+	for (auto it = m.begin(); it != m.end();)
+	{
+		it = it->first % 2 == 0 ? m.erase(it) : ++it;
+	}
+	for (auto it = ref.begin(); it != ref.end();)
+	{
+		it = it->first % 2 == 0 ? ref.erase(it) : ++it;
+	}
+	assert(m.size() == ref.size());
+	for (auto& kv: ref)
+	{
+		assert(m.at(kv.first) == kv.second);
+	}
+
+	printf("%s\n", m.size() == ref.size() ? "Good Luck!" : "Oops!");
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Unordered_Map_03()
+{
+	printf("******************************03******************************\n");
+
+	//以 Aoki::String 为键，直接用 const char* 查找
+	Aoki::Unordered_Map<Aoki::String, int, Aoki::String_Hash, Aoki::String_Equal> m;
+	m[Aoki::String("Aoki")] = 1;
+	m[Aoki::String("Killua")] = 2;
+	assert(m.find("Aoki")->second == 1 && m.count("Killua") == 1 && !m.contains("Gon"));
+	assert(m.erase("Aoki") == 1 && m.size() == 1);
+
+	//预留空间后插入不会扩容
+	Aoki::Unordered_Set<int> s;
+	s.reserve(1000);
+	size_t buckets = s.bucket_count();
+	for (int i = 0; i < 1000; ++i)
+	{
+		s.insert(i * 7);
+	}
+	assert(s.bucket_count() == buckets && s.size() == 1000 && s.contains(693) && !s.contains(694));
+	assert(s.load_factor() <= s.max_load_factor());
+
+	//降低最大负载因子会重新散列
+	s.max_load_factor(0.25f);
+	assert(s.bucket_count() > buckets && s.load_factor() <= 0.25f && s.contains(693));
+	std::cout << "size = " << s.size() << ", buckets = " << s.bucket_count() << ", load = " << s.load_factor() << std::endl;
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+//获取自 begin 起经过的时间(单位：毫秒)
+double Elapsed_Bench(std::chrono::steady_clock::time_point begin)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+template<typename MapType, typename KeyType>
+void Run_Bench(const char* name, const std::vector<KeyType>& keys, const std::vector<KeyType>& misses)
+{
+	auto begin = std::chrono::steady_clock::now();
+	MapType m;
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		m[keys[i]] = static_cast<int>(i);
+	}
+	double insert = Elapsed_Bench(begin);
+
+	begin = std::chrono::steady_clock::now();
+	long long sum = 0;
+	for (const KeyType& key: keys)
+	{
+		sum += m.find(key)->second;
+	}
+	double hit = Elapsed_Bench(begin);
+
+	begin = std::chrono::steady_clock::now();
+	for (const KeyType& key: misses)
+	{
+		sum += m.find(key) == m.end() ? 0 : 1;
+	}
+	double miss = Elapsed_Bench(begin);
+
+	begin = std::chrono::steady_clock::now();
+	for (const KeyType& key: keys)
+	{
+		m.erase(key);
+	}
+	double erase = Elapsed_Bench(begin);
+
+	printf("%-28s%-12.1lf%-12.1lf%-12.1lf%-12.1lf%lld\n", name, insert, hit, miss, erase, sum);
+}
+
+void Test_Unordered_Map_04()
+{
+	printf("******************************04******************************\n");
+
+	//插入、命中查找、未命中查找与删除的耗时(单位：毫秒)
+	const size_t size = 1000000;
+	std::mt19937_64 random(42);
+	std::vector<long long> keys(size), misses(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		keys[i] = static_cast<long long>(random() >> 1);
+		misses[i] = -static_cast<long long>(random() >> 1) - 1;
+	}
+	std::vector<std::string> words(size), absent(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		words[i] = "key_" + std::to_string(keys[i]);
+		absent[i] = "nil_" + std::to_string(keys[i]);
+	}
+
+	printf("%-28s%-12s%-12s%-12s%-12s%s\n", "Map", "Insert", "Hit", "Miss", "Erase", "Sum");
+	Run_Bench<std::unordered_map<long long, int>>("std::unordered_map<int64>", keys, misses);
+	Run_Bench<Aoki::Unordered_Map<long long, int>>("Aoki::Unordered_Map<int64>", keys, misses);
+	Run_Bench<std::unordered_map<std::string, int>>("std::unordered_map<string>", words, absent);
+	Run_Bench<Aoki::Unordered_Map<std::string, int>>("Aoki::Unordered_Map<string>", words, absent);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Unordered_Map_05()
+{
+	printf("******************************05******************************\n");
+
+	//边遍历边删除：16 个槽位的小表中簇经常跨越数组末尾，每个元素必须恰好访问一次
+	std::mt19937 random(20221020);
+	bool succeed = true;
+	for (int trial = 0; trial < 20000; ++trial)
+	{
+		Aoki::Unordered_Map<int, int> m;
+		std::unordered_map<int, int> visits;
+		int count = 1 + static_cast<int>(random() % 14);
+		while (static_cast<int>(m.size()) < count)
+		{
+			int key = static_cast<int>(random() % 1000);
+			m[key] = key;
+			visits[key] = 0;
+		}
+		//先删除一半(留下的墓碑不能影响查找)，再删除剩余的全部
+		for (auto it = m.begin(); it != m.end();)
+		{
+			++visits[it->first];
+			it = it->first % 2 == 0 ? m.erase(it) : ++it;
+		}
+		for (auto& kv: visits)
+		{
+			succeed = succeed && kv.second == 1 && m.contains(kv.first) == (kv.first % 2 != 0);
+			kv.second = 0;
+		}
+		for (auto it = m.begin(); it != m.end();)
+		{
+			++visits[it->first];
+			it = m.erase(it);
+		}
+		for (auto& kv: visits)
+		{
+			succeed = succeed && kv.second == (kv.first % 2 != 0 ? 1 : 0);
+		}
+		succeed = succeed && m.empty() && m.begin() == m.end();
+		//清空后的表仍可正常插入
+		m[trial] = trial;
+		succeed = succeed && m.size() == 1 && m.at(trial) == trial;
+	}
+	assert(succeed);
+
+	printf("%s\n", succeed ? "Good Luck!" : "Oops!");
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_Unordered_Map_01();
+	Test_Unordered_Map_02();
+	Test_Unordered_Map_03();
+	Test_Unordered_Map_04();
+	Test_Unordered_Map_05();
+	return 0;
+}
\ No newline at end of file
@@ -1,5 +1,15 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "Contacts.h"
 
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 //菜单
 void Menu()
 {
@@ -11,11 +21,56 @@ void Menu()
 	printf("******************************************\n");
 }
 
-//清屏
-void Clear()
+//读取整数(输入无效时丢弃该行并返回"false")
+bool Scan_Int(int* value)
+{
+	int result = scanf("%d", value);
+	if (result != 1)
+	{
+		int ch;
+		while ((ch = getchar()) != '\n' && ch != EOF);
+	}
+	return result == 1;
+}
+
+//读取字符串(最多读取"size - 1"个字符)
+bool Scan_String(char* str, int size)
+{
+	char format[16];
+	snprintf(format, sizeof(format), "%%%ds", size - 1);
+	return scanf(format, str) == 1;
+}
+
+//等待按键
+static void Pause_Screen()
 {
+#if defined(_WIN32)
 	system("pause");
+#else
+	//先丢弃上一次输入剩下的换行符，再等待回车
+	printf("Press Enter to continue...");
+	int ch;
+	while ((ch = getchar()) != '\n' && ch != EOF);
+	while ((ch = getchar()) != '\n' && ch != EOF);
+#endif
+}
+
+//清除屏幕
+static void Clear_Screen()
+{
+#if defined(_WIN32)
 	system("cls");
+#else
+	printf("\033[2J\033[H");
+	fflush(stdout);
+#endif
+}
+
+//清屏
+void Clear()
+{
+	Pause_Screen();
+	Clear_Screen();
 }
 
 ////初始化通讯录(静态)
@@ -25,18 +80,101 @@ void Clear()
 //	contacts->number = 0;
 //}
 
+//取得联系人的姓名(索引回调)
+static const void* Key_Name(const void* context, int index)
+{
+	return ((const Contacts*)context)->people[index].name;
+}
+
+//取得联系人的电话(索引回调)
+static const void* Key_Phone(const void* context, int index)
+{
+	return ((const Contacts*)context)->people[index].phone;
+}
+
+//取得联系人的地址(索引回调)
+static const void* Key_Address(const void* context, int index)
+{
+	return ((const Contacts*)context)->people[index].address;
+}
+
+//取得联系人的年龄(索引回调)
+static const void* Key_Age(const void* context, int index)
+{
+	return &((const Contacts*)context)->people[index].age;
+}
+
+//比较字符串键
+static int Compar_String(const void* p1, const void* p2)
+{
+	return strcmp((const char*)p1, (const char*)p2);
+}
+
+//比较整数键
+static int Compar_Int(const void* p1, const void* p2)
+{
+	return (*(const int*)p1 > *(const int*)p2) - (*(const int*)p1 < *(const int*)p2);
+}
+
 //初始化通讯录(动态)
 void Init_Contacts(Contacts* contacts)
 {
+	Open_Contacts(contacts, CONTACTS_DATA, CONTACTS_LOG);
+	Enable_Search(contacts);
+}
+
+//打开通讯录("data"为快照文件，"log"为日志文件)
+void Open_Contacts(Contacts* contacts, const char* data, const char* log)
+{
+	assert(contacts && data && log);
 	contacts->people = (Information*)malloc(DEFAULT_SIZE * sizeof(Information));
 	if (contacts->people == NULL)
 	{
-		perror("Init_Contacts");
-		return;
+		perror("Open_Contacts");
+		exit(EXIT_FAILURE);
 	}
 	contacts->number = 0;
 	contacts->capacity = DEFAULT_SIZE;
+	Init_HashIndex(&contacts->nameIndex, contacts, Key_Name);
+	Init_OrderIndex(&contacts->phoneIndex, contacts, Key_Phone, MAX_PHONE, Compar_String);
+	Init_OrderIndex(&contacts->ageIndex, contacts, Key_Age, sizeof(int), Compar_Int);
+	Init_RadixTree(&contacts->nameRadix, contacts, Key_Name);
+	Init_RadixTree(&contacts->phoneRadix, contacts, Key_Phone);
+	Init_RadixTree(&contacts->addressRadix, contacts, Key_Address);
+	IndexKey fields[] = { Key_Name, Key_Phone, Key_Address };
+	Init_GramIndex(&contacts->gramIndex, contacts, fields, sizeof(fields) / sizeof(fields[0]));
+	contacts->indexed = false;
+	contacts->searchable = false;
+	contacts->log = NULL;
+	contacts->logCount = 0;
+	snprintf(contacts->dataPath, CONTACTS_MAX_PATH, "%s", data);
+	snprintf(contacts->tempPath, CONTACTS_MAX_PATH, "%s.tmp", data);
+	snprintf(contacts->logPath, CONTACTS_MAX_PATH, "%s", log);
 	Read_Contacts(contacts);
+	Build_Index(contacts);
+	if (contacts->log == NULL)
+	{
+		contacts->log = fopen(contacts->logPath, "ab");
+		if (contacts->log == NULL)
+		{
+			perror("Open_Contacts");
+		}
+	}
+}
+
+//读取联系人的信息
+static void Input_Information(Information* info)
+{
+	printf("请输入姓名>>");
+	Scan_String(info->name, MAX_NAME);
+	printf("请输入年龄>>");
+	Scan_Int(&(info->age));
+	printf("请输入性别>>");
+	Scan_String(info->sex, MAX_SEX);
+	printf("请输入电话>>");
+	Scan_String(info->phone, MAX_PHONE);
+	printf("请输入地址>>");
+	Scan_String(info->address, MAX_ADDRESS);
 }
 
 ////添加联系人的信息(静态)
@@ -48,15 +186,15 @@ void Init_Contacts(Contacts* contacts)
 //		return;
 //	}
 //	printf("请输入姓名>>");
-//	scanf_s("%s", contacts->people[contacts->number].name, MAX_NAME);
+//	Scan_String(contacts->people[contacts->number].name, MAX_NAME);
 //	printf("请输入年龄>>");
-//	scanf_s("%d", &(contacts->people[contacts->number].age));
+//	Scan_Int(&(contacts->people[contacts->number].age));
 //	printf("请输入性别>>");
-//	scanf_s("%s", contacts->people[contacts->number].sex, MAX_SEX);
+//	Scan_String(contacts->people[contacts->number].sex, MAX_SEX);
 //	printf("请输入电话>>");
-//	scanf_s("%s", contacts->people[contacts->number].phone, MAX_PHONE);
+//	Scan_String(contacts->people[contacts->number].phone, MAX_PHONE);
 //	printf("请输入地址>>");
-//	scanf_s("%s", contacts->people[contacts->number].address, MAX_ADDRESS);
+//	Scan_String(contacts->people[contacts->number].address, MAX_ADDRESS);
 //	contacts->number++;
 //	printf("添加成功！\n");
 //}
@@ -64,22 +202,13 @@ void Init_Contacts(Contacts* contacts)
 //添加联系人的信息(动态)
 void Add_Contacts(Contacts* contacts)
 {
-	Check_Capacity(contacts);
-	printf("请输入姓名>>");
-	scanf_s("%s", contacts->people[contacts->number].name, MAX_NAME);
-	printf("请输入年龄>>");
-	scanf_s("%d", &(contacts->people[contacts->number].age));
-	printf("请输入性别>>");
-	scanf_s("%s", contacts->people[contacts->number].sex, MAX_SEX);
-	printf("请输入电话>>");
-	scanf_s("%s", contacts->people[contacts->number].phone, MAX_PHONE);
-	printf("请输入地址>>");
-	scanf_s("%s", contacts->people[contacts->number].address, MAX_ADDRESS);
-	contacts->number++;
+	Information tmp = { 0 };
+	Input_Information(&tmp);
+	Insert_Contacts(contacts, &tmp);
 	printf("添加成功！\n");
 }
 
-//删除联系人的信息
+//删除联系人的信息(最后一个联系人移动到被删除的位置)
 void Del_Contacts(Contacts* contacts)
 {
 	if (contacts->number == 0)
@@ -90,21 +219,17 @@ void Del_Contacts(Contacts* contacts)
 	Point_Contacts(contacts);
 	int input = 0;
 	printf("请输入需要删除的联系人的序号>>");
-	scanf_s("%d", &input);
+	Scan_Int(&input);
 	if (input > contacts->number || input <= 0)
 	{
 		printf("联系人不存在\n");
 		return;
 	}
-	for (int i = input; i < contacts->number; i++)
-	{
-		contacts->people[i - 1] = contacts->people[i];
-	}
+	Erase_Contacts(contacts, input - 1);
 	printf("删除联系人成功！\n");
-	contacts->number--;
 }
 
-//查找联系人
+//查找联系人(先按姓名与电话精确查找，找不到时按姓名、电话与地址模糊查找)
 void Search_Contacts(Contacts* contacts)
 {
 	if (contacts->number == 0)
@@ -112,26 +237,42 @@ void Search_Contacts(Contacts* contacts)
 		printf("联系人为空！请添加联系人！\n");
 		return;
 	}
-	char name[MAX_NAME] = { 0 };
-	printf("请输入要搜索的联系人的姓名>>");
-	scanf_s("%s", name, MAX_NAME);
-	for (int i = 0; i < contacts->number; i++)
+	char text[MAX_ADDRESS] = { 0 };
+	printf("请输入要搜索的联系人的姓名、电话或地址(可以只输入一部分)>>");
+	Scan_String(text, MAX_ADDRESS);
+	int result[SEARCH_TOP_K];
+	size_t count = 0;
+	result[0] = Find_Contacts(contacts, text);
+	if (result[0] == -1)
 	{
-		if (strcmp(name, contacts->people[i].name) == 0)
-		{
-			printf("%-s\t%-10s\t%-5s\t%-5s\t%-20s\t%-30s\n", "序号", "姓名", "年龄", "性别", "电话", "地址");
-			printf("%-d\t%-10s\t%-5d\t%-5s\t%-20s\t%-30s\n",
-					i + 1,
-					contacts->people[i].name,
-					contacts->people[i].age,
-					contacts->people[i].sex,
-					contacts->people[i].phone,
-					contacts->people[i].address
-			);
-			return;
-		}
+		result[0] = Find_Phone_Contacts(contacts, text);
+	}
+	if (result[0] != -1)
+	{
+		count = 1;
+	}
+	else if (contacts->searchable)
+	{
+		count = Fuzzy_Contacts(contacts, text, result, SEARCH_TOP_K);
+	}
+	if (count == 0)
+	{
+		printf("查无此人！\n");
+		return;
+	}
+	printf("%-s\t%-10s\t%-5s\t%-5s\t%-20s\t%-30s\n", "序号", "姓名", "年龄", "性别", "电话", "地址");
+	for (size_t j = 0; j < count; j++)
+	{
+		int i = result[j];
+		printf("%-d\t%-10s\t%-5d\t%-5s\t%-20s\t%-30s\n",
+				i + 1,
+				contacts->people[i].name,
+				contacts->people[i].age,
+				contacts->people[i].sex,
+				contacts->people[i].phone,
+				contacts->people[i].address
+		);
 	}
-	printf("查无此人！\n");
 }
 
 //更改联系人的信息
@@ -144,26 +285,17 @@ void Modify_Contacts(Contacts* contacts)
 	}
 	char name[MAX_NAME] = { 0 };
 	printf("请输入要更改的联系人的姓名>>");
-	scanf_s("%s", name, MAX_NAME);
-	for (int i = 0; i < contacts->number; i++)
+	Scan_String(name, MAX_NAME);
+	int i = Find_Contacts(contacts, name);
+	if (i == -1)
 	{
-		if (strcmp(name, contacts->people[i].name) == 0)
-		{
-			printf("请输入姓名>>");
-			scanf_s("%s", contacts->people[i].name, MAX_NAME);
-			printf("请输入年龄>>");
-			scanf_s("%d", &(contacts->people[i].age));
-			printf("请输入性别>>");
-			scanf_s("%s", contacts->people[i].sex, MAX_SEX);
-			printf("请输入电话>>");
-			scanf_s("%s", contacts->people[i].phone, MAX_PHONE);
-			printf("请输入地址>>");
-			scanf_s("%s", contacts->people[i].address, MAX_ADDRESS);
-			printf("更改成功！\n");
-			return;
-		}
+		printf("更改失败！\n");
+		return;
 	}
-	printf("更改失败！\n");
+	Information tmp = { 0 };
+	Input_Information(&tmp);
+	Update_Contacts(contacts, i, &tmp);
+	printf("更改成功！\n");
 }
 
 //排序联系人
@@ -172,6 +304,7 @@ void Sort_Menu()
 	printf("***************************************\n");
 	printf("**********  1. Sort By Name  **********\n");
 	printf("**********  2. Sort By Age   **********\n");
+	printf("**********  3. Sort By Phone **********\n");
 	printf("**********  0.  Exit Sort    **********\n");
 	printf("***************************************\n");
 }
@@ -186,37 +319,255 @@ int Compar_Age(const void* p1, const void* p2)
 	return ((Information*)p1)->age - ((Information*)p2)->age;
 }
 
-void Swap(char* p1, char* p2, size_t size)
+//定义结构体类型(排序用的关键字前缀与下标)
+typedef struct SortPair
+{
+	unsigned long long prefix;
+	int index;
+} SortPair;
+
+//取得字符串关键字与其数组大小(年龄返回空)
+static const char* Sort_Field(const Information* info, int key, size_t* size)
 {
-	for (int i = 0; i < size; i++)
+	switch (key)
 	{
-		char tmp = *p1;
-		*p1 = *p2;
-		*p2 = tmp;
-		p1++, p2++;
+	case SORT_NAME:
+		*size = MAX_NAME;
+		return info->name;
+	case SORT_PHONE:
+		*size = MAX_PHONE;
+		return info->phone;
+	default:
+		*size = 0;
+		return NULL;
 	}
 }
 
-void Insert_Sort(void* base, size_t num, size_t size, int (* compar)(const void*, const void*))
+//计算关键字从第"offset"个字符开始的8字节前缀(大端序，字符串结束后补零；年龄翻转符号位后放在高位)，前缀的大小关系与关键字一致
+static unsigned long long Sort_Prefix(const Information* info, int key, size_t offset)
 {
-	for (int i = 1; i < num; i++)
+	size_t size;
+	const char* field = Sort_Field(info, key, &size);
+	if (field == NULL)
+	{
+		return (unsigned long long)((unsigned int)info->age ^ 0x80000000u) << 32;
+	}
+	unsigned long long prefix = 0;
+	bool ended = false;
+	for (size_t i = 0; i < sizeof(prefix); i++)
 	{
-		for (int j = i - 1; j >= 0 && compar((char*)base + j * size, (char*)base + (j + 1) * size) > 0; j--)
+		unsigned char ch = 0;
+		if (!ended && offset + i < size)
 		{
-			Swap((char*)base + j * size, (char*)base + (j + 1) * size, size);
+			ch = (unsigned char)field[offset + i];
+			ended = ch == '\0';
 		}
+		prefix = prefix << 8 | ch;
 	}
+	return prefix;
 }
 
-void Sort(Contacts* contacts, int (* ptr)(const void*, const void*))
+//依次比较"keys"中的关键字
+static int Compare_Keys(const Information* p1, const Information* p2, const int* keys, int keyCount)
 {
-	system("cls");
+	for (int i = 0; i < keyCount; i++)
+	{
+		int result;
+		switch (keys[i])
+		{
+		case SORT_NAME:
+			result = strcmp(p1->name, p2->name);
+			break;
+		case SORT_PHONE:
+			result = strcmp(p1->phone, p2->phone);
+			break;
+		default:
+			result = (p1->age > p2->age) - (p1->age < p2->age);
+			break;
+		}
+		if (result != 0)
+		{
+			return result;
+		}
+	}
+	return 0;
+}
+
+//按前缀做低位优先的基数排序(每趟处理一个字节，所有前缀在该字节上相同时跳过这一趟；排序是稳定的，"buffer"为同样大小的辅助数组)
+static void Radix_Pairs(SortPair* pairs, SortPair* buffer, size_t count)
+{
+	size_t histogram[sizeof(unsigned long long)][256] = { 0 };
+	for (size_t i = 0; i < count; i++)
+	{
+		for (size_t b = 0; b < sizeof(unsigned long long); b++)
+		{
+			histogram[b][pairs[i].prefix >> (8 * b) & 0xFF]++;
+		}
+	}
+	SortPair* from = pairs;
+	SortPair* to = buffer;
+	for (size_t b = 0; b < sizeof(unsigned long long); b++)
+	{
+		size_t* bucket = histogram[b];
+		if (bucket[from[0].prefix >> (8 * b) & 0xFF] == count)
+		{
+			continue;
+		}
+		size_t sum = 0;
+		for (int d = 0; d < 256; d++)
+		{
+			size_t tmp = bucket[d];
+			bucket[d] = sum;
+			sum += tmp;
+		}
+		for (size_t i = 0; i < count; i++)
+		{
+			to[bucket[from[i].prefix >> (8 * b) & 0xFF]++] = from[i];
+		}
+		SortPair* tmp = from;
+		from = to;
+		to = tmp;
+	}
+	if (from != pairs)
+	{
+		memcpy(pairs, from, sizeof(SortPair) * count);
+	}
+}
+
+//排序(从第"key"个关键字的第"offset"个字符开始比较，此前的部分均相同)
+static void Sort_Pairs(const Information* people, SortPair* pairs, SortPair* buffer, size_t count, const int* keys, int keyCount, int key, size_t offset)
+{
+	if (count < SORT_SMALL)
+	{
+		//数量少时直接插入排序(稳定，相同时保持下标顺序)
+		for (size_t i = 1; i < count; i++)
+		{
+			SortPair tmp = pairs[i];
+			size_t j = i;
+			while (j > 0 && Compare_Keys(people + pairs[j - 1].index, people + tmp.index, keys + key, keyCount - key) > 0)
+			{
+				pairs[j] = pairs[j - 1];
+				j--;
+			}
+			pairs[j] = tmp;
+		}
+		return;
+	}
+	for (size_t i = 0; i < count; i++)
+	{
+		pairs[i].prefix = Sort_Prefix(people + pairs[i].index, keys[key], offset);
+	}
+	Radix_Pairs(pairs, buffer, count);
+	//前缀相同的组：字符串尚未结束时比较下一段前缀，否则比较下一个关键字
+	size_t begin = 0;
+	while (begin < count)
+	{
+		size_t end = begin + 1;
+		while (end < count && pairs[end].prefix == pairs[begin].prefix)
+		{
+			end++;
+		}
+		size_t size;
+		int nextKey = key;
+		size_t nextOffset = offset + sizeof(unsigned long long);
+		if (Sort_Field(people + pairs[begin].index, keys[key], &size) == NULL || (pairs[begin].prefix & 0xFF) == 0 || nextOffset >= size)
+		{
+			nextKey = key + 1;
+			nextOffset = 0;
+		}
+		if (end - begin > 1 && nextKey < keyCount)
+		{
+			Sort_Pairs(people, pairs + begin, buffer + begin, end - begin, keys, keyCount, nextKey, nextOffset);
+		}
+		begin = end;
+	}
+}
+
+//按排列移动联系人(第"i"个位置放入原下标为"order[i]"的联系人，沿置换的环移动，每个联系人只移动一次)
+static void Permute_Information(Information* people, int* order, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (order[i] == i)
+		{
+			continue;
+		}
+		Information tmp = people[i];
+		int j = i;
+		while (order[j] != i)
+		{
+			int next = order[j];
+			people[j] = people[next];
+			order[j] = j;
+			j = next;
+		}
+		people[j] = tmp;
+		order[j] = j;
+	}
+}
+
+//按关键字列表排序联系人数组(只排序(前缀, 下标)对，最后一次性移动联系人)，排序后第"i"个联系人的原下标写入"origin[i]"("origin"可为空)
+static void Sort_Information(Information* people, int count, const int* keys, int keyCount, int* origin)
+{
+	if (count < 2 || keyCount <= 0)
+	{
+		for (int i = 0; i < count && origin != NULL; i++)
+		{
+			origin[i] = i;
+		}
+		return;
+	}
+	SortPair* pairs = (SortPair*)malloc(sizeof(SortPair) * (size_t)count * 2);
+	if (pairs == NULL)
+	{
+		perror("Sort_Information");
+		exit(EXIT_FAILURE);
+	}
+	for (int i = 0; i < count; i++)
+	{
+		pairs[i].index = i;
+	}
+	Sort_Pairs(people, pairs, pairs + count, (size_t)count, keys, keyCount, 0, 0);
+	//辅助数组已不再需要，用来保存排列
+	int* order = (int*)(pairs + count);
+	for (int i = 0; i < count; i++)
+	{
+		order[i] = pairs[i].index;
+	}
+	if (origin != NULL)
+	{
+		memcpy(origin, order, sizeof(int) * count);
+	}
+	Permute_Information(people, order, count);
+	free(pairs);
+}
+
+//按关键字列表排序联系人(依次比较"keys"中的"keyCount"个关键字，全部相同时保持原有顺序)，排序后更新索引并压缩
+void Order_Contacts(Contacts* contacts, const int* keys, int keyCount)
+{
+	assert(contacts && keys && keyCount <= SORT_MAX_KEYS);
+	int* order = (int*)malloc(sizeof(int) * (contacts->number + 1));
+	if (order == NULL)
+	{
+		perror("Order_Contacts");
+		exit(EXIT_FAILURE);
+	}
+	Sort_Information(contacts->people, contacts->number, keys, keyCount, order);
+	//排序改变了联系人的下标，日志中记录的下标随之失效，因此更新索引并压缩
+	Reorder_Index(contacts, order);
+	free(order);
+	Compact_Contacts(contacts);
+}
+
+void Sort(Contacts* contacts, const int* keys, int keyCount)
+{
+	Clear_Screen();
 	printf("排序前>");
 	Point_Contacts(contacts);
-	Insert_Sort(contacts->people, contacts->number, sizeof(Information), ptr);
+	Order_Contacts(contacts, keys, keyCount);
 	printf("排序后>");
 	Point_Contacts(contacts);
-	system("pause");
+	Pause_Screen();
 }
 
 void Sort_Contacts(Contacts* contacts)
@@ -233,20 +584,30 @@ void Sort_Contacts(Contacts* contacts)
 		Clear();
 		return;
 	}
+	//主关键字相同时依次比较其余关键字
+	static const int byName[] = { SORT_NAME, SORT_AGE, SORT_PHONE };
+	static const int byAge[] = { SORT_AGE, SORT_NAME, SORT_PHONE };
+	static const int byPhone[] = { SORT_PHONE, SORT_NAME, SORT_AGE };
 	int input = 0;
 	do
 	{
-		system("cls");
+		Clear_Screen();
 		Sort_Menu();
 		printf("Please enter>>");
-		scanf_s("%d", &input);
+		if (!Scan_Int(&input))
+		{
+			input = feof(stdin) ? 0 : -1;
+		}
 		switch (input)
 		{
 		case 1:
-			Sort(contacts, Compar_Name);
+			Sort(contacts, byName, SORT_MAX_KEYS);
 			break;
 		case 2:
-			Sort(contacts, Compar_Age);
+			Sort(contacts, byAge, SORT_MAX_KEYS);
+			break;
+		case 3:
+			Sort(contacts, byPhone, SORT_MAX_KEYS);
 			break;
 		case 0:
 			printf("\nExit Sort!\n\n");
@@ -283,23 +644,20 @@ void Point_Contacts(Contacts* contacts)
 	printf("\n");
 }
 
-//检查容量
+//检查容量(按倍数扩容)
 void Check_Capacity(Contacts* contacts)
 {
 	if (contacts->number == contacts->capacity)
 	{
-		Information* tmp = (Information*)realloc(contacts->people,
-				(EXPAND_SIZE + contacts->capacity) * sizeof(Information));
-		if (tmp != NULL)
+		int capacity = contacts->capacity == 0 ? DEFAULT_SIZE : contacts->capacity * EXPAND_FACTOR;
+		Information* tmp = (Information*)realloc(contacts->people, (size_t)capacity * sizeof(Information));
+		if (tmp == NULL)
 		{
-			contacts->people = tmp;
-			contacts->capacity += EXPAND_SIZE;
-		}
-		else
-		{
-			perror("Add_Contacts");
-			return;
+			perror("Check_Capacity");
+			exit(EXIT_FAILURE);
 		}
+		contacts->people = tmp;
+		contacts->capacity = capacity;
 	}
 }
 
@@ -310,43 +668,1094 @@ void Remove_Contacts(Contacts* contacts)
 	contacts->people = NULL;
 	contacts->number = 0;
 	contacts->capacity = 0;
+	Destroy_HashIndex(&contacts->nameIndex);
+	Destroy_OrderIndex(&contacts->phoneIndex);
+	Destroy_OrderIndex(&contacts->ageIndex);
+	Destroy_RadixTree(&contacts->nameRadix);
+	Destroy_RadixTree(&contacts->phoneRadix);
+	Destroy_RadixTree(&contacts->addressRadix);
+	Destroy_GramIndex(&contacts->gramIndex);
+	contacts->indexed = false;
+	contacts->searchable = false;
+	if (contacts->log != NULL)
+	{
+		fclose(contacts->log);
+		contacts->log = NULL;
+	}
+	contacts->logCount = 0;
 }
 
-//从文件中读取通讯录信息
-void Read_Contacts(Contacts* contacts)
+//判断文件是否存在
+static bool Exists_File(const char* path)
 {
-	FILE* ptr;
-	fopen_s(&ptr, "Contacts.dat", "r+");
+	FILE* ptr = fopen(path, "rb");
 	if (ptr == NULL)
 	{
-		//perror("Read_Contacts");
-		return;
+		return false;
+	}
+	fclose(ptr);
+	return true;
+}
+
+//重放一条日志记录，记录无效时返回"false"
+static bool Replay_Log(Contacts* contacts, const LogEntry* entry)
+{
+	switch (entry->operation)
+	{
+	case LOG_ADD:
+		if (entry->index != contacts->number)
+		{
+			return false;
+		}
+		Insert_Contacts(contacts, &entry->info);
+		return true;
+	case LOG_DEL:
+		if (entry->index < 0 || entry->index >= contacts->number)
+		{
+			return false;
+		}
+		Erase_Contacts(contacts, entry->index);
+		return true;
+	case LOG_MODIFY:
+		if (entry->index < 0 || entry->index >= contacts->number)
+		{
+			return false;
+		}
+		Update_Contacts(contacts, entry->index, &entry->info);
+		return true;
+	default:
+		return false;
 	}
-	Information tmp;
-	while (fread(&tmp, sizeof(Information), 1, ptr))
+}
+
+//计算校验和(每次处理"8"字节的"FNV"风格64位校验和)
+unsigned long long Checksum_Contacts(const void* data, size_t size)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	unsigned long long hash = 14695981039346656037ULL;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8)
 	{
-		Check_Capacity(contacts);
-		contacts->people[contacts->number] = tmp;
-		contacts->number++;
+		unsigned long long word;
+		memcpy(&word, bytes + i, 8);
+		hash = (hash ^ word) * 1099511628211ULL;
 	}
-	fclose(ptr);
-	ptr = NULL;
+	for (; i < size; i++)
+	{
+		hash = (hash ^ bytes[i]) * 1099511628211ULL;
+	}
+	return hash;
 }
 
-//保存通讯录至文件
-void Save_Contacts(Contacts* contacts)
+//获取文件大小(单位：字节)
+static long long Size_File(FILE* ptr)
+{
+#if defined(_WIN32)
+	_fseeki64(ptr, 0, SEEK_END);
+	long long size = _ftelli64(ptr);
+#else
+	fseeko(ptr, 0, SEEK_END);
+	long long size = (long long)ftello(ptr);
+#endif
+	rewind(ptr);
+	return size;
+}
+
+//将文件刷新到磁盘
+static bool Sync_File(FILE* ptr)
+{
+	if (fflush(ptr) != 0)
+	{
+		return false;
+	}
+#if defined(_WIN32)
+	return _commit(_fileno(ptr)) == 0;
+#else
+	return fsync(fileno(ptr)) == 0;
+#endif
+}
+
+//预留可容纳"count"个联系人的空间
+static void Reserve_Contacts(Contacts* contacts, size_t count)
+{
+	if (count > (size_t)contacts->capacity)
+	{
+		Information* tmp = (Information*)realloc(contacts->people, count * sizeof(Information));
+		if (tmp == NULL)
+		{
+			perror("Reserve_Contacts");
+			exit(EXIT_FAILURE);
+		}
+		contacts->people = tmp;
+		contacts->capacity = (int)count;
+	}
+}
+
+//读取快照(按联系人数一次性分配数组并一次性读入)，文件损坏时返回"false"
+static bool Load_Snapshot(Contacts* contacts, FILE* ptr)
+{
+	long long size = Size_File(ptr);
+	if (size < 0)
+	{
+		return false;
+	}
+	ContactsHeader header;
+	bool legacy = (size_t)size < sizeof(ContactsHeader)
+			|| fread(&header, sizeof(ContactsHeader), 1, ptr) != 1
+			|| memcmp(header.magic, CONTACTS_MAGIC, sizeof(header.magic)) != 0;
+	unsigned long long bytes = (unsigned long long)size - (legacy ? 0 : sizeof(ContactsHeader));
+	if (bytes % sizeof(Information) != 0 || bytes / sizeof(Information) > INT_MAX)
+	{
+		return false;
+	}
+	size_t count = (size_t)(bytes / sizeof(Information));
+	if (legacy)
+	{
+		//旧格式没有文件头，整个文件都是联系人数组
+		rewind(ptr);
+	}
+	else if (header.version != CONTACTS_VERSION || header.recordSize != sizeof(Information) || header.count != count)
+	{
+		return false;
+	}
+	Reserve_Contacts(contacts, count);
+	if (fread(contacts->people, sizeof(Information), count, ptr) != count)
+	{
+		return false;
+	}
+	if (!legacy && Checksum_Contacts(contacts->people, count * sizeof(Information)) != header.checksum)
+	{
+		return false;
+	}
+	contacts->number = (int)count;
+	return true;
+}
+
+//从文件中读取通讯录信息(读取快照并重放日志)
+void Read_Contacts(Contacts* contacts)
 {
-	FILE* ptr;
-	fopen_s(&ptr, "Contacts.dat", "w+");
+	//临时快照只有在写入完成后才会删除日志，因此日志不存在时临时快照是完整的
+	if (Exists_File(contacts->tempPath))
+	{
+		if (Exists_File(contacts->logPath))
+		{
+			remove(contacts->tempPath);
+		}
+		else
+		{
+			remove(contacts->dataPath);
+			rename(contacts->tempPath, contacts->dataPath);
+		}
+	}
+	FILE* ptr = fopen(contacts->dataPath, "rb");
+	if (ptr != NULL)
+	{
+		bool loaded = Load_Snapshot(contacts, ptr);
+		fclose(ptr);
+		if (!loaded)
+		{
+			fprintf(stderr, "Read_Contacts：%s is corrupted\n", contacts->dataPath);
+			exit(EXIT_FAILURE);
+		}
+	}
+	ptr = fopen(contacts->logPath, "rb");
 	if (ptr == NULL)
 	{
-		perror("Save_Contacts");
 		return;
 	}
-	for (int i = 0; i < contacts->number; i++)
+	LogEntry entry;
+	size_t count = 0;
+	bool broken = false;
+	while ((count = fread(&entry, 1, sizeof(LogEntry), ptr)) == sizeof(LogEntry))
 	{
-		fwrite(contacts->people + i, sizeof(Information), 1, ptr);
+		if (!Replay_Log(contacts, &entry))
+		{
+			broken = true;
+			break;
+		}
+		contacts->logCount++;
 	}
 	fclose(ptr);
 	ptr = NULL;
+	//日志末尾有不完整或无效的记录(写入时崩溃)，继续追加会使其后的记录错位，因此立即压缩
+	if (broken || count != 0)
+	{
+		Compact_Contacts(contacts);
+	}
+}
+
+//判断是否需要压缩
+static bool Need_Compact(const Contacts* contacts)
+{
+	return contacts->logCount > COMPACT_MIN_LOG && 2LL * contacts->logCount > (long long)contacts->number;
+}
+
+//保存通讯录至文件(每次修改都已追加到日志，这里只在日志过长或无法写入日志时压缩)
+void Save_Contacts(Contacts* contacts)
+{
+	if (contacts->log == NULL || Need_Compact(contacts))
+	{
+		Compact_Contacts(contacts);
+	}
+	else
+	{
+		fflush(contacts->log);
+	}
+}
+
+//追加一条日志记录
+static void Append_Log(Contacts* contacts, int operation, int index, const Information* info)
+{
+	if (contacts->log == NULL)
+	{
+		return;
+	}
+	LogEntry entry;
+	memset(&entry, 0, sizeof(LogEntry));
+	entry.operation = operation;
+	entry.index = index;
+	if (info != NULL)
+	{
+		entry.info = *info;
+	}
+	if (fwrite(&entry, sizeof(LogEntry), 1, contacts->log) != 1 || fflush(contacts->log) != 0)
+	{
+		perror("Append_Log");
+		return;
+	}
+	contacts->logCount++;
+	if (Need_Compact(contacts))
+	{
+		Compact_Contacts(contacts);
+	}
+}
+
+//插入联系人(返回其下标)
+int Insert_Contacts(Contacts* contacts, const Information* info)
+{
+	assert(contacts && info);
+	Check_Capacity(contacts);
+	int index = contacts->number;
+	contacts->people[index] = *info;
+	contacts->number++;
+	if (contacts->indexed)
+	{
+		Insert_HashIndex(&contacts->nameIndex, index);
+		Insert_OrderIndex(&contacts->phoneIndex, index);
+		Insert_OrderIndex(&contacts->ageIndex, index);
+	}
+	if (contacts->indexed && contacts->searchable)
+	{
+		Insert_RadixTree(&contacts->nameRadix, index);
+		Insert_RadixTree(&contacts->phoneRadix, index);
+		Insert_RadixTree(&contacts->addressRadix, index);
+		Insert_GramIndex(&contacts->gramIndex, index);
+	}
+	Append_Log(contacts, LOG_ADD, index, info);
+	return index;
+}
+
+//删除下标为"index"的联系人(最后一个联系人移动到该位置)
+void Erase_Contacts(Contacts* contacts, int index)
+{
+	assert(contacts && index >= 0 && index < contacts->number);
+	int last = contacts->number - 1;
+	if (contacts->indexed)
+	{
+		Erase_HashIndex(&contacts->nameIndex, index);
+		Erase_OrderIndex(&contacts->phoneIndex, index);
+		Erase_OrderIndex(&contacts->ageIndex, index);
+		if (index != last)
+		{
+			Move_HashIndex(&contacts->nameIndex, last, index);
+			Erase_OrderIndex(&contacts->phoneIndex, last);
+			Erase_OrderIndex(&contacts->ageIndex, last);
+		}
+	}
+	if (contacts->indexed && contacts->searchable)
+	{
+		Erase_RadixTree(&contacts->nameRadix, index);
+		Erase_RadixTree(&contacts->phoneRadix, index);
+		Erase_RadixTree(&contacts->addressRadix, index);
+		Erase_GramIndex(&contacts->gramIndex, index);
+		if (index != last)
+		{
+			Move_RadixTree(&contacts->nameRadix, last, index);
+			Move_RadixTree(&contacts->phoneRadix, last, index);
+			Move_RadixTree(&contacts->addressRadix, last, index);
+			Move_GramIndex(&contacts->gramIndex, last, index);
+		}
+	}
+	contacts->people[index] = contacts->people[last];
+	contacts->number--;
+	if (contacts->indexed && index != last)
+	{
+		Insert_OrderIndex(&contacts->phoneIndex, index);
+		Insert_OrderIndex(&contacts->ageIndex, index);
+	}
+	Append_Log(contacts, LOG_DEL, index, NULL);
+}
+
+//更改下标为"index"的联系人
+void Update_Contacts(Contacts* contacts, int index, const Information* info)
+{
+	assert(contacts && info && index >= 0 && index < contacts->number);
+	Information* person = contacts->people + index;
+	bool name = contacts->indexed && strcmp(person->name, info->name) != 0;
+	bool phone = contacts->indexed && strcmp(person->phone, info->phone) != 0;
+	bool age = contacts->indexed && person->age != info->age;
+	bool address = contacts->indexed && strcmp(person->address, info->address) != 0;
+	bool search = contacts->searchable && (name || phone || address);
+	if (name)
+	{
+		Erase_HashIndex(&contacts->nameIndex, index);
+	}
+	if (phone)
+	{
+		Erase_OrderIndex(&contacts->phoneIndex, index);
+	}
+	if (age)
+	{
+		Erase_OrderIndex(&contacts->ageIndex, index);
+	}
+	if (search)
+	{
+		if (name)
+		{
+			Erase_RadixTree(&contacts->nameRadix, index);
+		}
+		if (phone)
+		{
+			Erase_RadixTree(&contacts->phoneRadix, index);
+		}
+		if (address)
+		{
+			Erase_RadixTree(&contacts->addressRadix, index);
+		}
+		Erase_GramIndex(&contacts->gramIndex, index);
+	}
+	*person = *info;
+	if (name)
+	{
+		Insert_HashIndex(&contacts->nameIndex, index);
+	}
+	if (phone)
+	{
+		Insert_OrderIndex(&contacts->phoneIndex, index);
+	}
+	if (age)
+	{
+		Insert_OrderIndex(&contacts->ageIndex, index);
+	}
+	if (search)
+	{
+		if (name)
+		{
+			Insert_RadixTree(&contacts->nameRadix, index);
+		}
+		if (phone)
+		{
+			Insert_RadixTree(&contacts->phoneRadix, index);
+		}
+		if (address)
+		{
+			Insert_RadixTree(&contacts->addressRadix, index);
+		}
+		Insert_GramIndex(&contacts->gramIndex, index);
+	}
+	Append_Log(contacts, LOG_MODIFY, index, info);
+}
+
+//按姓名查找联系人(返回下标，不存在时返回"-1")
+int Find_Contacts(const Contacts* contacts, const char* name)
+{
+	assert(contacts && name);
+	return Find_HashIndex(&contacts->nameIndex, name);
+}
+
+//按电话查找联系人(返回下标，不存在时返回"-1")
+int Find_Phone_Contacts(const Contacts* contacts, const char* phone)
+{
+	assert(contacts && phone);
+	size_t pos = Lower_OrderIndex(&contacts->phoneIndex, phone);
+	if (pos < contacts->phoneIndex.size)
+	{
+		int index = At_OrderIndex(&contacts->phoneIndex, pos);
+		if (strcmp(contacts->people[index].phone, phone) == 0)
+		{
+			return index;
+		}
+	}
+	return -1;
+}
+
+//统计年龄在"[low, high]"内的联系人个数
+size_t Count_Age_Contacts(const Contacts* contacts, int low, int high)
+{
+	assert(contacts);
+	if (low > high)
+	{
+		return 0;
+	}
+	return Upper_OrderIndex(&contacts->ageIndex, &high) - Lower_OrderIndex(&contacts->ageIndex, &low);
+}
+
+//构建前缀索引与"n-gram"倒排索引
+static void Build_Search(Contacts* contacts)
+{
+	Clear_RadixTree(&contacts->nameRadix);
+	Clear_RadixTree(&contacts->phoneRadix);
+	Clear_RadixTree(&contacts->addressRadix);
+	Clear_GramIndex(&contacts->gramIndex);
+	for (int i = 0; i < contacts->number; i++)
+	{
+		Insert_RadixTree(&contacts->nameRadix, i);
+		Insert_RadixTree(&contacts->phoneRadix, i);
+		Insert_RadixTree(&contacts->addressRadix, i);
+		Insert_GramIndex(&contacts->gramIndex, i);
+	}
+}
+
+//构建哈希索引与有序索引
+static void Build_Lookup(Contacts* contacts)
+{
+	Clear_HashIndex(&contacts->nameIndex);
+	Reserve_HashIndex(&contacts->nameIndex, (size_t)contacts->number);
+	for (int i = 0; i < contacts->number; i++)
+	{
+		Insert_HashIndex(&contacts->nameIndex, i);
+	}
+	Build_OrderIndex(&contacts->phoneIndex, contacts->number);
+	Build_OrderIndex(&contacts->ageIndex, contacts->number);
+	contacts->indexed = true;
+}
+
+//构建全部索引
+void Build_Index(Contacts* contacts)
+{
+	assert(contacts);
+	Build_Lookup(contacts);
+	if (contacts->searchable)
+	{
+		Build_Search(contacts);
+	}
+}
+
+//联系人按排列重新排列后更新全部索引(第"i"个位置的联系人原下标为"order[i]")
+void Reorder_Index(Contacts* contacts, const int* order)
+{
+	assert(contacts && (order || contacts->number == 0));
+	Build_Lookup(contacts);
+	//前缀索引与倒排索引只按下标记录联系人，键没有改变，因此只需按排列改写下标，无需重新切分键
+	if (contacts->searchable)
+	{
+		Permute_RadixTree(&contacts->nameRadix, order, contacts->number);
+		Permute_RadixTree(&contacts->phoneRadix, order, contacts->number);
+		Permute_RadixTree(&contacts->addressRadix, order, contacts->number);
+		Permute_GramIndex(&contacts->gramIndex, order, contacts->number);
+	}
+}
+
+//启用模糊查找(构建前缀索引与"n-gram"倒排索引，此后添加、删除与更改联系人时同步更新)
+void Enable_Search(Contacts* contacts)
+{
+	assert(contacts);
+	if (!contacts->searchable)
+	{
+		contacts->searchable = true;
+		Build_Search(contacts);
+	}
+}
+
+//前缀查找(姓名、电话或地址以"prefix"开头，依次在姓名、电话、地址中查找，返回最多"k"个不同联系人的下标)
+size_t Prefix_Contacts(const Contacts* contacts, const char* prefix, int* result, size_t k)
+{
+	assert(contacts && contacts->searchable && prefix && (result || k == 0));
+	const RadixTree* trees[] = { &contacts->nameRadix, &contacts->phoneRadix, &contacts->addressRadix };
+	size_t count = 0;
+	for (size_t i = 0; i < sizeof(trees) / sizeof(trees[0]) && count < k; i++)
+	{
+		//同一个联系人可能有多个字段以"prefix"开头，只保留第一次出现
+		size_t begin = count, end = count + Prefix_RadixTree(trees[i], prefix, result + count, k - count);
+		for (size_t j = begin; j < end; j++)
+		{
+			bool repeated = false;
+			for (size_t m = 0; m < begin && !repeated; m++)
+			{
+				repeated = result[m] == result[j];
+			}
+			if (!repeated)
+			{
+				result[count++] = result[j];
+			}
+		}
+	}
+	return count;
+}
+
+//模糊查找(按共同三元组个数从多到少返回最多"k"个联系人的下标，查询串少于三个字符时退化为前缀查找)
+size_t Fuzzy_Contacts(const Contacts* contacts, const char* text, int* result, size_t k)
+{
+	assert(contacts && contacts->searchable && text && (result || k == 0));
+	if (strlen(text) < GRAM_SIZE)
+	{
+		return Prefix_Contacts(contacts, text, result, k);
+	}
+	return Search_GramIndex(&contacts->gramIndex, text, result, NULL, k);
+}
+
+//压缩(将全部联系人写入快照并清空日志)
+void Compact_Contacts(Contacts* contacts)
+{
+	assert(contacts);
+	FILE* ptr = fopen(contacts->tempPath, "wb");
+	if (ptr == NULL)
+	{
+		perror("Compact_Contacts");
+		return;
+	}
+	size_t count = (size_t)contacts->number;
+	ContactsHeader header;
+	memset(&header, 0, sizeof(ContactsHeader));
+	memcpy(header.magic, CONTACTS_MAGIC, sizeof(header.magic));
+	header.version = CONTACTS_VERSION;
+	header.recordSize = sizeof(Information);
+	header.count = count;
+	header.checksum = Checksum_Contacts(contacts->people, count * sizeof(Information));
+	bool written = fwrite(&header, sizeof(ContactsHeader), 1, ptr) == 1
+			&& fwrite(contacts->people, sizeof(Information), count, ptr) == count
+			&& Sync_File(ptr);
+	if (fclose(ptr) != 0 || !written)
+	{
+		perror("Compact_Contacts");
+		remove(contacts->tempPath);
+		return;
+	}
+	//临时快照已刷新到磁盘，先删除日志再替换快照，任何一步崩溃后重新打开时都能从快照加日志或临时快照中恢复
+	if (contacts->log != NULL)
+	{
+		fclose(contacts->log);
+		contacts->log = NULL;
+	}
+	remove(contacts->logPath);
+#if defined(_WIN32)
+	//"Windows"下"rename"不能覆盖已存在的文件
+	remove(contacts->dataPath);
+#endif
+	if (rename(contacts->tempPath, contacts->dataPath) != 0)
+	{
+		perror("Compact_Contacts");
+	}
+	contacts->log = fopen(contacts->logPath, "ab");
+	if (contacts->log == NULL)
+	{
+		perror("Compact_Contacts");
+	}
+	contacts->logCount = 0;
+}
+
+//获取当前时间(单位：秒)
+static double Now_Contacts()
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//生成下一个64位伪随机数(SplitMix64)
+static unsigned long long Next_Random(unsigned long long* state)
+{
+	unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+//生成第"id"个联系人的随机信息
+static void Random_Information(Information* info, int id, unsigned long long* state)
+{
+	memset(info, 0, sizeof(Information));
+	unsigned long long random = Next_Random(state);
+	snprintf(info->name, MAX_NAME, "Name%08d", id);
+	snprintf(info->sex, MAX_SEX, "%s", random & 1 ? "Male" : "Female");
+	snprintf(info->phone, MAX_PHONE, "1%010llu", (random >> 8) % 10000000000ULL);
+	snprintf(info->address, MAX_ADDRESS, "No.%llu Street", (random >> 48) % 10000);
+	info->age = (int)((random >> 1) % 100);
+}
+
+//基准测试(生成"count"个联系人，测试保存、读取、查找与修改的耗时)
+void Bench_Contacts(int count)
+{
+	const char* data = "Contacts_Bench.dat";
+	const char* log = "Contacts_Bench.log";
+	const int lookups = 1000000, scans = 10, ranges = 1000, mutations = 1000;
+	Contacts contacts;
+	remove(data);
+	remove(log);
+	Open_Contacts(&contacts, data, log);
+	unsigned long long state = 20240101;
+	double megabytes = (double)count * sizeof(Information) / (1 << 20);
+	printf("Count：%d，Size：%lfMB\n", count, megabytes);
+
+	double begin = Now_Contacts();
+	for (int i = 0; i < count; i++)
+	{
+		Check_Capacity(&contacts);
+		Random_Information(contacts.people + contacts.number, i, &state);
+		contacts.number++;
+	}
+	printf("Generate：%lfs\n", Now_Contacts() - begin);
+	begin = Now_Contacts();
+	Build_Index(&contacts);
+	printf("Build Index：%lfs\n", Now_Contacts() - begin);
+	begin = Now_Contacts();
+	Compact_Contacts(&contacts);
+	double elapsed = Now_Contacts() - begin;
+	printf("Save(Snapshot)：%lfs，%lfMB/s\n", elapsed, megabytes / elapsed);
+	Remove_Contacts(&contacts);
+
+	//单独测试读取快照(一次性读入并检查校验和)的耗时
+	Contacts snapshot = { 0 };
+	FILE* ptr = fopen(data, "rb");
+	begin = Now_Contacts();
+	bool succeed = ptr != NULL && Load_Snapshot(&snapshot, ptr) && snapshot.number == count;
+	elapsed = Now_Contacts() - begin;
+	printf("Load(Snapshot)：%lfs，%lfMB/s\n", elapsed, megabytes / elapsed);
+	if (ptr != NULL)
+	{
+		fclose(ptr);
+	}
+	free(snapshot.people);
+	begin = Now_Contacts();
+	Open_Contacts(&contacts, data, log);
+	printf("Load(Snapshot + Index)：%lfs\n", Now_Contacts() - begin);
+	succeed = succeed && contacts.number == count;
+
+	//准备查找的键(避免在计时中格式化字符串)
+	char (* names)[MAX_NAME] = (char (*)[MAX_NAME])malloc(sizeof(*names) * lookups);
+	char (* phones)[MAX_PHONE] = (char (*)[MAX_PHONE])malloc(sizeof(*phones) * lookups);
+	if (names == NULL || phones == NULL)
+	{
+		perror("Bench_Contacts");
+		exit(EXIT_FAILURE);
+	}
+	for (int i = 0; i < lookups && count > 0; i++)
+	{
+		int index = (int)(Next_Random(&state) % (unsigned long long)count);
+		memcpy(names[i], contacts.people[index].name, MAX_NAME);
+		memcpy(phones[i], contacts.people[index].phone, MAX_PHONE);
+	}
+	int found = 0;
+	begin = Now_Contacts();
+	for (int i = 0; i < lookups && count > 0; i++)
+	{
+		found += Find_Contacts(&contacts, names[i]) != -1;
+	}
+	elapsed = Now_Contacts() - begin;
+	printf("Lookup(Name Hash)：%d/%d found，%lfns/op\n", found, lookups, elapsed * 1e9 / lookups);
+	succeed = succeed && (count == 0 || found == lookups);
+	found = 0;
+	begin = Now_Contacts();
+	for (int i = 0; i < lookups && count > 0; i++)
+	{
+		found += Find_Phone_Contacts(&contacts, phones[i]) != -1;
+	}
+	elapsed = Now_Contacts() - begin;
+	printf("Lookup(Phone Order)：%d/%d found，%lfns/op\n", found, lookups, elapsed * 1e9 / lookups);
+	succeed = succeed && (count == 0 || found == lookups);
+	found = 0;
+	begin = Now_Contacts();
+	for (int i = 0; i < scans && count > 0; i++)
+	{
+		for (int j = 0; j < contacts.number; j++)
+		{
+			if (strcmp(names[i], contacts.people[j].name) == 0)
+			{
+				found++;
+				break;
+			}
+		}
+	}
+	elapsed = Now_Contacts() - begin;
+	printf("Lookup(Linear Scan)：%d/%d found，%lfns/op\n", found, scans, elapsed * 1e9 / scans);
+	size_t total = 0;
+	begin = Now_Contacts();
+	for (int i = 0; i < ranges; i++)
+	{
+		int low = (int)(Next_Random(&state) % 100);
+		total += Count_Age_Contacts(&contacts, low, low + 9);
+	}
+	elapsed = Now_Contacts() - begin;
+	printf("Range(Age Order)：%zu matched，%lfns/op\n", total, elapsed * 1e9 / ranges);
+
+	//添加、更改与删除各占三分之一，每次操作追加一条日志
+	Information info;
+	int expected = contacts.number;
+	begin = Now_Contacts();
+	for (int i = 0; i < mutations; i++)
+	{
+		if (i % 3 == 0 || contacts.number == 0)
+		{
+			Random_Information(&info, count + i, &state);
+			Insert_Contacts(&contacts, &info);
+			expected++;
+		}
+		else if (i % 3 == 1)
+		{
+			int index = (int)(Next_Random(&state) % (unsigned long long)contacts.number);
+			Random_Information(&info, count + i, &state);
+			Update_Contacts(&contacts, index, &info);
+		}
+		else
+		{
+			Erase_Contacts(&contacts, (int)(Next_Random(&state) % (unsigned long long)contacts.number));
+			expected--;
+		}
+	}
+	elapsed = Now_Contacts() - begin;
+	printf("Mutation(Append Log)：%d ops，%lfus/op\n", mutations, elapsed * 1e6 / mutations);
+	begin = Now_Contacts();
+	Save_Contacts(&contacts);
+	printf("Save(Log)：%lfs\n", Now_Contacts() - begin);
+	Information last = contacts.people[contacts.number - 1];
+	Remove_Contacts(&contacts);
+	begin = Now_Contacts();
+	Open_Contacts(&contacts, data, log);
+	printf("Load(Snapshot + Log + Index)：%lfs\n", Now_Contacts() - begin);
+	succeed = succeed && contacts.number == expected;
+	succeed = succeed && Find_Contacts(&contacts, last.name) == contacts.number - 1;
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
+
+	free(names);
+	free(phones);
+	Remove_Contacts(&contacts);
+	remove(data);
+	remove(log);
+}
+
+//比较器(用于对延迟排序)
+static int Compar_Double(const void* p1, const void* p2)
+{
+	return (*(const double*)p1 > *(const double*)p2) - (*(const double*)p1 < *(const double*)p2);
+}
+
+//打印延迟的平均值、中位数与"p99"(单位：微秒)
+static void Print_Latency(const char* name, double* times, int count, size_t found)
+{
+	double sum = 0;
+	for (int i = 0; i < count; i++)
+	{
+		sum += times[i];
+	}
+	qsort(times, (size_t)count, sizeof(double), Compar_Double);
+	printf("%-24s%-12.3lf%-12.3lf%-12.3lf%zu\n", name, sum / count * 1e6, times[count / 2] * 1e6, times[count * 99 / 100] * 1e6, found);
+}
+
+//判断联系人的姓名、电话或地址是否包含查询串的每一个三元组(英文字母不区分大小写，即模糊查找的满分)
+static bool Match_Grams(const Information* person, const char* text)
+{
+	const char* fields[] = { person->name, person->phone, person->address };
+	size_t length = strlen(text);
+	for (size_t i = 0; i + GRAM_SIZE <= length; i++)
+	{
+		bool matched = false;
+		for (int j = 0; j < 3 && !matched; j++)
+		{
+			for (const char* p = fields[j]; *p != '\0' && !matched; p++)
+			{
+				size_t m = 0;
+				while (m < GRAM_SIZE && p[m] != '\0' && tolower((unsigned char)p[m]) == tolower((unsigned char)text[i + m]))
+				{
+					m++;
+				}
+				matched = m == GRAM_SIZE;
+			}
+		}
+		if (!matched)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//生成第"id"个联系人的随机信息(姓名由姓与名组成，会有重名)
+static void Random_Person(Information* info, unsigned long long* state)
+{
+	static const char* surnames[] = { "Zhang", "Wang", "Li", "Zhao", "Chen", "Liu", "Yang", "Huang", "Zhou", "Wu", "Xu", "Sun", "Ma", "Zhu", "Hu", "Guo", "He", "Lin", "Luo", "Gao" };
+	static const char* givens[] = { "Wei", "Fang", "Na", "Min", "Jing", "Li", "Qiang", "Lei", "Jun", "Yang", "Yong", "Yan", "Jie", "Tao", "Ming", "Chao", "Xiu", "Xia", "Ping", "Gang", "Hui", "Hua", "Fei", "Bo", "Yu", "Hao", "Xin", "Lan", "Ting", "Kai" };
+	static const char* cities[] = { "Beijing", "Shanghai", "Guangzhou", "Shenzhen", "Chengdu", "Hangzhou", "Wuhan", "Xian", "Nanjing", "Tianjin" };
+	static const char* streets[] = { "Renmin", "Jiefang", "Zhongshan", "Heping", "Jianshe", "Xinhua", "Changjiang", "Huaihai", "Nanjing", "Beijing", "Dongfeng", "Chaoyang", "Wenhua", "Xingfu", "Yingbin", "Binhe" };
+	const size_t surnameCount = sizeof(surnames) / sizeof(surnames[0]);
+	const size_t givenCount = sizeof(givens) / sizeof(givens[0]);
+	memset(info, 0, sizeof(Information));
+	unsigned long long random = Next_Random(state);
+	unsigned long long more = Next_Random(state);
+	snprintf(info->name, MAX_NAME, "%s%s%s",
+			surnames[random % surnameCount],
+			givens[(random >> 8) % givenCount],
+			(random >> 16) & 1 ? givens[(random >> 24) % givenCount] : ""
+	);
+	snprintf(info->sex, MAX_SEX, "%s", (random >> 32) & 1 ? "Male" : "Female");
+	snprintf(info->phone, MAX_PHONE, "1%llu%09llu", 3 + (random >> 33) % 7, more % 1000000000ULL);
+	snprintf(info->address, MAX_ADDRESS, "%s-%s-Rd-No.%llu",
+			cities[(more >> 32) % (sizeof(cities) / sizeof(cities[0]))],
+			streets[(more >> 40) % (sizeof(streets) / sizeof(streets[0]))],
+			1 + (more >> 48) % 999
+	);
+	info->age = (int)((random >> 40) % 100);
+}
+
+//模糊查找基准测试(生成"count"个联系人，测试前缀查找与模糊查找的延迟)
+void Bench_Search(int count)
+{
+	const char* data = "Contacts_Search.dat";
+	const char* log = "Contacts_Search.log";
+	const int queries = 10000, scans = 10, mutations = 1000;
+	Contacts contacts;
+	remove(data);
+	remove(log);
+	Open_Contacts(&contacts, data, log);
+	unsigned long long state = 20240102;
+	for (int i = 0; i < count; i++)
+	{
+		Check_Capacity(&contacts);
+		Random_Person(contacts.people + contacts.number, &state);
+		contacts.number++;
+	}
+	Build_Index(&contacts);
+	double begin = Now_Contacts();
+	Enable_Search(&contacts);
+	printf("Count：%d，Build Search Index：%lfs，Grams：%zu\n", count, Now_Contacts() - begin, contacts.gramIndex.size);
+
+	double* times = (double*)malloc(sizeof(double) * queries);
+	char (* texts)[MAX_ADDRESS] = (char (*)[MAX_ADDRESS])malloc(sizeof(*texts) * queries);
+	if (times == NULL || texts == NULL)
+	{
+		perror("Bench_Search");
+		exit(EXIT_FAILURE);
+	}
+	int result[SEARCH_TOP_K];
+	bool succeed = count > 0;
+	printf("%-24s%-12s%-12s%-12s%s\n", "Query(Top-10)", "Mean(us)", "P50(us)", "P99(us)", "Found");
+	for (int kind = 0; kind < 4 && count > 0; kind++)
+	{
+		//准备查询串：0.姓名前缀 1.电话片段 2.地址片段 3.拼错一个字母的姓名
+		for (int i = 0; i < queries; i++)
+		{
+			const Information* person = contacts.people + Next_Random(&state) % (unsigned long long)count;
+			unsigned long long random = Next_Random(&state);
+			switch (kind)
+			{
+			case 0:
+				snprintf(texts[i], MAX_ADDRESS, "%.*s", (int)(3 + random % 3), person->name);
+				break;
+			case 1:
+				snprintf(texts[i], MAX_ADDRESS, "%.4s", person->phone + 1 + random % 7);
+				break;
+			case 2:
+				snprintf(texts[i], MAX_ADDRESS, "%.8s", person->address + random % (strlen(person->address) - 7));
+				break;
+			default:
+				snprintf(texts[i], MAX_ADDRESS, "%s", person->name);
+				texts[i][1 + random % (strlen(texts[i]) - 1)] = (char)('a' + (random >> 8) % 26);
+				break;
+			}
+		}
+		size_t found = 0;
+		for (int i = 0; i < queries; i++)
+		{
+			double start = Now_Contacts();
+			size_t n = kind == 0 ? Prefix_Contacts(&contacts, texts[i], result, SEARCH_TOP_K) : Fuzzy_Contacts(&contacts, texts[i], result, SEARCH_TOP_K);
+			times[i] = Now_Contacts() - start;
+			found += n != 0;
+			//前缀查找的结果必须以查询串开头，片段查找的第一个结果必须包含查询串的全部三元组(三元组不一定相连)
+			for (size_t j = 0; j < n && kind == 0; j++)
+			{
+				const Information* person = contacts.people + result[j];
+				size_t length = strlen(texts[i]);
+				succeed = succeed && (strncmp(person->name, texts[i], length) == 0 || strncmp(person->phone, texts[i], length) == 0 || strncmp(person->address, texts[i], length) == 0);
+			}
+			if ((kind == 1 || kind == 2) && n > 0)
+			{
+				succeed = succeed && Match_Grams(contacts.people + result[0], texts[i]);
+			}
+		}
+		const char* names[] = { "Prefix(Name)", "Fuzzy(Phone Fragment)", "Fuzzy(Address Fragment)", "Fuzzy(Name Typo)" };
+		Print_Latency(names[kind], times, queries, found);
+		succeed = succeed && (kind == 3 || found == (size_t)queries);
+	}
+
+	//对照：逐个比较三个字段是否包含查询串
+	begin = Now_Contacts();
+	size_t found = 0;
+	for (int i = 0; i < scans && count > 0; i++)
+	{
+		size_t n = 0;
+		for (int j = 0; j < contacts.number && n < SEARCH_TOP_K; j++)
+		{
+			const Information* person = contacts.people + j;
+			if (strstr(person->name, texts[i]) != NULL || strstr(person->phone, texts[i]) != NULL || strstr(person->address, texts[i]) != NULL)
+			{
+				result[n++] = j;
+			}
+		}
+		found += n != 0;
+	}
+	printf("%-24s%-12.3lf%-12s%-12s%zu\n", "Linear Scan(Name Typo)", (Now_Contacts() - begin) / scans * 1e6, "-", "-", found);
+
+	//添加、更改与删除各占三分之一，同步更新全部索引
+	Information info;
+	begin = Now_Contacts();
+	for (int i = 0; i < mutations; i++)
+	{
+		Random_Person(&info, &state);
+		if (i % 3 == 0 || contacts.number == 0)
+		{
+			Insert_Contacts(&contacts, &info);
+		}
+		else if (i % 3 == 1)
+		{
+			Update_Contacts(&contacts, (int)(Next_Random(&state) % (unsigned long long)contacts.number), &info);
+		}
+		else
+		{
+			Erase_Contacts(&contacts, (int)(Next_Random(&state) % (unsigned long long)contacts.number));
+		}
+	}
+	printf("Mutation(All Index)：%d ops，%lfus/op\n", mutations, (Now_Contacts() - begin) * 1e6 / mutations);
+	info = contacts.people[contacts.number - 1];
+	size_t n = Fuzzy_Contacts(&contacts, info.address, result, SEARCH_TOP_K);
+	bool listed = false;
+	for (size_t i = 0; i < n; i++)
+	{
+		listed = listed || strcmp(contacts.people[result[i]].address, info.address) == 0;
+	}
+	succeed = succeed && listed && Prefix_Contacts(&contacts, info.phone, result, SEARCH_TOP_K) > 0;
+
+	//排序后按排列改写的前缀索引与倒排索引必须与重新构建的索引给出相同的得分与键(得分或键相同时顺序可以不同)
+	static const int byName[] = { SORT_NAME };
+	begin = Now_Contacts();
+	Order_Contacts(&contacts, byName, 1);
+	printf("Order(Name + Compact)：%lfs\n", Now_Contacts() - begin);
+	//每个查询记录模糊查找的得分、姓名前缀查找结果的姓名哈希值与前缀匹配总数
+	typedef struct SearchCheck
+	{
+		int scores[SEARCH_TOP_K];
+		unsigned int names[SEARCH_TOP_K];
+		size_t fuzzy;
+		size_t prefixed;
+		size_t total;
+	} SearchCheck;
+	const int checks = queries < 1000 ? queries : 1000;
+	SearchCheck* before = (SearchCheck*)malloc(sizeof(SearchCheck) * checks);
+	if (before == NULL)
+	{
+		perror("Bench_Search");
+		exit(EXIT_FAILURE);
+	}
+	for (int pass = 0; pass < 2; pass++)
+	{
+		for (int i = 0; i < checks; i++)
+		{
+			//"texts"中保存的是拼错一个字母的姓名，前缀取其前三个字符
+			SearchCheck current = { 0 };
+			char prefix[GRAM_SIZE + 1];
+			snprintf(prefix, sizeof(prefix), "%s", texts[i]);
+			current.fuzzy = Search_GramIndex(&contacts.gramIndex, texts[i], result, current.scores, SEARCH_TOP_K);
+			current.prefixed = Prefix_RadixTree(&contacts.nameRadix, prefix, result, SEARCH_TOP_K);
+			for (size_t j = 0; j < current.prefixed; j++)
+			{
+				current.names[j] = Hash_String(contacts.people[result[j]].name);
+			}
+			current.total = Count_RadixTree(&contacts.nameRadix, prefix);
+			if (pass == 0)
+			{
+				before[i] = current;
+				continue;
+			}
+			succeed = succeed && memcmp(&current, before + i, sizeof(SearchCheck)) == 0;
+		}
+		Build_Index(&contacts);
+	}
+	free(before);
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
+
+	free(times);
+	free(texts);
+	Remove_Contacts(&contacts);
+	remove(data);
+	remove(log);
+}
+
+//"qsort"比较器使用的关键字列表(仅用于基准测试)
+static const int* benchKeys;
+static int benchKeyCount;
+
+//比较器(按"benchKeys"比较联系人)
+static int Compar_Keys(const void* p1, const void* p2)
+{
+	return Compare_Keys((const Information*)p1, (const Information*)p2, benchKeys, benchKeyCount);
+}
+
+//排序基准测试(生成"count"个联系人，比较"qsort"与基数排序的耗时)
+void Bench_Sort(int count)
+{
+	static const int byName[] = { SORT_NAME };
+	static const int byNameAgePhone[] = { SORT_NAME, SORT_AGE, SORT_PHONE };
+	static const int byAgeNamePhone[] = { SORT_AGE, SORT_NAME, SORT_PHONE };
+	static const int byPhone[] = { SORT_PHONE };
+	const int* lists[] = { byName, byNameAgePhone, byAgeNamePhone, byPhone };
+	const int counts[] = { 1, 3, 3, 1 };
+	const char* names[] = { "Name", "Name, Age, Phone", "Age, Name, Phone", "Phone" };
+	size_t size = sizeof(Information) * (size_t)(count > 0 ? count : 1);
+	Information* origin = (Information*)malloc(size);
+	Information* expected = (Information*)malloc(size);
+	Information* people = (Information*)malloc(size);
+	if (origin == NULL || expected == NULL || people == NULL)
+	{
+		perror("Bench_Sort");
+		exit(EXIT_FAILURE);
+	}
+	unsigned long long state = 20240103;
+	for (int i = 0; i < count; i++)
+	{
+		Random_Person(origin + i, &state);
+	}
+	bool succeed = true;
+	printf("Count：%d\n", count);
+	printf("%-20s%-14s%-14s%s\n", "Keys", "qsort(s)", "Radix(s)", "Speedup");
+	for (int t = 0; t < (int)(sizeof(lists) / sizeof(lists[0])); t++)
+	{
+		memcpy(expected, origin, sizeof(Information) * (size_t)count);
+		benchKeys = lists[t];
+		benchKeyCount = counts[t];
+		double begin = Now_Contacts();
+		qsort(expected, (size_t)count, sizeof(Information), t == 0 ? Compar_Name : Compar_Keys);
+		double base = Now_Contacts() - begin;
+		memcpy(people, origin, sizeof(Information) * (size_t)count);
+		begin = Now_Contacts();
+		Sort_Information(people, count, lists[t], counts[t], NULL);
+		double radix = Now_Contacts() - begin;
+		printf("%-20s%-14.6lf%-14.6lf%.2lfx\n", names[t], base, radix, radix > 0 ? base / radix : 0);
+		//关键字序列必须与"qsort"的结果一致
+		for (int i = 0; i < count && succeed; i++)
+		{
+			succeed = Compare_Keys(people + i, expected + i, lists[t], counts[t]) == 0;
+		}
+	}
+	//稳定性：按年龄排序后，年龄相同的联系人保持原有顺序(原有顺序按姓名、电话排列)
+	static const int byNamePhone[] = { SORT_NAME, SORT_PHONE };
+	static const int byAge[] = { SORT_AGE };
+	Sort_Information(origin, count, byNamePhone, 2, NULL);
+	Sort_Information(origin, count, byAge, 1, NULL);
+	for (int i = 1; i < count && succeed; i++)
+	{
+		succeed = Compare_Keys(origin + i - 1, origin + i, byAgeNamePhone, 3) <= 0;
+	}
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
+
+	free(origin);
+	free(expected);
+	free(people);
 }
\ No newline at end of file
@@ -1,10 +1,38 @@
 #pragma once
 
+//关闭"MSVC"对"fopen"、"scanf"等函数的安全警告
+#if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
 //引用头文件
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <Windows.h>
+#include <limits.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <time.h>
+#include <ctype.h>
+
+//引用索引头文件
+#include "./Index/Index.h"
+#include "./Index/Radix.h"
+#include "./Index/Gram.h"
+
+/*
+ * 通讯录(记录存储)
+ * 1. 联系人保存在按倍数扩容的数组中，姓名建立哈希索引，电话与年龄建立有序索引，查找时不再逐个比较。
+ * 2. 删除联系人时用最后一个联系人填补空位，因此删除的时间复杂度为：O(1)(有序索引中只移动块内的下标)，但联系人的顺序会改变。
+ * 3. 持久化由快照文件与只追加的日志文件组成：添加、删除与更改只向日志追加一条记录，而不是重写整个文件。
+ * 4. 日志中的记录数超过"COMPACT_MIN_LOG"且超过联系人数的一半时压缩：将全部联系人写入临时快照，删除日志后以临时快照替换快照。
+ * 5. 打开通讯录时读取快照并重放日志(重放时不维护索引，结束后一次性构建)；若日志已删除而临时快照仍在，说明上次压缩未完成替换，使用临时快照。
+ * 6. 快照文件由文件头与联系人数组组成，文件头记录格式版本、联系人大小、联系人数与校验和；读取时按联系人数一次性分配数组并一次性读入，写入时一次性写出并在替换前刷新到磁盘。
+ * 7. 没有文件头的旧格式快照(只有联系人数组)仍可读取，下次压缩时转换为新格式。
+ * 8. 启用模糊查找后，姓名、电话与地址各建立一棵基数树(前缀查找)，三个字段共同建立一个"n-gram"倒排索引(模糊查找)，添加、删除与更改联系人时同步更新。
+ *    这两种索引占用的内存较多，因此只在需要时启用(菜单程序默认启用)。
+ * 9. 排序支持多个关键字(姓名、年龄、电话)：只对(关键字前缀, 下标)对组成的紧凑数组做基数排序，前缀相同的组再按下一段前缀或下一个关键字排序，最后按排列一次性移动联系人。
+ */
 
 //定义标识符
 #define MAX 10
@@ -12,8 +40,17 @@
 #define MAX_NAME 20
 #define MAX_PHONE 20
 #define MAX_ADDRESS 50
-#define EXPAND_SIZE 5
+#define EXPAND_FACTOR 2
 #define DEFAULT_SIZE 5
+#define COMPACT_MIN_LOG 1024
+#define CONTACTS_MAX_PATH 260
+#define CONTACTS_DATA "Contacts.dat"
+#define CONTACTS_LOG "Contacts.log"
+#define CONTACTS_MAGIC "CTDB"
+#define CONTACTS_VERSION 1
+#define SEARCH_TOP_K 10
+#define SORT_MAX_KEYS 3
+#define SORT_SMALL 32
 
 //定义枚举类型(选项)
 enum Option
@@ -27,6 +64,22 @@ enum Option
 	PRINT
 };
 
+//定义枚举类型(日志操作)
+enum LogOperation
+{
+	LOG_ADD = 1,
+	LOG_DEL,
+	LOG_MODIFY
+};
+
+//定义枚举类型(排序关键字)
+enum SortKey
+{
+	SORT_NAME = 1,
+	SORT_AGE,
+	SORT_PHONE
+};
+
 //定义结构体类型(信息)
 typedef struct Information
 {
@@ -44,23 +97,65 @@ typedef struct Information
 //	int number;
 //}Contacts;
 
+//定义结构体类型(快照文件头)
+typedef struct ContactsHeader
+{
+	char magic[4];
+	unsigned int version;
+	unsigned int recordSize;
+	unsigned int reserved;
+	unsigned long long count;
+	unsigned long long checksum;
+} ContactsHeader;
+
+//定义结构体类型(日志记录)
+typedef struct LogEntry
+{
+	int operation;
+	int index;
+	Information info;
+} LogEntry;
+
 //定义结构体类型(通讯录)(动态)
 typedef struct Contacts
 {
 	Information* people;
 	int number;
 	int capacity;
+	HashIndex nameIndex;
+	OrderIndex phoneIndex;
+	OrderIndex ageIndex;
+	RadixTree nameRadix;
+	RadixTree phoneRadix;
+	RadixTree addressRadix;
+	GramIndex gramIndex;
+	bool indexed;
+	bool searchable;
+	FILE* log;
+	int logCount;
+	char dataPath[CONTACTS_MAX_PATH];
+	char tempPath[CONTACTS_MAX_PATH];
+	char logPath[CONTACTS_MAX_PATH];
 } Contacts;
 
 //菜单
 void Menu();
 
+//读取整数(输入无效时丢弃该行并返回"false")
+bool Scan_Int(int* value);
+
+//读取字符串(最多读取"size - 1"个字符)
+bool Scan_String(char* str, int size);
+
 //清屏
 void Clear();
 
 //初始化通讯录
 void Init_Contacts(Contacts* contacts);
 
+//打开通讯录("data"为快照文件，"log"为日志文件)
+void Open_Contacts(Contacts* contacts, const char* data, const char* log);
+
 //添加联系人的信息
 void Add_Contacts(Contacts* contacts);
 
@@ -89,4 +184,55 @@ void Remove_Contacts(Contacts* contacts);
 void Read_Contacts(Contacts* contacts);
 
 //保存通讯录至文件
-void Save_Contacts(Contacts* contacts);
\ No newline at end of file
+void Save_Contacts(Contacts* contacts);
+
+//插入联系人(返回其下标)
+int Insert_Contacts(Contacts* contacts, const Information* info);
+
+//删除下标为"index"的联系人(最后一个联系人移动到该位置)
+void Erase_Contacts(Contacts* contacts, int index);
+
+//更改下标为"index"的联系人
+void Update_Contacts(Contacts* contacts, int index, const Information* info);
+
+//按姓名查找联系人(返回下标，不存在时返回"-1")
+int Find_Contacts(const Contacts* contacts, const char* name);
+
+//按电话查找联系人(返回下标，不存在时返回"-1")
+int Find_Phone_Contacts(const Contacts* contacts, const char* phone);
+
+//统计年龄在"[low, high]"内的联系人个数
+size_t Count_Age_Contacts(const Contacts* contacts, int low, int high);
+
+//计算校验和(每次处理"8"字节的"FNV"风格64位校验和)
+unsigned long long Checksum_Contacts(const void* data, size_t size);
+
+//构建全部索引
+void Build_Index(Contacts* contacts);
+
+//联系人按排列重新排列后更新全部索引(第"i"个位置的联系人原下标为"order[i]")
+void Reorder_Index(Contacts* contacts, const int* order);
+
+//启用模糊查找(构建前缀索引与"n-gram"倒排索引，此后添加、删除与更改联系人时同步更新)
+void Enable_Search(Contacts* contacts);
+
+//前缀查找(姓名、电话或地址以"prefix"开头，依次在姓名、电话、地址中查找，返回最多"k"个不同联系人的下标)
+size_t Prefix_Contacts(const Contacts* contacts, const char* prefix, int* result, size_t k);
+
+//模糊查找(按共同三元组个数从多到少返回最多"k"个联系人的下标，查询串少于三个字符时退化为前缀查找)
+size_t Fuzzy_Contacts(const Contacts* contacts, const char* text, int* result, size_t k);
+
+//按关键字列表排序联系人(依次比较"keys"中的"keyCount"个关键字，全部相同时保持原有顺序)，排序后更新索引并压缩
+void Order_Contacts(Contacts* contacts, const int* keys, int keyCount);
+
+//压缩(将全部联系人写入快照并清空日志)
+void Compact_Contacts(Contacts* contacts);
+
+//基准测试(生成"count"个联系人，测试保存、读取、查找与修改的耗时)
+void Bench_Contacts(int count);
+
+//模糊查找基准测试(生成"count"个联系人，测试前缀查找与模糊查找的延迟)
+void Bench_Search(int count);
+
+//排序基准测试(生成"count"个联系人，比较"qsort"与基数排序的耗时)
+void Bench_Sort(int count);
\ No newline at end of file
@@ -0,0 +1,542 @@
+#include "Gram.h"
+
+#include <limits.h>
+
+//初始化倒排索引("keys"为"fieldCount"个字段的回调函数，返回的键必须为字符串)
+void Init_GramIndex(GramIndex* ptr, const void* context, const IndexKey* keys, int fieldCount)
+{
+	assert(ptr && keys && fieldCount > 0 && fieldCount <= GRAM_MAX_FIELDS);
+	ptr->codes = NULL;
+	ptr->slots = NULL;
+	ptr->capacity = 0;
+	ptr->lists = NULL;
+	ptr->size = ptr->listCapacity = 0;
+	ptr->ids = ptr->records = NULL;
+	ptr->idCapacity = ptr->recordCapacity = 0;
+	ptr->nextId = ptr->live = 0;
+	ptr->context = context;
+	for (int i = 0; i < fieldCount; i++)
+	{
+		ptr->keys[i] = keys[i];
+	}
+	ptr->fieldCount = fieldCount;
+}
+
+//转换为小写(只转换英文字母，不受区域设置影响)
+static unsigned int Lower_Gram(char ch)
+{
+	unsigned char c = (unsigned char)ch;
+	return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+}
+
+//将字符串切分为三元组并追加到"grams"中，返回三元组个数
+static int Split_Gram(const char* text, unsigned int* grams, int count)
+{
+	size_t length = strlen(text);
+	for (size_t i = 0; i + GRAM_SIZE <= length && count < GRAM_MAX_GRAMS; i++)
+	{
+		grams[count++] = Lower_Gram(text[i]) << 16 | Lower_Gram(text[i + 1]) << 8 | Lower_Gram(text[i + 2]);
+	}
+	return count;
+}
+
+//排序并去除重复的三元组，返回不同三元组的个数
+static int Unique_Gram(unsigned int* grams, int count)
+{
+	for (int i = 1; i < count; i++)
+	{
+		unsigned int gram = grams[i];
+		int j = i - 1;
+		for (; j >= 0 && grams[j] > gram; j--)
+		{
+			grams[j + 1] = grams[j];
+		}
+		grams[j + 1] = gram;
+	}
+	int size = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (size == 0 || grams[size - 1] != grams[i])
+		{
+			grams[size++] = grams[i];
+		}
+	}
+	return size;
+}
+
+//取得下标为"index"的联系人的全部不同三元组
+static int Record_Gram(const GramIndex* ptr, int index, unsigned int* grams)
+{
+	int count = 0;
+	for (int i = 0; i < ptr->fieldCount; i++)
+	{
+		count = Split_Gram((const char*)ptr->keys[i](ptr->context, index), grams, count);
+	}
+	return Unique_Gram(grams, count);
+}
+
+//计算三元组在哈希表中的起始位置
+static size_t Home_Gram(const GramIndex* ptr, unsigned int code)
+{
+	unsigned int hash = code * 2654435761u;
+	return (size_t)(hash ^ (hash >> 16)) & (ptr->capacity - 1);
+}
+
+//查找三元组的倒排表，不存在时返回"-1"
+static int Find_List(const GramIndex* ptr, unsigned int code)
+{
+	if (ptr->size == 0)
+	{
+		return -1;
+	}
+	for (size_t pos = Home_Gram(ptr, code); ptr->codes[pos] != 0; pos = (pos + 1) & (ptr->capacity - 1))
+	{
+		if (ptr->codes[pos] == code + 1)
+		{
+			return ptr->slots[pos];
+		}
+	}
+	return -1;
+}
+
+//重新分配哈希表(槽中保存"三元组 + 1"，"0"表示空槽)
+static void Rehash_Gram(GramIndex* ptr, size_t capacity)
+{
+	unsigned int* codes = (unsigned int*)calloc(capacity, sizeof(unsigned int));
+	int* slots = (int*)malloc(sizeof(int) * capacity);
+	if (codes == NULL || slots == NULL)
+	{
+		perror("Rehash_Gram");
+		exit(EXIT_FAILURE);
+	}
+	unsigned int* oldCodes = ptr->codes;
+	int* oldSlots = ptr->slots;
+	size_t oldCapacity = ptr->capacity;
+	ptr->codes = codes;
+	ptr->slots = slots;
+	ptr->capacity = capacity;
+	for (size_t i = 0; i < oldCapacity; i++)
+	{
+		if (oldCodes[i] != 0)
+		{
+			size_t pos = Home_Gram(ptr, oldCodes[i] - 1);
+			while (codes[pos] != 0)
+			{
+				pos = (pos + 1) & (capacity - 1);
+			}
+			codes[pos] = oldCodes[i];
+			slots[pos] = oldSlots[i];
+		}
+	}
+	free(oldCodes);
+	free(oldSlots);
+}
+
+//取得三元组的倒排表，不存在时创建
+static int Get_List(GramIndex* ptr, unsigned int code)
+{
+	int id = Find_List(ptr, code);
+	if (id != -1)
+	{
+		return id;
+	}
+	if ((ptr->size + 1) * 4 > ptr->capacity * 3)
+	{
+		Rehash_Gram(ptr, ptr->capacity == 0 ? GRAM_MIN : ptr->capacity * 2);
+	}
+	if (ptr->size == ptr->listCapacity)
+	{
+		size_t capacity = ptr->listCapacity == 0 ? GRAM_MIN : ptr->listCapacity * 2;
+		GramList* tmp = (GramList*)realloc(ptr->lists, sizeof(GramList) * capacity);
+		if (tmp == NULL)
+		{
+			perror("Get_List");
+			exit(EXIT_FAILURE);
+		}
+		ptr->lists = tmp;
+		ptr->listCapacity = capacity;
+	}
+	size_t pos = Home_Gram(ptr, code);
+	while (ptr->codes[pos] != 0)
+	{
+		pos = (pos + 1) & (ptr->capacity - 1);
+	}
+	id = (int)ptr->size++;
+	ptr->codes[pos] = code + 1;
+	ptr->slots[pos] = id;
+	ptr->lists[id].data = NULL;
+	ptr->lists[id].size = ptr->lists[id].capacity = 0;
+	ptr->lists[id].bits = NULL;
+	ptr->lists[id].words = 0;
+	return id;
+}
+
+//编号范围为"[0, limit)"时，倒排表足够稠密则重建位图，否则释放位图
+static void Dense_List(GramList* list, int limit)
+{
+	free(list->bits);
+	list->bits = NULL;
+	list->words = 0;
+	if ((size_t)list->size * GRAM_DENSE < (size_t)limit)
+	{
+		return;
+	}
+	//位图预留一倍的空间，之后追加的编号不必每次扩容
+	list->words = (size_t)limit / 32 + 1;
+	list->bits = (unsigned long long*)calloc(list->words, sizeof(unsigned long long));
+	if (list->bits == NULL)
+	{
+		perror("Dense_List");
+		exit(EXIT_FAILURE);
+	}
+	for (int i = 0; i < list->size; i++)
+	{
+		list->bits[list->data[i] >> 6] |= 1ULL << (list->data[i] & 63);
+	}
+}
+
+//向倒排表末尾追加编号(新编号总是最大，因此倒排表保持升序)
+static void Append_List(GramList* list, int id)
+{
+	if (list->size == list->capacity)
+	{
+		int capacity = list->capacity == 0 ? 4 : list->capacity * 2;
+		int* tmp = (int*)realloc(list->data, sizeof(int) * capacity);
+		if (tmp == NULL)
+		{
+			perror("Append_List");
+			exit(EXIT_FAILURE);
+		}
+		list->data = tmp;
+		list->capacity = capacity;
+	}
+	list->data[list->size++] = id;
+	//位图容纳不下新编号，或者没有位图但已足够稠密时，按当前的编号范围重新判断
+	if ((size_t)(id >> 6) >= list->words)
+	{
+		if (list->bits != NULL || (size_t)list->size * GRAM_DENSE >= (size_t)id + 1)
+		{
+			Dense_List(list, id + 1);
+		}
+		return;
+	}
+	list->bits[id >> 6] |= 1ULL << (id & 63);
+}
+
+//判断编号是否在倒排表中(倒排表必须有位图)
+static bool Test_List(const GramList* list, int id)
+{
+	return (size_t)(id >> 6) < list->words && (list->bits[id >> 6] >> (id & 63) & 1) != 0;
+}
+
+//扩容整型数组至至少"count"个元素，新增的元素置为"-1"
+static int* Grow_Array(int* arr, size_t* capacity, size_t count)
+{
+	if (count <= *capacity)
+	{
+		return arr;
+	}
+	size_t newCapacity = *capacity == 0 ? GRAM_MIN : *capacity;
+	while (newCapacity < count)
+	{
+		newCapacity *= 2;
+	}
+	int* tmp = (int*)realloc(arr, sizeof(int) * newCapacity);
+	if (tmp == NULL)
+	{
+		perror("Grow_Array");
+		exit(EXIT_FAILURE);
+	}
+	memset(tmp + *capacity, 0xFF, sizeof(int) * (newCapacity - *capacity));
+	*capacity = newCapacity;
+	return tmp;
+}
+
+//压缩倒排索引：去掉已删除的编号，并将存活的编号按原顺序重新编为"[0, live)"
+static void Compact_GramIndex(GramIndex* ptr)
+{
+	int* remap = (int*)malloc(sizeof(int) * (ptr->nextId + 1));
+	if (remap == NULL)
+	{
+		perror("Compact_GramIndex");
+		exit(EXIT_FAILURE);
+	}
+	int next = 0;
+	for (int id = 0; id < ptr->nextId; id++)
+	{
+		remap[id] = -1;
+		if (ptr->records[id] != -1)
+		{
+			remap[id] = next;
+			ptr->records[next] = ptr->records[id];
+			ptr->ids[ptr->records[next]] = next;
+			next++;
+		}
+	}
+	memset(ptr->records + next, 0xFF, sizeof(int) * (ptr->nextId - next));
+	//编号的映射单调递增，过滤后倒排表仍然升序
+	for (size_t i = 0; i < ptr->size; i++)
+	{
+		GramList* list = ptr->lists + i;
+		int size = 0;
+		for (int j = 0; j < list->size; j++)
+		{
+			if (remap[list->data[j]] != -1)
+			{
+				list->data[size++] = remap[list->data[j]];
+			}
+		}
+		list->size = size;
+		Dense_List(list, next);
+	}
+	ptr->nextId = next;
+	free(remap);
+}
+
+//插入下标
+void Insert_GramIndex(GramIndex* ptr, int index)
+{
+	assert(ptr && index >= 0);
+	ptr->ids = Grow_Array(ptr->ids, &ptr->idCapacity, (size_t)index + 1);
+	ptr->records = Grow_Array(ptr->records, &ptr->recordCapacity, (size_t)ptr->nextId + 1);
+	int id = ptr->nextId++;
+	ptr->ids[index] = id;
+	ptr->records[id] = index;
+	ptr->live++;
+	unsigned int grams[GRAM_MAX_GRAMS];
+	int count = Record_Gram(ptr, index, grams);
+	for (int i = 0; i < count; i++)
+	{
+		//"Get_List"可能重新分配"lists"，因此先取得编号
+		int list = Get_List(ptr, grams[i]);
+		Append_List(ptr->lists + list, id);
+	}
+}
+
+//删除下标(只将编号标记为已删除，已删除的编号多于存活的编号时压缩)
+void Erase_GramIndex(GramIndex* ptr, int index)
+{
+	assert(ptr);
+	if (index < 0 || (size_t)index >= ptr->idCapacity || ptr->ids[index] == -1)
+	{
+		return;
+	}
+	ptr->records[ptr->ids[index]] = -1;
+	ptr->ids[index] = -1;
+	ptr->live--;
+	if (ptr->nextId - ptr->live > ptr->live && ptr->nextId - ptr->live > GRAM_MIN)
+	{
+		Compact_GramIndex(ptr);
+	}
+}
+
+//将下标"from"改为"to"(编号不变，倒排表无需修改)
+void Move_GramIndex(GramIndex* ptr, int from, int to)
+{
+	assert(ptr && to >= 0);
+	if (from < 0 || (size_t)from >= ptr->idCapacity || ptr->ids[from] == -1)
+	{
+		return;
+	}
+	ptr->ids = Grow_Array(ptr->ids, &ptr->idCapacity, (size_t)to + 1);
+	int id = ptr->ids[from];
+	ptr->ids[from] = -1;
+	ptr->ids[to] = id;
+	ptr->records[id] = to;
+}
+
+//按排列改写下标(下标"order[i]"改为"i"，"count"为下标总数，编号不变，不访问联系人)
+void Permute_GramIndex(GramIndex* ptr, const int* order, int count)
+{
+	assert(ptr && (order || count == 0));
+	if (count == 0)
+	{
+		return;
+	}
+	ptr->ids = Grow_Array(ptr->ids, &ptr->idCapacity, (size_t)count);
+	int* ids = (int*)malloc(sizeof(int) * count);
+	if (ids == NULL)
+	{
+		perror("Permute_GramIndex");
+		exit(EXIT_FAILURE);
+	}
+	for (int i = 0; i < count; i++)
+	{
+		ids[i] = ptr->ids[order[i]];
+	}
+	memcpy(ptr->ids, ids, sizeof(int) * count);
+	for (int i = 0; i < count; i++)
+	{
+		if (ids[i] != -1)
+		{
+			ptr->records[ids[i]] = i;
+		}
+	}
+	free(ids);
+}
+
+//倍增查找：从"from"开始查找第一个不小于"id"的位置
+static int Gallop_List(const GramList* list, int from, int id)
+{
+	if (from >= list->size || list->data[from] >= id)
+	{
+		return from;
+	}
+	int low = from, step = 1;
+	int high = from + 1;
+	while (high < list->size && list->data[high] < id)
+	{
+		low = high;
+		step *= 2;
+		high = from + step;
+	}
+	high = high < list->size ? high : list->size;
+	//此时"data[low] < id"，答案在"(low, high]"中
+	int left = low + 1, right = high;
+	while (left < right)
+	{
+		int middle = left + ((right - left) >> 1);
+		list->data[middle] < id ? (left = middle + 1) : (right = middle);
+	}
+	return left;
+}
+
+//模糊查找(返回写入"result"的下标个数，最多"k"个且不超过"GRAM_MAX_RESULT"个，"scores"可为空)
+size_t Search_GramIndex(const GramIndex* ptr, const char* text, int* result, int* scores, size_t k)
+{
+	assert(ptr && text && (result || k == 0));
+	static const GramList empty = { NULL, 0, 0, NULL, 0 };
+	unsigned int grams[GRAM_MAX_GRAMS];
+	int total = Unique_Gram(grams, Split_Gram(text, grams, 0));
+	k = k < GRAM_MAX_RESULT ? k : GRAM_MAX_RESULT;
+	if (total == 0 || k == 0)
+	{
+		return 0;
+	}
+	//按倒排表长度升序排列
+	const GramList* lists[GRAM_MAX_GRAMS];
+	int cursor[GRAM_MAX_GRAMS];
+	for (int i = 0; i < total; i++)
+	{
+		int id = Find_List(ptr, grams[i]);
+		const GramList* list = id == -1 ? &empty : ptr->lists + id;
+		int j = i - 1;
+		for (; j >= 0 && lists[j]->size > list->size; j--)
+		{
+			lists[j + 1] = lists[j];
+		}
+		lists[j + 1] = list;
+		cursor[i] = 0;
+	}
+	int need = (total + 1) / 2;
+	int candidates = total - need + 1;
+	int bestIndex[GRAM_MAX_RESULT], bestScore[GRAM_MAX_RESULT];
+	size_t count = 0;
+	while (true)
+	{
+		//候选为最短的"candidates"个倒排表的当前最小下标
+		int candidate = INT_MAX;
+		for (int i = 0; i < candidates; i++)
+		{
+			if (cursor[i] < lists[i]->size && lists[i]->data[cursor[i]] < candidate)
+			{
+				candidate = lists[i]->data[cursor[i]];
+			}
+		}
+		if (candidate == INT_MAX)
+		{
+			break;
+		}
+		//参与合并的倒排表必须越过候选；其余倒排表在得分已不可能达到下限时不再查找(游标留在原处，之后的倍增查找仍然正确)
+		int score = 0;
+		for (int i = 0; i < total && (i < candidates || score + total - i >= need); i++)
+		{
+			if (i >= candidates && lists[i]->bits != NULL)
+			{
+				score += Test_List(lists[i], candidate);
+				continue;
+			}
+			cursor[i] = Gallop_List(lists[i], cursor[i], candidate);
+			if (cursor[i] < lists[i]->size && lists[i]->data[cursor[i]] == candidate)
+			{
+				score++;
+				cursor[i] += i < candidates;
+			}
+		}
+		if (score < need || (count == k && score <= bestScore[k - 1]) || ptr->records[candidate] == -1)
+		{
+			continue;
+		}
+		//候选按下标升序到达，得分相同时排在已有结果之后
+		size_t pos = count < k ? count++ : k - 1;
+		for (; pos > 0 && bestScore[pos - 1] < score; pos--)
+		{
+			bestIndex[pos] = bestIndex[pos - 1];
+			bestScore[pos] = bestScore[pos - 1];
+		}
+		bestIndex[pos] = candidate;
+		bestScore[pos] = score;
+		if (count == k)
+		{
+			//已有"k"个结果时，之后的候选必须超过第"k"名才能进入结果，提高得分下限并减少参与合并的倒排表
+			need = bestScore[k - 1] + 1;
+			if (need > total)
+			{
+				break;
+			}
+			candidates = total - need + 1;
+		}
+	}
+	for (size_t i = 0; i < count; i++)
+	{
+		result[i] = ptr->records[bestIndex[i]];
+		if (scores != NULL)
+		{
+			scores[i] = bestScore[i];
+		}
+	}
+	return count;
+}
+
+//清空倒排索引
+void Clear_GramIndex(GramIndex* ptr)
+{
+	assert(ptr);
+	for (size_t i = 0; i < ptr->size; i++)
+	{
+		free(ptr->lists[i].data);
+		free(ptr->lists[i].bits);
+	}
+	ptr->size = 0;
+	if (ptr->ids != NULL)
+	{
+		memset(ptr->ids, 0xFF, sizeof(int) * ptr->idCapacity);
+	}
+	if (ptr->records != NULL)
+	{
+		memset(ptr->records, 0xFF, sizeof(int) * ptr->recordCapacity);
+	}
+	ptr->nextId = ptr->live = 0;
+	if (ptr->codes != NULL)
+	{
+		memset(ptr->codes, 0, sizeof(unsigned int) * ptr->capacity);
+	}
+}
+
+//销毁倒排索引
+void Destroy_GramIndex(GramIndex* ptr)
+{
+	assert(ptr);
+	Clear_GramIndex(ptr);
+	free(ptr->codes);
+	free(ptr->slots);
+	free(ptr->lists);
+	free(ptr->ids);
+	free(ptr->records);
+	ptr->codes = NULL;
+	ptr->slots = NULL;
+	ptr->lists = NULL;
+	ptr->ids = ptr->records = NULL;
+	ptr->capacity = ptr->listCapacity = 0;
+	ptr->idCapacity = ptr->recordCapacity = 0;
+}
\ No newline at end of file
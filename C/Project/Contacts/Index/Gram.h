@@ -0,0 +1,79 @@
+#pragma once
+
+//引用索引头文件(以使用"IndexKey")
+#include "Index.h"
+
+/*
+ * "n-gram"倒排索引(n = 3)
+ * 1. 联系人的若干个字段(均为字符串)按字节切分为连续的三个字符(英文字母不区分大小写)，三元组不跨越字段；每个三元组对应一个按编号升序排列的倒排表。
+ *    倒排表中保存的是插入时分配的编号(只增不减)而不是下标，"ids"与"records"记录下标与编号的对应关系。
+ * 2. 三元组到倒排表的映射为开放定址(线性探测)哈希表；倒排表只增不删，表为空时仍保留。
+ * 3. 插入时新编号最大，只需追加到倒排表末尾；删除时只将编号标记为已删除(墓碑)，移动下标时只修改对应关系，都不访问倒排表。
+ *    已删除的编号多于存活的编号时压缩：过滤掉全部墓碑并按原顺序重新编号，均摊到每次删除的代价为：O(1)(与联系人总数无关)。
+ * 4. 模糊查找：查询串有"T"个不同的三元组，联系人的得分为其包含的三元组个数，得分不少于"T"的一半(向上取整)才是候选。
+ *    得分达到要求的联系人必定出现在最短的"T - need + 1"个倒排表之一中，因此只合并这些倒排表得到候选，再以倍增查找(游标只前进)统计候选在全部倒排表中的出现次数。
+ *    统计得分时，剩余的倒排表全部命中也达不到下限就不再查找；编号个数不少于编号范围的"1/GRAM_DENSE"的倒排表另外保存位图(不大于倒排表本身)，不参与合并时直接按位判断。
+ *    结果按得分从高到低、编号(即插入顺序)从小到大排列；已有"k"个结果后，得分下限提高为第"k"名的得分加一，参与合并的倒排表随之减少，下限超过"T"时提前结束。
+ */
+
+//定义标识符
+#define GRAM_SIZE 3
+#define GRAM_MIN 16
+#define GRAM_MAX_FIELDS 4
+#define GRAM_MAX_GRAMS 256
+#define GRAM_MAX_RESULT 64
+#define GRAM_DENSE 32
+
+//定义结构体类型(倒排表)
+typedef struct GramList
+{
+	int* data;
+	int size;
+	int capacity;
+	unsigned long long* bits; //稠密倒排表的位图(没有时为空)
+	size_t words;
+} GramList;
+
+//定义结构体类型("n-gram"倒排索引)
+typedef struct GramIndex
+{
+	unsigned int* codes;
+	int* slots;
+	size_t capacity;
+	GramList* lists;
+	size_t size;
+	size_t listCapacity;
+	int* ids; //下标对应的编号(没有时为"-1")
+	int* records; //编号对应的下标(已删除时为"-1")
+	size_t idCapacity;
+	size_t recordCapacity;
+	int nextId;
+	int live;
+	const void* context;
+	IndexKey keys[GRAM_MAX_FIELDS];
+	int fieldCount;
+} GramIndex;
+
+//初始化倒排索引("keys"为"fieldCount"个字段的回调函数，返回的键必须为字符串)
+void Init_GramIndex(GramIndex* ptr, const void* context, const IndexKey* keys, int fieldCount);
+
+//插入下标
+void Insert_GramIndex(GramIndex* ptr, int index);
+
+//删除下标(只标记编号，不访问联系人)
+void Erase_GramIndex(GramIndex* ptr, int index);
+
+//将下标"from"改为"to"(编号不变，不访问联系人)
+void Move_GramIndex(GramIndex* ptr, int from, int to);
+
+//按排列改写下标(下标"order[i]"改为"i"，"count"为下标总数，编号不变，不访问联系人)
+void Permute_GramIndex(GramIndex* ptr, const int* order, int count);
+
+//模糊查找(返回写入"result"的下标个数，最多"k"个且不超过"GRAM_MAX_RESULT"个，"scores"可为空)
+size_t Search_GramIndex(const GramIndex* ptr, const char* text, int* result, int* scores, size_t k);
+
+//清空倒排索引
+void Clear_GramIndex(GramIndex* ptr);
+
+//销毁倒排索引
+void Destroy_GramIndex(GramIndex* ptr);
\ No newline at end of file
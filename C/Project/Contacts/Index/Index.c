@@ -0,0 +1,600 @@
+#include "Index.h"
+
+//计算字符串的哈希值(FNV-1a)
+unsigned int Hash_String(const char* str)
+{
+	assert(str);
+	unsigned int hash = 2166136261u;
+	while (*str)
+	{
+		hash ^= (unsigned char)*str++;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+//计算哈希值在哈希表中的起始位置(混合高位，使低位分布更均匀)
+static size_t Home_HashIndex(const HashIndex* ptr, unsigned int hash)
+{
+	return (size_t)(hash ^ (hash >> 16)) & (ptr->capacity - 1);
+}
+
+//初始化哈希索引("key"返回的键必须为字符串)
+void Init_HashIndex(HashIndex* ptr, const void* context, IndexKey key)
+{
+	assert(ptr && key);
+	ptr->slots = NULL;
+	ptr->capacity = ptr->size = 0;
+	ptr->context = context;
+	ptr->key = key;
+}
+
+//重新分配哈希表(保存的哈希值无需重新计算)
+static void Rehash_HashIndex(HashIndex* ptr, size_t capacity)
+{
+	HashSlot* slots = (HashSlot*)malloc(sizeof(HashSlot) * capacity);
+	if (slots == NULL)
+	{
+		perror("Rehash_HashIndex");
+		exit(EXIT_FAILURE);
+	}
+	memset(slots, 0xFF, sizeof(HashSlot) * capacity);
+	HashSlot* old = ptr->slots;
+	size_t oldCapacity = ptr->capacity;
+	ptr->slots = slots;
+	ptr->capacity = capacity;
+	for (size_t i = 0; i < oldCapacity; i++)
+	{
+		if (old[i].index != HASH_INDEX_EMPTY)
+		{
+			size_t pos = Home_HashIndex(ptr, old[i].hash);
+			while (slots[pos].index != HASH_INDEX_EMPTY)
+			{
+				pos = (pos + 1) & (capacity - 1);
+			}
+			slots[pos] = old[i];
+		}
+	}
+	free(old);
+}
+
+//预留可容纳"count"个下标的空间
+void Reserve_HashIndex(HashIndex* ptr, size_t count)
+{
+	assert(ptr);
+	size_t capacity = ptr->capacity == 0 ? HASH_INDEX_MIN : ptr->capacity;
+	while (count * 4 > capacity * 3)
+	{
+		capacity *= 2;
+	}
+	if (capacity != ptr->capacity)
+	{
+		Rehash_HashIndex(ptr, capacity);
+	}
+}
+
+//插入下标
+void Insert_HashIndex(HashIndex* ptr, int index)
+{
+	assert(ptr && index >= 0);
+	Reserve_HashIndex(ptr, ptr->size + 1);
+	unsigned int hash = Hash_String((const char*)ptr->key(ptr->context, index));
+	size_t pos = Home_HashIndex(ptr, hash);
+	while (ptr->slots[pos].index != HASH_INDEX_EMPTY)
+	{
+		pos = (pos + 1) & (ptr->capacity - 1);
+	}
+	ptr->slots[pos].hash = hash;
+	ptr->slots[pos].index = index;
+	ptr->size++;
+}
+
+//查找保存下标"index"的槽，不存在时返回"capacity"
+static size_t Slot_HashIndex(const HashIndex* ptr, int index)
+{
+	if (ptr->size == 0)
+	{
+		return ptr->capacity;
+	}
+	unsigned int hash = Hash_String((const char*)ptr->key(ptr->context, index));
+	for (size_t pos = Home_HashIndex(ptr, hash); ptr->slots[pos].index != HASH_INDEX_EMPTY; pos = (pos + 1) & (ptr->capacity - 1))
+	{
+		if (ptr->slots[pos].index == index)
+		{
+			return pos;
+		}
+	}
+	return ptr->capacity;
+}
+
+//删除下标(必须在联系人被覆盖之前调用)
+bool Erase_HashIndex(HashIndex* ptr, int index)
+{
+	assert(ptr);
+	size_t hole = Slot_HashIndex(ptr, index);
+	if (hole == ptr->capacity)
+	{
+		return false;
+	}
+	size_t mask = ptr->capacity - 1;
+	for (size_t next = (hole + 1) & mask; ptr->slots[next].index != HASH_INDEX_EMPTY; next = (next + 1) & mask)
+	{
+		//若"next"处元素的探测距离不小于它到空位的距离，则可以将它移入空位
+		size_t home = Home_HashIndex(ptr, ptr->slots[next].hash);
+		if (((next - home) & mask) >= ((next - hole) & mask))
+		{
+			ptr->slots[hole] = ptr->slots[next];
+			hole = next;
+		}
+	}
+	ptr->slots[hole].index = HASH_INDEX_EMPTY;
+	ptr->size--;
+	return true;
+}
+
+//将下标"from"改为"to"(必须在联系人从"from"移动到"to"之前调用)
+bool Move_HashIndex(HashIndex* ptr, int from, int to)
+{
+	assert(ptr && to >= 0);
+	size_t pos = Slot_HashIndex(ptr, from);
+	if (pos == ptr->capacity)
+	{
+		return false;
+	}
+	ptr->slots[pos].index = to;
+	return true;
+}
+
+//查找键为"key"的下标，不存在时返回"HASH_INDEX_EMPTY"
+int Find_HashIndex(const HashIndex* ptr, const char* key)
+{
+	assert(ptr && key);
+	if (ptr->size == 0)
+	{
+		return HASH_INDEX_EMPTY;
+	}
+	unsigned int hash = Hash_String(key);
+	for (size_t pos = Home_HashIndex(ptr, hash); ptr->slots[pos].index != HASH_INDEX_EMPTY; pos = (pos + 1) & (ptr->capacity - 1))
+	{
+		if (ptr->slots[pos].hash == hash && strcmp((const char*)ptr->key(ptr->context, ptr->slots[pos].index), key) == 0)
+		{
+			return ptr->slots[pos].index;
+		}
+	}
+	return HASH_INDEX_EMPTY;
+}
+
+//清空哈希索引
+void Clear_HashIndex(HashIndex* ptr)
+{
+	assert(ptr);
+	if (ptr->slots != NULL)
+	{
+		memset(ptr->slots, 0xFF, sizeof(HashSlot) * ptr->capacity);
+	}
+	ptr->size = 0;
+}
+
+//销毁哈希索引
+void Destroy_HashIndex(HashIndex* ptr)
+{
+	assert(ptr);
+	free(ptr->slots);
+	ptr->slots = NULL;
+	ptr->capacity = ptr->size = 0;
+}
+
+//初始化有序索引("keySize"为键的字节数)
+void Init_OrderIndex(OrderIndex* ptr, const void* context, IndexKey key, size_t keySize, IndexCompare compare)
+{
+	assert(ptr && key && compare);
+	ptr->blocks = NULL;
+	ptr->tree = NULL;
+	ptr->count = ptr->capacity = ptr->size = 0;
+	ptr->keySize = keySize;
+	ptr->context = context;
+	ptr->key = key;
+	ptr->compare = compare;
+}
+
+//检查块数组容量(树状数组比块数组多一项)
+static void Check_OrderIndex(OrderIndex* ptr, size_t count)
+{
+	if (count > ptr->capacity)
+	{
+		size_t capacity = ptr->capacity == 0 ? ORDER_INDEX_MIN : ptr->capacity;
+		while (capacity < count)
+		{
+			capacity *= 2;
+		}
+		OrderBlock* blocks = (OrderBlock*)realloc(ptr->blocks, sizeof(OrderBlock) * capacity);
+		if (blocks == NULL)
+		{
+			perror("Check_OrderIndex");
+			exit(EXIT_FAILURE);
+		}
+		ptr->blocks = blocks;
+		size_t* tree = (size_t*)realloc(ptr->tree, sizeof(size_t) * (capacity + 1));
+		if (tree == NULL)
+		{
+			perror("Check_OrderIndex");
+			exit(EXIT_FAILURE);
+		}
+		ptr->tree = tree;
+		ptr->capacity = capacity;
+	}
+}
+
+//在第"pos"个位置插入一个空块
+static void Insert_Block(OrderIndex* ptr, size_t pos)
+{
+	Check_OrderIndex(ptr, ptr->count + 1);
+	int* order = (int*)malloc(sizeof(int) * ORDER_INDEX_BLOCK);
+	if (order == NULL)
+	{
+		perror("Insert_Block");
+		exit(EXIT_FAILURE);
+	}
+	memmove(ptr->blocks + pos + 1, ptr->blocks + pos, sizeof(OrderBlock) * (ptr->count - pos));
+	ptr->blocks[pos].order = order;
+	ptr->blocks[pos].size = 0;
+	ptr->count++;
+}
+
+//删除第"pos"个块
+static void Erase_Block(OrderIndex* ptr, size_t pos)
+{
+	free(ptr->blocks[pos].order);
+	memmove(ptr->blocks + pos, ptr->blocks + pos + 1, sizeof(OrderBlock) * (ptr->count - pos - 1));
+	ptr->count--;
+}
+
+//重建树状数组(块数改变后调用)
+static void Rebuild_Tree(OrderIndex* ptr)
+{
+	for (size_t i = 1; i <= ptr->count; i++)
+	{
+		ptr->tree[i] = ptr->blocks[i - 1].size;
+	}
+	for (size_t i = 1; i <= ptr->count; i++)
+	{
+		size_t parent = i + (i & (0 - i));
+		if (parent <= ptr->count)
+		{
+			ptr->tree[parent] += ptr->tree[i];
+		}
+	}
+}
+
+//第"block"个块的大小加一或减一
+static void Update_Tree(OrderIndex* ptr, size_t block, bool increase)
+{
+	for (size_t i = block + 1; i <= ptr->count; i += i & (0 - i))
+	{
+		increase ? ptr->tree[i]++ : ptr->tree[i]--;
+	}
+}
+
+//计算前"block"个块的下标总数(即第"block"个块在全局的起始位置)
+static size_t Prefix_Tree(const OrderIndex* ptr, size_t block)
+{
+	size_t sum = 0;
+	for (size_t i = block; i > 0; i -= i & (0 - i))
+	{
+		sum += ptr->tree[i];
+	}
+	return sum;
+}
+
+//查找全局位置"*pos"所在的块，并将"*pos"改为块内的位置
+static size_t Locate_Tree(const OrderIndex* ptr, size_t* pos)
+{
+	size_t step = 1;
+	while (step * 2 <= ptr->count)
+	{
+		step *= 2;
+	}
+	size_t block = 0;
+	for (; step > 0; step >>= 1)
+	{
+		if (block + step <= ptr->count && ptr->tree[block + step] <= *pos)
+		{
+			block += step;
+			*pos -= ptr->tree[block];
+		}
+	}
+	return block;
+}
+
+//复制一个"(键，下标)"元素(元素大小为"8"的倍数，逐个复制"8"字节比调用"memcpy"更快)
+static void Copy_Entry(char* dest, const char* src, size_t stride)
+{
+	for (size_t i = 0; i < stride; i += 8)
+	{
+		unsigned long long word;
+		memcpy(&word, src + i, 8);
+		memcpy(dest + i, &word, 8);
+	}
+}
+
+//以下标"[0, count)"构建有序索引
+void Build_OrderIndex(OrderIndex* ptr, int count)
+{
+	assert(ptr && count >= 0);
+	Clear_OrderIndex(ptr);
+	//每个元素为"(键，下标)"，元素大小按"8"字节对齐
+	size_t offset = (ptr->keySize + sizeof(int) - 1) / sizeof(int) * sizeof(int);
+	size_t stride = (offset + sizeof(int) + 7) / 8 * 8;
+	size_t size = (size_t)count;
+	char* arr = (char*)malloc(stride * (size + 1));
+	char* tmp = (char*)malloc(stride * (size + 1));
+	if (arr == NULL || tmp == NULL)
+	{
+		perror("Build_OrderIndex");
+		exit(EXIT_FAILURE);
+	}
+	for (int i = 0; i < count; i++)
+	{
+		memset(arr + stride * i, 0, stride);
+		memcpy(arr + stride * i, ptr->key(ptr->context, i), ptr->keySize);
+		memcpy(arr + stride * i + offset, &i, sizeof(int));
+	}
+	//先以插入排序排好长度为"ORDER_INDEX_RUN"的小段，再自底向上归并(均为稳定排序，键相同的元素保持下标升序)
+	char* key = tmp + stride * size;
+	for (size_t left = 0; left < size; left += ORDER_INDEX_RUN)
+	{
+		size_t right = left + ORDER_INDEX_RUN < size ? left + ORDER_INDEX_RUN : size;
+		for (size_t i = left + 1; i < right; i++)
+		{
+			Copy_Entry(key, arr + stride * i, stride);
+			size_t j = i;
+			for (; j > left && ptr->compare(key, arr + stride * (j - 1)) < 0; j--)
+			{
+				Copy_Entry(arr + stride * j, arr + stride * (j - 1), stride);
+			}
+			Copy_Entry(arr + stride * j, key, stride);
+		}
+	}
+	for (size_t width = ORDER_INDEX_RUN; width < size; width *= 2)
+	{
+		for (size_t left = 0; left < size; left += 2 * width)
+		{
+			size_t middle = left + width < size ? left + width : size;
+			size_t right = left + 2 * width < size ? left + 2 * width : size;
+			size_t i = left, j = middle, k = left;
+			while (i < middle && j < right)
+			{
+				if (ptr->compare(arr + stride * j, arr + stride * i) < 0)
+				{
+					Copy_Entry(tmp + stride * k++, arr + stride * j++, stride);
+				}
+				else
+				{
+					Copy_Entry(tmp + stride * k++, arr + stride * i++, stride);
+				}
+			}
+			memcpy(tmp + stride * k, arr + stride * i, stride * (middle - i));
+			k += middle - i;
+			memcpy(tmp + stride * k, arr + stride * j, stride * (right - j));
+		}
+		char* swap = arr;
+		arr = tmp;
+		tmp = swap;
+	}
+	//每块只填入容量的"3/4"，使之后的插入不会立即分裂
+	const size_t fill = ORDER_INDEX_BLOCK / 4 * 3;
+	for (size_t i = 0; i < size; i++)
+	{
+		if (i % fill == 0)
+		{
+			Insert_Block(ptr, ptr->count);
+		}
+		OrderBlock* block = ptr->blocks + ptr->count - 1;
+		memcpy(block->order + block->size++, arr + stride * i + offset, sizeof(int));
+	}
+	ptr->size = size;
+	Rebuild_Tree(ptr);
+	free(arr);
+	free(tmp);
+}
+
+//比较下标"index"与"(key，keyIndex)"的大小
+static int Compare_OrderIndex(const OrderIndex* ptr, int index, const void* key, int keyIndex)
+{
+	int result = ptr->compare(ptr->key(ptr->context, index), key);
+	if (result == 0)
+	{
+		result = (index > keyIndex) - (index < keyIndex);
+	}
+	return result;
+}
+
+//查找"(key，index)"所在的块(最后一个第一个下标不大于它的块)
+static size_t Block_OrderIndex(const OrderIndex* ptr, const void* key, int index)
+{
+	size_t left = 1, right = ptr->count;
+	while (left < right)
+	{
+		size_t middle = left + ((right - left) >> 1);
+		Compare_OrderIndex(ptr, ptr->blocks[middle].order[0], key, index) <= 0 ? (left = middle + 1) : (right = middle);
+	}
+	return left - 1;
+}
+
+//查找块内第一个不小于"(key，index)"的位置
+static size_t Position_OrderIndex(const OrderIndex* ptr, const OrderBlock* block, const void* key, int index)
+{
+	size_t left = 0, right = block->size;
+	while (left < right)
+	{
+		size_t middle = left + ((right - left) >> 1);
+		Compare_OrderIndex(ptr, block->order[middle], key, index) < 0 ? (left = middle + 1) : (right = middle);
+	}
+	return left;
+}
+
+//插入下标
+void Insert_OrderIndex(OrderIndex* ptr, int index)
+{
+	assert(ptr && index >= 0);
+	if (ptr->count == 0)
+	{
+		Insert_Block(ptr, 0);
+		Rebuild_Tree(ptr);
+	}
+	const void* key = ptr->key(ptr->context, index);
+	size_t current = Block_OrderIndex(ptr, key, index);
+	size_t pos = Position_OrderIndex(ptr, ptr->blocks + current, key, index);
+	bool split = ptr->blocks[current].size == ORDER_INDEX_BLOCK;
+	if (split)
+	{
+		//块已满时将后一半移入新块
+		const size_t half = ORDER_INDEX_BLOCK / 2;
+		Insert_Block(ptr, current + 1);
+		memcpy(ptr->blocks[current + 1].order, ptr->blocks[current].order + half, sizeof(int) * half);
+		ptr->blocks[current + 1].size = half;
+		ptr->blocks[current].size = half;
+		if (pos > half)
+		{
+			current++;
+			pos -= half;
+		}
+	}
+	OrderBlock* block = ptr->blocks + current;
+	memmove(block->order + pos + 1, block->order + pos, sizeof(int) * (block->size - pos));
+	block->order[pos] = index;
+	block->size++;
+	ptr->size++;
+	split ? Rebuild_Tree(ptr) : Update_Tree(ptr, current, true);
+}
+
+//将第"pos + 1"个块合并到第"pos"个块中
+static void Merge_Block(OrderIndex* ptr, size_t pos)
+{
+	OrderBlock* block = ptr->blocks + pos;
+	memcpy(block->order + block->size, block[1].order, sizeof(int) * block[1].size);
+	block->size += block[1].size;
+	Erase_Block(ptr, pos + 1);
+}
+
+//删除下标(必须在联系人被覆盖之前调用)
+bool Erase_OrderIndex(OrderIndex* ptr, int index)
+{
+	assert(ptr);
+	if (ptr->size == 0)
+	{
+		return false;
+	}
+	const void* key = ptr->key(ptr->context, index);
+	size_t current = Block_OrderIndex(ptr, key, index);
+	OrderBlock* block = ptr->blocks + current;
+	size_t pos = Position_OrderIndex(ptr, block, key, index);
+	if (pos == block->size || block->order[pos] != index)
+	{
+		return false;
+	}
+	memmove(block->order + pos, block->order + pos + 1, sizeof(int) * (block->size - pos - 1));
+	block->size--;
+	ptr->size--;
+	//块为空时删除，与相邻的块合计不超过半块时合并
+	const size_t half = ORDER_INDEX_BLOCK / 2;
+	if (block->size == 0)
+	{
+		Erase_Block(ptr, current);
+	}
+	else if (current + 1 < ptr->count && block->size + block[1].size <= half)
+	{
+		Merge_Block(ptr, current);
+	}
+	else if (current > 0 && block[-1].size + block->size <= half)
+	{
+		Merge_Block(ptr, current - 1);
+	}
+	else
+	{
+		Update_Tree(ptr, current, false);
+		return true;
+	}
+	Rebuild_Tree(ptr);
+	return true;
+}
+
+//查找第一个键不小于"key"的位置
+size_t Lower_OrderIndex(const OrderIndex* ptr, const void* key)
+{
+	assert(ptr && key);
+	//先找到第一个首个键不小于"key"的块，结果在它的前一块中
+	size_t left = 0, right = ptr->count;
+	while (left < right)
+	{
+		size_t middle = left + ((right - left) >> 1);
+		ptr->compare(ptr->key(ptr->context, ptr->blocks[middle].order[0]), key) < 0 ? (left = middle + 1) : (right = middle);
+	}
+	if (left == 0)
+	{
+		return 0;
+	}
+	const OrderBlock* block = ptr->blocks + left - 1;
+	size_t low = 0, high = block->size;
+	while (low < high)
+	{
+		size_t middle = low + ((high - low) >> 1);
+		ptr->compare(ptr->key(ptr->context, block->order[middle]), key) < 0 ? (low = middle + 1) : (high = middle);
+	}
+	return Prefix_Tree(ptr, left - 1) + low;
+}
+
+//查找第一个键大于"key"的位置
+size_t Upper_OrderIndex(const OrderIndex* ptr, const void* key)
+{
+	assert(ptr && key);
+	size_t left = 0, right = ptr->count;
+	while (left < right)
+	{
+		size_t middle = left + ((right - left) >> 1);
+		ptr->compare(ptr->key(ptr->context, ptr->blocks[middle].order[0]), key) <= 0 ? (left = middle + 1) : (right = middle);
+	}
+	if (left == 0)
+	{
+		return 0;
+	}
+	const OrderBlock* block = ptr->blocks + left - 1;
+	size_t low = 0, high = block->size;
+	while (low < high)
+	{
+		size_t middle = low + ((high - low) >> 1);
+		ptr->compare(ptr->key(ptr->context, block->order[middle]), key) <= 0 ? (low = middle + 1) : (high = middle);
+	}
+	return Prefix_Tree(ptr, left - 1) + low;
+}
+
+//取得位置"pos"处的下标
+int At_OrderIndex(const OrderIndex* ptr, size_t pos)
+{
+	assert(ptr && pos < ptr->size);
+	size_t block = Locate_Tree(ptr, &pos);
+	return ptr->blocks[block].order[pos];
+}
+
+//清空有序索引
+void Clear_OrderIndex(OrderIndex* ptr)
+{
+	assert(ptr);
+	for (size_t i = 0; i < ptr->count; i++)
+	{
+		free(ptr->blocks[i].order);
+	}
+	ptr->count = ptr->size = 0;
+}
+
+//销毁有序索引
+void Destroy_OrderIndex(OrderIndex* ptr)
+{
+	assert(ptr);
+	Clear_OrderIndex(ptr);
+	free(ptr->blocks);
+	free(ptr->tree);
+	ptr->blocks = NULL;
+	ptr->tree = NULL;
+	ptr->capacity = 0;
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+//引用头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+
+/*
+ * 通讯录索引(索引中只保存联系人在数组中的下标，键由回调函数从联系人中取得，因此同一套实现可以用于不同的字段)
+ * 1. 哈希索引：开放定址(线性探测)哈希表，键为字符串，容量为"2"的幂，负载因子不超过"3/4"。
+ *    槽中同时保存下标与哈希值，查找时先比较哈希值，只有哈希值相等时才访问联系人比较字符串；删除时后移元素而不使用墓碑。
+ * 2. 有序索引：按"(键，下标)"升序排列的下标被切分为若干块(每块最多"ORDER_INDEX_BLOCK"个下标)，先以每块的第一个下标二分查找所在的块，再在块内二分查找。
+ *    插入与删除时只移动块内的下标，块满时分裂为两块，块过小时与相邻的块合并，因此每次修改的代价与联系人总数无关。
+ *    各块的大小保存在树状数组中，由块号求全局位置与由全局位置求块号均为"O(logn)"，分裂与合并时重建树状数组。
+ *    批量构建时先将"(键，下标)"复制到连续的临时数组中再归并排序，使排序过程顺序访问内存，之后按块容量的"3/4"切分。
+ * 3. 键相同的联系人按下标排列，因此下标改变(例如删除时用最后一个联系人填补空位)时需要先删除再插入。
+ */
+
+//定义标识符
+#define HASH_INDEX_MIN 16
+#define HASH_INDEX_EMPTY (-1)
+#define ORDER_INDEX_MIN 16
+#define ORDER_INDEX_RUN 16
+#define ORDER_INDEX_BLOCK 512
+
+//定义函数指针类型(取得下标为"index"的联系人的键)
+typedef const void* (* IndexKey)(const void* context, int index);
+
+//定义函数指针类型(比较两个键)
+typedef int (* IndexCompare)(const void* key1, const void* key2);
+
+//定义结构体类型(哈希槽)
+typedef struct HashSlot
+{
+	unsigned int hash;
+	int index;
+} HashSlot;
+
+//定义结构体类型(哈希索引)
+typedef struct HashIndex
+{
+	HashSlot* slots;
+	size_t capacity;
+	size_t size;
+	const void* context;
+	IndexKey key;
+} HashIndex;
+
+//定义结构体类型(有序索引的块)
+typedef struct OrderBlock
+{
+	int* order;
+	size_t size;
+} OrderBlock;
+
+//定义结构体类型(有序索引)
+typedef struct OrderIndex
+{
+	OrderBlock* blocks;
+	size_t* tree; //各块大小的树状数组
+	size_t count; //块数
+	size_t capacity; //块数组的容量
+	size_t size; //下标总数
+	size_t keySize;
+	const void* context;
+	IndexKey key;
+	IndexCompare compare;
+} OrderIndex;
+
+//计算字符串的哈希值(FNV-1a)
+unsigned int Hash_String(const char* str);
+
+//初始化哈希索引("key"返回的键必须为字符串)
+void Init_HashIndex(HashIndex* ptr, const void* context, IndexKey key);
+
+//预留可容纳"count"个下标的空间
+void Reserve_HashIndex(HashIndex* ptr, size_t count);
+
+//插入下标
+void Insert_HashIndex(HashIndex* ptr, int index);
+
+//删除下标(必须在联系人被覆盖之前调用)
+bool Erase_HashIndex(HashIndex* ptr, int index);
+
+//将下标"from"改为"to"(必须在联系人从"from"移动到"to"之前调用)
+bool Move_HashIndex(HashIndex* ptr, int from, int to);
+
+//查找键为"key"的下标，不存在时返回"HASH_INDEX_EMPTY"
+int Find_HashIndex(const HashIndex* ptr, const char* key);
+
+//清空哈希索引
+void Clear_HashIndex(HashIndex* ptr);
+
+//销毁哈希索引
+void Destroy_HashIndex(HashIndex* ptr);
+
+//初始化有序索引("keySize"为键的字节数)
+void Init_OrderIndex(OrderIndex* ptr, const void* context, IndexKey key, size_t keySize, IndexCompare compare);
+
+//以下标"[0, count)"构建有序索引
+void Build_OrderIndex(OrderIndex* ptr, int count);
+
+//插入下标
+void Insert_OrderIndex(OrderIndex* ptr, int index);
+
+//删除下标(必须在联系人被覆盖之前调用)
+bool Erase_OrderIndex(OrderIndex* ptr, int index);
+
+//查找第一个键不小于"key"的位置
+size_t Lower_OrderIndex(const OrderIndex* ptr, const void* key);
+
+//查找第一个键大于"key"的位置
+size_t Upper_OrderIndex(const OrderIndex* ptr, const void* key);
+
+//取得位置"pos"处的下标
+int At_OrderIndex(const OrderIndex* ptr, size_t pos);
+
+//清空有序索引
+void Clear_OrderIndex(OrderIndex* ptr);
+
+//销毁有序索引
+void Destroy_OrderIndex(OrderIndex* ptr);
\ No newline at end of file
@@ -0,0 +1,571 @@
+#include "Radix.h"
+
+//重置根结点(根结点的下标为"0"，标签为空)
+static void Reset_Root(RadixTree* ptr)
+{
+	RadixNode root = { RADIX_NONE, RADIX_NONE, RADIX_NONE, RADIX_NONE, RADIX_NONE, 0, 0, 0 };
+	ptr->nodes[0] = root;
+	ptr->size = 1;
+	ptr->freeNode = RADIX_NONE;
+}
+
+//初始化基数树("key"返回的键必须为字符串)
+void Init_RadixTree(RadixTree* ptr, const void* context, IndexKey key)
+{
+	assert(ptr && key);
+	ptr->nodes = (RadixNode*)malloc(sizeof(RadixNode) * RADIX_MIN);
+	if (ptr->nodes == NULL)
+	{
+		perror("Init_RadixTree");
+		exit(EXIT_FAILURE);
+	}
+	ptr->capacity = RADIX_MIN;
+	Reset_Root(ptr);
+	ptr->edges = NULL;
+	ptr->edgeSize = ptr->edgeCapacity = 0;
+	ptr->labels = NULL;
+	ptr->labelSize = ptr->labelCapacity = ptr->labelGarbage = 0;
+	ptr->owner = ptr->prev = ptr->next = NULL;
+	ptr->recordCapacity = 0;
+	ptr->context = context;
+	ptr->key = key;
+}
+
+//检查下标数组容量
+static void Check_Record(RadixTree* ptr, int index)
+{
+	if ((size_t)index < ptr->recordCapacity)
+	{
+		return;
+	}
+	size_t capacity = ptr->recordCapacity == 0 ? RADIX_MIN : ptr->recordCapacity;
+	while (capacity <= (size_t)index)
+	{
+		capacity *= 2;
+	}
+	int* owner = (int*)realloc(ptr->owner, sizeof(int) * capacity);
+	if (owner != NULL)
+	{
+		ptr->owner = owner;
+	}
+	int* prev = (int*)realloc(ptr->prev, sizeof(int) * capacity);
+	if (prev != NULL)
+	{
+		ptr->prev = prev;
+	}
+	int* next = (int*)realloc(ptr->next, sizeof(int) * capacity);
+	if (next != NULL)
+	{
+		ptr->next = next;
+	}
+	if (owner == NULL || prev == NULL || next == NULL)
+	{
+		perror("Check_Record");
+		exit(EXIT_FAILURE);
+	}
+	memset(ptr->owner + ptr->recordCapacity, 0xFF, sizeof(int) * (capacity - ptr->recordCapacity));
+	ptr->recordCapacity = capacity;
+}
+
+//创建结点(标签为"label"的前"length"个字符，"label"为空时不复制标签)
+static int New_Node(RadixTree* ptr, int parent, const char* label, size_t length)
+{
+	int node = ptr->freeNode;
+	if (node != RADIX_NONE)
+	{
+		ptr->freeNode = ptr->nodes[node].sibling;
+	}
+	else
+	{
+		if (ptr->size == ptr->capacity)
+		{
+			RadixNode* tmp = (RadixNode*)realloc(ptr->nodes, sizeof(RadixNode) * ptr->capacity * 2);
+			if (tmp == NULL)
+			{
+				perror("New_Node");
+				exit(EXIT_FAILURE);
+			}
+			ptr->nodes = tmp;
+			ptr->capacity *= 2;
+		}
+		node = ptr->size++;
+	}
+	RadixNode init = { parent, RADIX_NONE, RADIX_NONE, RADIX_NONE, RADIX_NONE, 0, 0, 0 };
+	ptr->nodes[node] = init;
+	if (label != NULL)
+	{
+		if (ptr->labelSize + length > ptr->labelCapacity)
+		{
+			size_t capacity = ptr->labelCapacity == 0 ? RADIX_MIN : ptr->labelCapacity;
+			while (capacity < ptr->labelSize + length)
+			{
+				capacity *= 2;
+			}
+			char* tmp = (char*)realloc(ptr->labels, capacity);
+			if (tmp == NULL)
+			{
+				perror("New_Node");
+				exit(EXIT_FAILURE);
+			}
+			ptr->labels = tmp;
+			ptr->labelCapacity = capacity;
+		}
+		memcpy(ptr->labels + ptr->labelSize, label, length);
+		ptr->nodes[node].label = (int)ptr->labelSize;
+		ptr->nodes[node].length = (int)length;
+		ptr->labelSize += length;
+	}
+	return node;
+}
+
+//计算"(父结点，标签首字符)"在哈希表中的起始位置
+static size_t Home_Edge(const RadixTree* ptr, int parent, unsigned char first)
+{
+	unsigned int hash = ((unsigned int)parent << 8 | first) * 2654435761u;
+	return (size_t)(hash ^ (hash >> 16)) & (ptr->edgeCapacity - 1);
+}
+
+//查找"(父结点，标签首字符)"所在的槽，不存在时返回"edgeCapacity"
+static size_t Slot_Edge(const RadixTree* ptr, int parent, char ch)
+{
+	if (ptr->edgeSize == 0)
+	{
+		return ptr->edgeCapacity;
+	}
+	unsigned char first = (unsigned char)ch;
+	for (size_t pos = Home_Edge(ptr, parent, first); ptr->edges[pos].child != RADIX_NONE; pos = (pos + 1) & (ptr->edgeCapacity - 1))
+	{
+		if (ptr->edges[pos].parent == parent && ptr->edges[pos].first == first)
+		{
+			return pos;
+		}
+	}
+	return ptr->edgeCapacity;
+}
+
+//查找"node"的标签首字符为"ch"的子结点，不存在时返回"RADIX_NONE"
+static int Find_Child(const RadixTree* ptr, int node, char ch)
+{
+	size_t pos = Slot_Edge(ptr, node, ch);
+	return pos == ptr->edgeCapacity ? RADIX_NONE : ptr->edges[pos].child;
+}
+
+//重新分配哈希表
+static void Rehash_Edge(RadixTree* ptr, size_t capacity)
+{
+	RadixEdge* edges = (RadixEdge*)malloc(sizeof(RadixEdge) * capacity);
+	if (edges == NULL)
+	{
+		perror("Rehash_Edge");
+		exit(EXIT_FAILURE);
+	}
+	memset(edges, 0xFF, sizeof(RadixEdge) * capacity);
+	RadixEdge* old = ptr->edges;
+	size_t oldCapacity = ptr->edgeCapacity;
+	ptr->edges = edges;
+	ptr->edgeCapacity = capacity;
+	for (size_t i = 0; i < oldCapacity; i++)
+	{
+		if (old[i].child != RADIX_NONE)
+		{
+			size_t pos = Home_Edge(ptr, old[i].parent, old[i].first);
+			while (edges[pos].child != RADIX_NONE)
+			{
+				pos = (pos + 1) & (capacity - 1);
+			}
+			edges[pos] = old[i];
+		}
+	}
+	free(old);
+}
+
+//将"(父结点，标签首字符)"对应的子结点设为"child"(已存在时覆盖)
+static void Put_Edge(RadixTree* ptr, int parent, char ch, int child)
+{
+	size_t pos = Slot_Edge(ptr, parent, ch);
+	if (pos != ptr->edgeCapacity)
+	{
+		ptr->edges[pos].child = child;
+		return;
+	}
+	if ((ptr->edgeSize + 1) * 4 > ptr->edgeCapacity * 3)
+	{
+		Rehash_Edge(ptr, ptr->edgeCapacity == 0 ? RADIX_MIN : ptr->edgeCapacity * 2);
+	}
+	pos = Home_Edge(ptr, parent, (unsigned char)ch);
+	while (ptr->edges[pos].child != RADIX_NONE)
+	{
+		pos = (pos + 1) & (ptr->edgeCapacity - 1);
+	}
+	ptr->edges[pos].parent = parent;
+	ptr->edges[pos].child = child;
+	ptr->edges[pos].first = (unsigned char)ch;
+	ptr->edgeSize++;
+}
+
+//删除"(父结点，标签首字符)"(后移元素而不使用墓碑)
+static void Remove_Edge(RadixTree* ptr, int parent, char ch)
+{
+	size_t hole = Slot_Edge(ptr, parent, ch);
+	if (hole == ptr->edgeCapacity)
+	{
+		return;
+	}
+	size_t mask = ptr->edgeCapacity - 1;
+	for (size_t next = (hole + 1) & mask; ptr->edges[next].child != RADIX_NONE; next = (next + 1) & mask)
+	{
+		//若"next"处元素的探测距离不小于它到空位的距离，则可以将它移入空位
+		size_t home = Home_Edge(ptr, ptr->edges[next].parent, ptr->edges[next].first);
+		if (((next - home) & mask) >= ((next - hole) & mask))
+		{
+			ptr->edges[hole] = ptr->edges[next];
+			hole = next;
+		}
+	}
+	ptr->edges[hole].child = RADIX_NONE;
+	ptr->edgeSize--;
+}
+
+//将新结点"child"按标签首字符插入"node"的子结点链表(只有插入新叶子时才需要遍历兄弟结点)
+static void Link_Child(RadixTree* ptr, int node, int child)
+{
+	unsigned char first = (unsigned char)ptr->labels[ptr->nodes[child].label];
+	int prior = RADIX_NONE;
+	int next = ptr->nodes[node].child;
+	while (next != RADIX_NONE && (unsigned char)ptr->labels[ptr->nodes[next].label] < first)
+	{
+		prior = next;
+		next = ptr->nodes[next].sibling;
+	}
+	ptr->nodes[child].prior = prior;
+	ptr->nodes[child].sibling = next;
+	prior == RADIX_NONE ? (ptr->nodes[node].child = child) : (ptr->nodes[prior].sibling = child);
+	if (next != RADIX_NONE)
+	{
+		ptr->nodes[next].prior = child;
+	}
+	Put_Edge(ptr, node, (char)first, child);
+}
+
+//将存活结点的标签复制到新的字符池中(回收的标签超过一半时调用)
+static void Compact_Label(RadixTree* ptr)
+{
+	size_t capacity = RADIX_MIN;
+	while (capacity < ptr->labelSize - ptr->labelGarbage)
+	{
+		capacity *= 2;
+	}
+	char* labels = (char*)malloc(capacity);
+	if (labels == NULL)
+	{
+		perror("Compact_Label");
+		exit(EXIT_FAILURE);
+	}
+	size_t size = 0;
+	for (int i = 1; i < ptr->size; i++)
+	{
+		RadixNode* node = ptr->nodes + i;
+		if (node->parent != RADIX_NONE)
+		{
+			memcpy(labels + size, ptr->labels + node->label, node->length);
+			node->label = (int)size;
+			size += node->length;
+		}
+	}
+	free(ptr->labels);
+	ptr->labels = labels;
+	ptr->labelSize = size;
+	ptr->labelCapacity = capacity;
+	ptr->labelGarbage = 0;
+}
+
+//插入下标
+void Insert_RadixTree(RadixTree* ptr, int index)
+{
+	assert(ptr && index >= 0);
+	Check_Record(ptr, index);
+	const char* key = (const char*)ptr->key(ptr->context, index);
+	int node = 0;
+	while (*key != '\0')
+	{
+		int child = Find_Child(ptr, node, *key);
+		if (child == RADIX_NONE)
+		{
+			//没有以该字符开头的边，新建叶子结点保存剩余的键
+			int leaf = New_Node(ptr, node, key, strlen(key));
+			Link_Child(ptr, node, leaf);
+			node = leaf;
+			break;
+		}
+		int label = ptr->nodes[child].label;
+		int length = ptr->nodes[child].length;
+		int matched = 1;
+		while (matched < length && key[matched] == ptr->labels[label + matched])
+		{
+			matched++;
+		}
+		if (matched < length)
+		{
+			//键与标签只有前"matched"个字符相同，分裂出中间结点，中间结点取代原结点在兄弟链表中的位置
+			int middle = New_Node(ptr, node, NULL, 0);
+			int prior = ptr->nodes[child].prior, sibling = ptr->nodes[child].sibling;
+			ptr->nodes[middle].label = label;
+			ptr->nodes[middle].length = matched;
+			ptr->nodes[middle].count = ptr->nodes[child].count;
+			ptr->nodes[middle].prior = prior;
+			ptr->nodes[middle].sibling = sibling;
+			ptr->nodes[middle].child = child;
+			prior == RADIX_NONE ? (ptr->nodes[node].child = middle) : (ptr->nodes[prior].sibling = middle);
+			if (sibling != RADIX_NONE)
+			{
+				ptr->nodes[sibling].prior = middle;
+			}
+			ptr->nodes[child].parent = middle;
+			ptr->nodes[child].prior = ptr->nodes[child].sibling = RADIX_NONE;
+			ptr->nodes[child].label += matched;
+			ptr->nodes[child].length -= matched;
+			Put_Edge(ptr, node, *key, middle);
+			Put_Edge(ptr, middle, ptr->labels[label + matched], child);
+			child = middle;
+		}
+		node = child;
+		key += matched;
+	}
+	ptr->owner[index] = node;
+	ptr->prev[index] = RADIX_NONE;
+	ptr->next[index] = ptr->nodes[node].posting;
+	if (ptr->next[index] != RADIX_NONE)
+	{
+		ptr->prev[ptr->next[index]] = index;
+	}
+	ptr->nodes[node].posting = index;
+	for (int i = node; i != RADIX_NONE; i = ptr->nodes[i].parent)
+	{
+		ptr->nodes[i].count++;
+	}
+}
+
+//删除下标
+bool Erase_RadixTree(RadixTree* ptr, int index)
+{
+	assert(ptr);
+	if (index < 0 || (size_t)index >= ptr->recordCapacity || ptr->owner[index] == RADIX_NONE)
+	{
+		return false;
+	}
+	int node = ptr->owner[index];
+	int prev = ptr->prev[index], next = ptr->next[index];
+	prev == RADIX_NONE ? (ptr->nodes[node].posting = next) : (ptr->next[prev] = next);
+	if (next != RADIX_NONE)
+	{
+		ptr->prev[next] = prev;
+	}
+	ptr->owner[index] = RADIX_NONE;
+	for (int i = node; i != RADIX_NONE; i = ptr->nodes[i].parent)
+	{
+		ptr->nodes[i].count--;
+	}
+	//回收子树为空的叶子结点(回收后父结点可能也成为空叶子)
+	while (node != 0 && ptr->nodes[node].count == 0 && ptr->nodes[node].child == RADIX_NONE)
+	{
+		RadixNode* leaf = ptr->nodes + node;
+		int parent = leaf->parent;
+		leaf->prior == RADIX_NONE ? (ptr->nodes[parent].child = leaf->sibling) : (ptr->nodes[leaf->prior].sibling = leaf->sibling);
+		if (leaf->sibling != RADIX_NONE)
+		{
+			ptr->nodes[leaf->sibling].prior = leaf->prior;
+		}
+		Remove_Edge(ptr, parent, ptr->labels[leaf->label]);
+		ptr->labelGarbage += leaf->length;
+		leaf->parent = RADIX_NONE;
+		leaf->sibling = ptr->freeNode;
+		ptr->freeNode = node;
+		node = parent;
+	}
+	if (ptr->labelGarbage > RADIX_MIN && ptr->labelGarbage * 2 > ptr->labelSize)
+	{
+		Compact_Label(ptr);
+	}
+	return true;
+}
+
+//将下标"from"改为"to"(键不变，无需访问联系人)
+bool Move_RadixTree(RadixTree* ptr, int from, int to)
+{
+	assert(ptr && to >= 0);
+	if (from < 0 || (size_t)from >= ptr->recordCapacity || ptr->owner[from] == RADIX_NONE)
+	{
+		return false;
+	}
+	Check_Record(ptr, to);
+	int node = ptr->owner[from];
+	int prev = ptr->prev[from], next = ptr->next[from];
+	ptr->owner[to] = node;
+	ptr->prev[to] = prev;
+	ptr->next[to] = next;
+	prev == RADIX_NONE ? (ptr->nodes[node].posting = to) : (ptr->next[prev] = to);
+	if (next != RADIX_NONE)
+	{
+		ptr->prev[next] = to;
+	}
+	ptr->owner[from] = RADIX_NONE;
+	return true;
+}
+
+//按排列改写下标(下标"order[i]"改为"i"，"count"为下标总数，键不变，无需访问联系人)
+void Permute_RadixTree(RadixTree* ptr, const int* order, int count)
+{
+	assert(ptr && (order || count == 0));
+	if (count == 0)
+	{
+		return;
+	}
+	Check_Record(ptr, count - 1);
+	int* where = (int*)malloc(sizeof(int) * count);
+	int* owner = (int*)malloc(sizeof(int) * count);
+	int* prev = (int*)malloc(sizeof(int) * count);
+	int* next = (int*)malloc(sizeof(int) * count);
+	if (where == NULL || owner == NULL || prev == NULL || next == NULL)
+	{
+		perror("Permute_RadixTree");
+		exit(EXIT_FAILURE);
+	}
+	for (int i = 0; i < count; i++)
+	{
+		where[order[i]] = i;
+	}
+	//只有在树中的下标的链表指针有效
+	for (int i = 0; i < count; i++)
+	{
+		int from = order[i];
+		owner[i] = ptr->owner[from];
+		prev[i] = owner[i] == RADIX_NONE || ptr->prev[from] == RADIX_NONE ? RADIX_NONE : where[ptr->prev[from]];
+		next[i] = owner[i] == RADIX_NONE || ptr->next[from] == RADIX_NONE ? RADIX_NONE : where[ptr->next[from]];
+	}
+	memcpy(ptr->owner, owner, sizeof(int) * count);
+	memcpy(ptr->prev, prev, sizeof(int) * count);
+	memcpy(ptr->next, next, sizeof(int) * count);
+	for (int i = 0; i < ptr->size; i++)
+	{
+		if (ptr->nodes[i].posting != RADIX_NONE)
+		{
+			ptr->nodes[i].posting = where[ptr->nodes[i].posting];
+		}
+	}
+	free(where);
+	free(owner);
+	free(prev);
+	free(next);
+}
+
+//查找子树包含全部以"prefix"开头的键的结点，不存在时返回"RADIX_NONE"
+static int Locate_RadixTree(const RadixTree* ptr, const char* prefix)
+{
+	int node = 0;
+	while (*prefix != '\0')
+	{
+		int child = Find_Child(ptr, node, *prefix);
+		if (child == RADIX_NONE)
+		{
+			return RADIX_NONE;
+		}
+		const char* label = ptr->labels + ptr->nodes[child].label;
+		int length = ptr->nodes[child].length;
+		int matched = 1;
+		while (matched < length && prefix[matched] != '\0' && prefix[matched] == label[matched])
+		{
+			matched++;
+		}
+		if (prefix[matched] == '\0')
+		{
+			return child;
+		}
+		if (matched < length)
+		{
+			return RADIX_NONE;
+		}
+		node = child;
+		prefix += matched;
+	}
+	return node;
+}
+
+//前缀查找(返回写入"result"的下标个数，最多"k"个)
+size_t Prefix_RadixTree(const RadixTree* ptr, const char* prefix, int* result, size_t k)
+{
+	assert(ptr && prefix && (result || k == 0));
+	int top = Locate_RadixTree(ptr, prefix);
+	if (top == RADIX_NONE || ptr->nodes[top].count == 0)
+	{
+		return 0;
+	}
+	//不使用栈的先序遍历：先访问子结点，没有子结点时访问兄弟结点，没有兄弟结点时回到父结点
+	size_t count = 0;
+	int node = top;
+	while (count < k)
+	{
+		for (int i = ptr->nodes[node].posting; i != RADIX_NONE && count < k; i = ptr->next[i])
+		{
+			result[count++] = i;
+		}
+		if (ptr->nodes[node].child != RADIX_NONE)
+		{
+			node = ptr->nodes[node].child;
+			continue;
+		}
+		while (node != top && ptr->nodes[node].sibling == RADIX_NONE)
+		{
+			node = ptr->nodes[node].parent;
+		}
+		if (node == top)
+		{
+			break;
+		}
+		node = ptr->nodes[node].sibling;
+	}
+	return count;
+}
+
+//统计键以"prefix"开头的下标个数
+size_t Count_RadixTree(const RadixTree* ptr, const char* prefix)
+{
+	assert(ptr && prefix);
+	int top = Locate_RadixTree(ptr, prefix);
+	return top == RADIX_NONE ? 0 : (size_t)ptr->nodes[top].count;
+}
+
+//清空基数树
+void Clear_RadixTree(RadixTree* ptr)
+{
+	assert(ptr);
+	Reset_Root(ptr);
+	ptr->labelSize = ptr->labelGarbage = 0;
+	if (ptr->edges != NULL)
+	{
+		memset(ptr->edges, 0xFF, sizeof(RadixEdge) * ptr->edgeCapacity);
+	}
+	ptr->edgeSize = 0;
+	if (ptr->owner != NULL)
+	{
+		memset(ptr->owner, 0xFF, sizeof(int) * ptr->recordCapacity);
+	}
+}
+
+//销毁基数树
+void Destroy_RadixTree(RadixTree* ptr)
+{
+	assert(ptr);
+	free(ptr->nodes);
+	free(ptr->edges);
+	free(ptr->labels);
+	free(ptr->owner);
+	free(ptr->prev);
+	free(ptr->next);
+	ptr->nodes = NULL;
+	ptr->edges = NULL;
+	ptr->labels = NULL;
+	ptr->owner = ptr->prev = ptr->next = NULL;
+	ptr->size = ptr->capacity = 0;
+	ptr->edgeSize = ptr->edgeCapacity = 0;
+	ptr->labelSize = ptr->labelCapacity = ptr->labelGarbage = ptr->recordCapacity = 0;
+}
\ No newline at end of file
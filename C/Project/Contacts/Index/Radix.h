@@ -0,0 +1,88 @@
+#pragma once
+
+//引用索引头文件(以使用"IndexKey")
+#include "Index.h"
+
+/*
+ * 基数树(压缩前缀树)前缀索引
+ * 1. 每条边保存一段标签(标签保存在字符池中，以偏移量与长度表示，分裂结点时只需调整偏移量)，子结点按标签首字符升序排列为双向链表。
+ *    由"(父结点，标签首字符)"查找子结点使用开放定址(线性探测)哈希表，因此沿键向下查找时每层的代价与子结点个数无关。
+ * 2. 键在某个结点结束的联系人组成该结点的双向链表(链表指针按联系人下标保存在数组中)，因此删除与移动下标的时间复杂度为：O(1)(不计向上更新计数)。
+ * 3. 每个结点记录子树中的联系人数，前缀查找时可以直接得到匹配总数；子树为空的叶子结点会被回收，以便复用。
+ *    每个字节的标签只属于一个结点，回收结点时累计其标签长度，超过字符池的一半时将存活结点的标签复制到新的字符池中。
+ * 4. 前缀查找先沿标签找到前缀所在的结点，再按先序遍历子树，依次返回前"k"个联系人，因此结果按键的字典序排列，时间复杂度为：O(L + k)。
+ */
+
+//定义标识符
+#define RADIX_NONE (-1)
+#define RADIX_MIN 16
+
+//定义结构体类型(基数树结点)
+typedef struct RadixNode
+{
+	int parent; //回收后为"RADIX_NONE"
+	int child;
+	int sibling;
+	int prior; //前一个兄弟结点
+	int posting;
+	int count;
+	int label;
+	int length;
+} RadixNode;
+
+//定义结构体类型(子结点哈希表的槽，"child"为"RADIX_NONE"时为空槽)
+typedef struct RadixEdge
+{
+	int parent;
+	int child;
+	unsigned char first;
+} RadixEdge;
+
+//定义结构体类型(基数树)
+typedef struct RadixTree
+{
+	RadixNode* nodes;
+	int size;
+	int capacity;
+	int freeNode;
+	RadixEdge* edges;
+	size_t edgeSize;
+	size_t edgeCapacity;
+	char* labels;
+	size_t labelSize;
+	size_t labelCapacity;
+	size_t labelGarbage; //已回收结点的标签长度之和
+	int* owner;
+	int* prev;
+	int* next;
+	size_t recordCapacity;
+	const void* context;
+	IndexKey key;
+} RadixTree;
+
+//初始化基数树("key"返回的键必须为字符串)
+void Init_RadixTree(RadixTree* ptr, const void* context, IndexKey key);
+
+//插入下标
+void Insert_RadixTree(RadixTree* ptr, int index);
+
+//删除下标
+bool Erase_RadixTree(RadixTree* ptr, int index);
+
+//将下标"from"改为"to"(键不变，无需访问联系人)
+bool Move_RadixTree(RadixTree* ptr, int from, int to);
+
+//按排列改写下标(下标"order[i]"改为"i"，"count"为下标总数，键不变，无需访问联系人)
+void Permute_RadixTree(RadixTree* ptr, const int* order, int count);
+
+//前缀查找(返回写入"result"的下标个数，最多"k"个)
+size_t Prefix_RadixTree(const RadixTree* ptr, const char* prefix, int* result, size_t k);
+
+//统计键以"prefix"开头的下标个数
+size_t Count_RadixTree(const RadixTree* ptr, const char* prefix);
+
+//清空基数树
+void Clear_RadixTree(RadixTree* ptr);
+
+//销毁基数树
+void Destroy_RadixTree(RadixTree* ptr);
\ No newline at end of file
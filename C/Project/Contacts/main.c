@@ -1,7 +1,34 @@
 #include "Contacts.h"
 
-int main()
+/*
+ * 通讯录
+ * 1. 不带参数运行时进入菜单。
+ * 2. bench [count]：生成"count"个(默认"10000000"个)联系人，测试保存、读取、查找与修改的耗时。
+ * 3. search [count]：生成"count"个(默认"1000000"个)联系人，测试前缀查找与模糊查找的延迟。
+ * 4. sort [count]：生成"count"个(默认"1000000"个)联系人，比较"qsort"与基数排序的耗时。
+ */
+
+#define DEFAULT_BENCH_COUNT 10000000
+#define DEFAULT_SEARCH_COUNT 1000000
+#define DEFAULT_SORT_COUNT 1000000
+
+int main(int argc, char* argv[])
 {
+	if (argc >= 2 && strcmp(argv[1], "bench") == 0)
+	{
+		Bench_Contacts(argc >= 3 ? atoi(argv[2]) : DEFAULT_BENCH_COUNT);
+		return 0;
+	}
+	if (argc >= 2 && strcmp(argv[1], "search") == 0)
+	{
+		Bench_Search(argc >= 3 ? atoi(argv[2]) : DEFAULT_SEARCH_COUNT);
+		return 0;
+	}
+	if (argc >= 2 && strcmp(argv[1], "sort") == 0)
+	{
+		Bench_Sort(argc >= 3 ? atoi(argv[2]) : DEFAULT_SORT_COUNT);
+		return 0;
+	}
 	int input = 0;
 	Contacts contacts;
 	Init_Contacts(&contacts);
@@ -9,7 +36,10 @@ int main()
 	{
 		Menu();
 		printf("Please enter>>");
-		scanf_s("%d", &input);
+		if (!Scan_Int(&input))
+		{
+			input = feof(stdin) ? EXIT : -1;
+		}
 		switch (input)
 		{
 		case ADD:
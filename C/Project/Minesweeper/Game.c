@@ -172,16 +172,160 @@ void CheckBombs(char bomb_board[ROWS][COLS], char show_board[ROWS][COLS], int ro
 	}
 }
 
+//排查炸弹(运行时大小的棋盘)
+void CheckMineBoard(MineBoard* board)
+{
+	int x, y;
+	long long safe = (long long)board->row * board->col - board->bombs;
+	while (board->revealed < safe)
+	{
+		printf("\nPlease enter the coordinate>>");
+		int result = scanf_s("%d%d", &x, &y);
+		if (result == EOF)
+		{
+			break;
+		}
+		if (result != 2)
+		{
+			int ch;
+			while ((ch = getchar()) != '\n' && ch != EOF);
+			printf("Error!Coordinate is not legal,Please try again.\n");
+			continue;
+		}
+		if (x >= 1 && x <= board->row && y >= 1 && y <= board->col)
+		{
+			if (!IsMineOpen(board, x, y))
+			{
+				if (RevealMineBoard(board, x, y) == MINE_BOOM)
+				{
+					system("cls");
+					printf("\nGame over!You were blown up!\n\n");
+					PrintMineBoard(board, true);
+					printf("\n");
+					system("pause");
+					break;
+				}
+				system("cls");
+				PrintMineBoard(board, false);
+			}
+			else
+			{
+				printf("Error!Repeatedly entering coordinates,Please try again.");
+			}
+		}
+		else
+		{
+			printf("Error!Coordinate is not legal,Please try again.\n");
+		}
+	}
+	if (board->revealed == safe)
+	{
+		system("cls");
+		printf("\nYou're winner!\n\n");
+		PrintMineBoard(board, true);
+		printf("\n");
+		system("pause");
+	}
+}
+
 //游戏主框架
 void Game()
 {
 	system("cls");
-	srand((unsigned)time(NULL));
+	MineBoard board;
+	InitMineBoard(&board, ROW, COL, BOMB);
+	SetMineBombs(&board, (unsigned long long)time(NULL));
+	PrintMineBoard(&board, false);
+	CheckMineBoard(&board);
+	FreeMineBoard(&board);
+}
+
+//取得已用的处理器时间(单位：秒)
+static double GetSeconds()
+{
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+//基准测试(在"row"行"col"列、"bombs"个炸弹的棋盘上测试布雷与翻开的耗时，并与原有的递归展开对照)
+void BenchMineBoard(int row, int col, long long bombs)
+{
+	//对照：在"ROW"行"COL"列的棋盘上，展开结果必须与递归展开完全相同
+	bool succeed = true;
+	MineBoard board;
+	InitMineBoard(&board, ROW, COL, BOMB);
 	char bomb_board[ROWS][COLS];
 	char show_board[ROWS][COLS];
-	InitBoard(bomb_board, ROWS, COLS, '0');
-	InitBoard(show_board, ROWS, COLS, '*');
-	PrintBoard(show_board, ROW, COL);
-	SetBombs(bomb_board, ROW, COL);
-	CheckBombs(bomb_board, show_board, ROW, COL);
+	for (int t = 0; t < BENCH_CHECK && succeed; t++)
+	{
+		SetMineBombs(&board, (unsigned long long)t + 1);
+		InitBoard(bomb_board, ROWS, COLS, '0');
+		InitBoard(show_board, ROWS, COLS, '*');
+		for (int i = 1; i <= ROW; i++)
+		{
+			for (int j = 1; j <= COL; j++)
+			{
+				bomb_board[i][j] = IsMine(&board, i, j) ? '1' : '0';
+			}
+		}
+		int x = 1 + t % ROW, y = 1 + t / ROW % COL;
+		if (bomb_board[x][y] == '1')
+		{
+			continue;
+		}
+		int win = 0;
+		ExpandBoard(bomb_board, show_board, x, y, &win);
+		succeed = RevealMineBoard(&board, x, y) == win;
+		for (int i = 1; i <= ROW && succeed; i++)
+		{
+			for (int j = 1; j <= COL && succeed; j++)
+			{
+				char ch = '*';
+				if (IsMineOpen(&board, i, j))
+				{
+					ch = GetMineCount(&board, i, j) == 0 ? ' ' : (char)('0' + GetMineCount(&board, i, j));
+				}
+				succeed = ch == show_board[i][j];
+			}
+		}
+	}
+	FreeMineBoard(&board);
+	printf("Check：%d boards(%d×%d，%d bombs)，%s\n", BENCH_CHECK, ROW, COL, BOMB, succeed ? "same as ExpandBoard" : "different from ExpandBoard");
+
+	//大棋盘：布雷、从一个空白格子展开、再逐个翻开剩下的全部安全格子
+	printf("Board：%d×%d，Bombs：%lld\n", row, col, bombs);
+	double begin = GetSeconds();
+	InitMineBoard(&board, row, col, bombs);
+	SetMineBombs(&board, 20240104);
+	printf("Set Bombs：%lfs\n", GetSeconds() - begin);
+	int x = (row + 1) / 2, y = (col + 1) / 2;
+	while (x <= row && (IsMine(&board, x, y) || GetMineCount(&board, x, y) != 0))
+	{
+		y = y % col + 1;
+		x += y == 1;
+	}
+	if (x <= row)
+	{
+		begin = GetSeconds();
+		long long opened = RevealMineBoard(&board, x, y);
+		double elapsed = GetSeconds() - begin;
+		printf("First Reveal：%lld cells，%lfs，%lfns/cell，Queue：%zu\n", opened, elapsed, elapsed * 1e9 / opened, board.capacity);
+	}
+	long long reveals = 0;
+	begin = GetSeconds();
+	for (int i = 1; i <= row; i++)
+	{
+		for (int j = 1; j <= col; j++)
+		{
+			if (!IsMine(&board, i, j) && !IsMineOpen(&board, i, j))
+			{
+				succeed = succeed && RevealMineBoard(&board, i, j) > 0;
+				reveals++;
+			}
+		}
+	}
+	double elapsed = GetSeconds() - begin;
+	printf("Sweep：%lld reveals，%lfs\n", reveals, elapsed);
+	succeed = succeed && board.revealed == (long long)row * col - bombs;
+	FreeMineBoard(&board);
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
 }
\ No newline at end of file
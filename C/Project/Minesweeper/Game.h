@@ -5,7 +5,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "MineBoard.h"
+#include "Solver.h"
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#define scanf_s scanf
+#endif
 
 //定义标识符
 #define ROW 9        //定义二维数组行数(ROW)
@@ -13,6 +19,15 @@
 #define BOMB 10      //定义炸弹个数(BOMB)
 #define ROWS ROW+2   //定义棋盘行数(ROWS)
 #define COLS COL+2   //定义棋盘列数(COLS)
+#define BENCH_ROW 10000  //定义基准测试的默认行数(BENCH_ROW)
+#define BENCH_COL 10000  //定义基准测试的默认列数(BENCH_COL)
+#define BENCH_BOMB 1     //定义基准测试的默认炸弹比例(BENCH_BOMB%)
+#define BENCH_CHECK 1000 //定义与递归展开对照的棋盘数(BENCH_CHECK)
+#define SOLVE_GAMES 10000 //定义批量求解的默认局数(SOLVE_GAMES)
+#define SOLVE_THREADS 4   //定义批量求解的默认线程数(SOLVE_THREADS)
+#define SOLVE_ROW 16      //定义批量求解的默认行数(SOLVE_ROW)
+#define SOLVE_COL 30      //定义批量求解的默认列数(SOLVE_COL)
+#define SOLVE_BOMB 99     //定义批量求解的默认炸弹个数(SOLVE_BOMB)
 
 //菜单
 void Menu();
@@ -39,4 +54,10 @@ void CheckBombs(char bomb_board[ROWS][COLS], char show_board[ROWS][COLS], int ro
 void ChangeBombs(char bomb_board[ROWS][COLS], int x, int y);
 
 //自动展开棋盘
-void ExpandBoard(char bomb_board[ROWS][COLS], char show_board[ROWS][COLS], int x, int y, int* ptr);
\ No newline at end of file
+void ExpandBoard(char bomb_board[ROWS][COLS], char show_board[ROWS][COLS], int x, int y, int* ptr);
+
+//排查炸弹(运行时大小的棋盘)
+void CheckMineBoard(MineBoard* board);
+
+//基准测试(在"row"行"col"列、"bombs"个炸弹的棋盘上测试布雷与翻开的耗时，并与原有的递归展开对照)
+void BenchMineBoard(int row, int col, long long bombs);
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "MineBoard.h"
+
+//置位棋盘的第"cell"位
+static inline void SetMineBit(unsigned long long* bits, int cell)
+{
+	bits[cell >> 6] |= 1ULL << (cell & 63);
+}
+
+//清除位棋盘的第"cell"位
+static inline void ClearMineBit(unsigned long long* bits, int cell)
+{
+	bits[cell >> 6] &= ~(1ULL << (cell & 63));
+}
+
+//生成随机数("SplitMix64"，"rand"的范围太小，无法覆盖大棋盘)
+static unsigned long long NextMineRandom(unsigned long long* seed)
+{
+	unsigned long long z = (*seed += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+//随机取得一个格子(不含边界)
+static int RandomMineCell(MineBoard* board)
+{
+	unsigned long long random = NextMineRandom(&board->seed);
+	int x = 1 + (int)((random & 0xFFFFFFFFULL) % (unsigned long long)board->row);
+	int y = 1 + (int)((random >> 32) % (unsigned long long)board->col);
+	return GetMineCell(board, x, y);
+}
+
+//更新格子周围的炸弹数("delta"为"1"或"-1")
+static void AddMineCount(MineBoard* board, int cell, int delta)
+{
+	int cols = board->cols;
+	const int offsets[8] = { -cols - 1, -cols, -cols + 1, -1, 1, cols - 1, cols, cols + 1 };
+	for (int i = 0; i < 8; i++)
+	{
+		board->count[cell + offsets[i]] += delta;
+	}
+}
+
+//初始化棋盘("row"行"col"列，"bombs"个炸弹；炸弹个数必须小于格子数，含边界的格子数不能超过"INT_MAX")
+void InitMineBoard(MineBoard* board, int row, int col, long long bombs)
+{
+	assert(board && row > 0 && col > 0 && bombs >= 0 && bombs < (long long)row * col);
+	assert((long long)(row + 2) * (col + 2) <= INT_MAX);
+	board->row = row;
+	board->col = col;
+	board->cols = col + 2;
+	board->bombs = bombs;
+	board->revealed = 0;
+	size_t cells = (size_t)(row + 2) * (size_t)(col + 2);
+	size_t words = (cells + 63) / 64;
+	board->count = (unsigned char*)calloc(cells, sizeof(unsigned char));
+	board->mine = (unsigned long long*)calloc(words, sizeof(unsigned long long));
+	board->open = (unsigned long long*)calloc(words, sizeof(unsigned long long));
+	board->queue = (int*)malloc(sizeof(int) * MINE_QUEUE_MIN);
+	if (board->count == NULL || board->mine == NULL || board->open == NULL || board->queue == NULL)
+	{
+		perror("InitMineBoard");
+		exit(EXIT_FAILURE);
+	}
+	board->capacity = MINE_QUEUE_MIN;
+	board->seed = 0;
+}
+
+//释放棋盘
+void FreeMineBoard(MineBoard* board)
+{
+	assert(board);
+	free(board->count);
+	free(board->mine);
+	free(board->open);
+	free(board->queue);
+	board->count = NULL;
+	board->mine = board->open = NULL;
+	board->queue = NULL;
+	board->capacity = 0;
+}
+
+//设置炸弹(清空棋盘后按种子"seed"随机布雷，并算出每个格子周围的炸弹数)
+void SetMineBombs(MineBoard* board, unsigned long long seed)
+{
+	assert(board);
+	int row = board->row, col = board->col, cols = board->cols;
+	size_t cells = (size_t)(row + 2) * (size_t)cols;
+	size_t words = (cells + 63) / 64;
+	memset(board->count, 0, cells);
+	memset(board->mine, 0, sizeof(unsigned long long) * words);
+	memset(board->open, 0, sizeof(unsigned long long) * words);
+	//边界格标记为已翻开，展开时不会越过边界
+	for (int y = 0; y < cols; y++)
+	{
+		SetMineBit(board->open, y);
+		SetMineBit(board->open, (row + 1) * cols + y);
+	}
+	for (int x = 1; x <= row; x++)
+	{
+		SetMineBit(board->open, x * cols);
+		SetMineBit(board->open, x * cols + col + 1);
+	}
+	board->revealed = 0;
+	board->seed = seed;
+	//炸弹超过一半时先布满再随机挖空，避免随机取格子时反复碰到炸弹
+	long long total = (long long)row * col;
+	bool dense = board->bombs * 2 > total;
+	long long target = dense ? total - board->bombs : board->bombs;
+	if (dense)
+	{
+		for (int x = 1; x <= row; x++)
+		{
+			for (int y = 1; y <= col; y++)
+			{
+				SetMineBit(board->mine, x * cols + y);
+			}
+		}
+	}
+	while (target > 0)
+	{
+		int cell = RandomMineCell(board);
+		if (TestMineBit(board->mine, cell) == dense)
+		{
+			dense ? ClearMineBit(board->mine, cell) : SetMineBit(board->mine, cell);
+			target--;
+		}
+	}
+	//每个炸弹使周围八个格子的炸弹数加一(边界格的炸弹数不会被读取)，整字为零时跳过六十四个格子
+	for (size_t w = 0; w < words; w++)
+	{
+		unsigned long long bits = board->mine[w];
+		for (int b = 0; bits != 0; b++, bits >>= 1)
+		{
+			if (bits & 1)
+			{
+				AddMineCount(board, (int)(w * 64 + b), 1);
+			}
+		}
+	}
+}
+
+//更改炸弹(把坐标处的炸弹移动到随机的空格子，防止第一次被炸死)
+void ChangeMineBombs(MineBoard* board, int x, int y)
+{
+	assert(board && x >= 1 && x <= board->row && y >= 1 && y <= board->col);
+	int cell = GetMineCell(board, x, y);
+	if (!TestMineBit(board->mine, cell))
+	{
+		return;
+	}
+	int target;
+	do
+	{
+		target = RandomMineCell(board);
+	} while (target == cell || TestMineBit(board->mine, target));
+	ClearMineBit(board->mine, cell);
+	AddMineCount(board, cell, -1);
+	SetMineBit(board->mine, target);
+	AddMineCount(board, target, 1);
+}
+
+//翻开坐标处的格子(空白格子自动展开，返回新翻开的格子数，翻开炸弹时返回"MINE_BOOM")
+long long RevealMineBoard(MineBoard* board, int x, int y)
+{
+	assert(board && x >= 1 && x <= board->row && y >= 1 && y <= board->col);
+	int start = GetMineCell(board, x, y);
+	if (TestMineBit(board->open, start))
+	{
+		return 0;
+	}
+	if (TestMineBit(board->mine, start))
+	{
+		if (board->revealed != 0)
+		{
+			return MINE_BOOM;
+		}
+		ChangeMineBombs(board, x, y);
+	}
+	SetMineBit(board->open, start);
+	long long opened = 1;
+	if (board->count[start] == 0)
+	{
+		//空白格子周围一定没有炸弹，把未翻开的相邻格子全部翻开，其中的空白格子入队继续展开
+		int cols = board->cols;
+		const int offsets[8] = { -cols - 1, -cols, -cols + 1, -1, 1, cols - 1, cols, cols + 1 };
+		int* queue = board->queue;
+		size_t capacity = board->capacity;
+		size_t head = 0, size = 0;
+		queue[size++] = start;
+		while (size > 0)
+		{
+			int cell = queue[head];
+			head = (head + 1) & (capacity - 1);
+			size--;
+			for (int i = 0; i < 8; i++)
+			{
+				int next = cell + offsets[i];
+				if (TestMineBit(board->open, next))
+				{
+					continue;
+				}
+				SetMineBit(board->open, next);
+				opened++;
+				if (board->count[next] != 0)
+				{
+					continue;
+				}
+				if (size == capacity)
+				{
+					//环形队列已满：容量翻倍，把绕回开头的部分接到原来的末尾之后
+					int* tmp = (int*)realloc(queue, sizeof(int) * capacity * 2);
+					if (tmp == NULL)
+					{
+						perror("RevealMineBoard");
+						exit(EXIT_FAILURE);
+					}
+					queue = tmp;
+					memcpy(queue + capacity, queue, sizeof(int) * head);
+					capacity *= 2;
+				}
+				queue[(head + size) & (capacity - 1)] = next;
+				size++;
+			}
+		}
+		board->queue = queue;
+		board->capacity = capacity;
+	}
+	board->revealed += opened;
+	return opened;
+}
+
+//打印棋盘("all"为真时打印炸弹位置)
+void PrintMineBoard(const MineBoard* board, bool all)
+{
+	assert(board);
+	printf("\n\t\t\t\t\t\t----Minesweeper----\n\n\t\t\t\t\t\t");
+	for (int i = 0; i <= board->col; i++)
+	{
+		printf("%d ", i);
+	}
+	printf("\n");
+	for (int i = 1; i <= board->row; i++)
+	{
+		printf("\t\t\t\t\t\t%d ", i);
+		for (int j = 1; j <= board->col; j++)
+		{
+			char ch = '*';
+			if (all)
+			{
+				ch = IsMine(board, i, j) ? '1' : '0';
+			}
+			else if (IsMineOpen(board, i, j))
+			{
+				ch = GetMineCount(board, i, j) == 0 ? ' ' : (char)('0' + GetMineCount(board, i, j));
+			}
+			printf("%c ", ch);
+		}
+		printf("\n");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+//引用头文件
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <limits.h>
+#include <stdbool.h>
+
+/*
+ * 运行时大小的扫雷棋盘
+ * 1. 棋盘四周各多出一圈边界格(与"ROWS"、"COLS"相同)，格子按行优先编号为"x * cols + y"，访问相邻格子时无需判断越界。
+ * 2. 炸弹与已翻开的格子各用一个位棋盘保存(每个格子一位)，边界格一开始就标记为已翻开。
+ * 3. 每个格子周围的炸弹数在布雷时预先算好，移动炸弹时只更新它周围的格子。
+ * 4. 翻开空白格子时用显式队列做广度优先展开(队列按需扩容)，入队前即标记为已翻开，每个格子最多入队一次，不会因递归过深而栈溢出。
+ */
+
+//定义标识符
+#define MINE_BOOM (-1)       //翻开了炸弹
+#define MINE_QUEUE_MIN 64    //展开队列的初始容量
+
+//定义结构体类型(扫雷棋盘)
+typedef struct MineBoard
+{
+	int row;
+	int col;
+	int cols;                 //每行的格子数(含边界)
+	long long bombs;
+	long long revealed;       //已翻开的格子数(不含边界)
+	unsigned char* count;     //周围的炸弹数
+	unsigned long long* mine; //炸弹位棋盘
+	unsigned long long* open; //已翻开位棋盘
+	int* queue;
+	size_t capacity;
+	unsigned long long seed;
+} MineBoard;
+
+//判断位棋盘的第"cell"位
+static inline bool TestMineBit(const unsigned long long* bits, int cell)
+{
+	return (bits[cell >> 6] >> (cell & 63)) & 1;
+}
+
+//取得格子编号
+static inline int GetMineCell(const MineBoard* board, int x, int y)
+{
+	return x * board->cols + y;
+}
+
+//判断坐标处是否是炸弹
+static inline bool IsMine(const MineBoard* board, int x, int y)
+{
+	return TestMineBit(board->mine, GetMineCell(board, x, y));
+}
+
+//判断坐标处是否已翻开
+static inline bool IsMineOpen(const MineBoard* board, int x, int y)
+{
+	return TestMineBit(board->open, GetMineCell(board, x, y));
+}
+
+//获取坐标周围的炸弹数量(预先算好)
+static inline int GetMineCount(const MineBoard* board, int x, int y)
+{
+	return board->count[GetMineCell(board, x, y)];
+}
+
+//初始化棋盘("row"行"col"列，"bombs"个炸弹；炸弹个数必须小于格子数，含边界的格子数不能超过"INT_MAX")
+void InitMineBoard(MineBoard* board, int row, int col, long long bombs);
+
+//释放棋盘
+void FreeMineBoard(MineBoard* board);
+
+//设置炸弹(清空棋盘后按种子"seed"随机布雷，并算出每个格子周围的炸弹数)
+void SetMineBombs(MineBoard* board, unsigned long long seed);
+
+//更改炸弹(把坐标处的炸弹移动到随机的空格子，防止第一次被炸死)
+void ChangeMineBombs(MineBoard* board, int x, int y);
+
+//翻开坐标处的格子(空白格子自动展开，返回新翻开的格子数，翻开炸弹时返回"MINE_BOOM")
+long long RevealMineBoard(MineBoard* board, int x, int y);
+
+//打印棋盘("all"为真时打印炸弹位置)
+void PrintMineBoard(const MineBoard* board, bool all);
\ No newline at end of file
@@ -0,0 +1,797 @@
+#include "Solver.h"
+
+//定义结构体类型(分量的枚举结果)
+typedef struct MineComponent
+{
+	int begin;     //分量的变量在"order"中的起始位置
+	int size;      //变量个数
+	bool exact;    //是否完成了精确枚举
+	double* total; //"total[k]"为恰有"k"个炸弹的解的个数
+	double* hits;  //"hits[i * (size + 1) + k]"为恰有"k"个炸弹且第"i"个变量是炸弹的解的个数
+} MineComponent;
+
+//定义结构体类型(回溯枚举的状态)
+typedef struct MineEnumeration
+{
+	MineSolver* solver;
+	MineComponent* component;
+	long long nodes;
+	int mines;
+	long long limit;
+} MineEnumeration;
+
+//置位已标记的炸弹
+static inline void SetFlagBit(unsigned long long* bits, int cell)
+{
+	bits[cell >> 6] |= 1ULL << (cell & 63);
+}
+
+//判断格子是否未知(既未翻开也未标记)
+static inline bool IsUnknown(const MineSolver* solver, int cell)
+{
+	return !TestMineBit(solver->board->open, cell) && !TestMineBit(solver->flag, cell);
+}
+
+//取得相邻格子的编号偏移
+static void GetOffsets(const MineBoard* board, int offsets[8])
+{
+	int cols = board->cols;
+	int init[8] = { -cols - 1, -cols, -cols + 1, -1, 1, cols - 1, cols, cols + 1 };
+	memcpy(offsets, init, sizeof(init));
+}
+
+//分配数组(失败时退出)
+static void* AllocSolver(size_t size)
+{
+	void* ptr = malloc(size);
+	if (ptr == NULL)
+	{
+		perror("AllocSolver");
+		exit(EXIT_FAILURE);
+	}
+	return ptr;
+}
+
+//初始化求解器
+void InitMineSolver(MineSolver* solver, MineBoard* board)
+{
+	assert(solver && board);
+	size_t cells = (size_t)(board->row + 2) * (size_t)board->cols;
+	solver->board = board;
+	solver->flag = (unsigned long long*)calloc((cells + 63) / 64, sizeof(unsigned long long));
+	if (solver->flag == NULL)
+	{
+		perror("InitMineSolver");
+		exit(EXIT_FAILURE);
+	}
+	solver->flags = 0;
+	solver->constraintOf = (int*)AllocSolver(sizeof(int) * cells);
+	solver->varOf = (int*)AllocSolver(sizeof(int) * cells);
+	memset(solver->constraintOf, 0xFF, sizeof(int) * cells);
+	memset(solver->varOf, 0xFF, sizeof(int) * cells);
+	solver->constraints = (MineConstraint*)AllocSolver(sizeof(MineConstraint) * cells);
+	solver->vars = (int*)AllocSolver(sizeof(int) * cells);
+	solver->order = (int*)AllocSolver(sizeof(int) * cells);
+	solver->component = (int*)AllocSolver(sizeof(int) * cells);
+	solver->assigned = (int*)AllocSolver(sizeof(int) * cells);
+	solver->mines = (int*)AllocSolver(sizeof(int) * cells);
+	solver->left = (int*)AllocSolver(sizeof(int) * cells);
+	solver->probability = (double*)AllocSolver(sizeof(double) * cells);
+	solver->capacity = cells;
+	solver->constraintCount = solver->varCount = 0;
+	solver->guesses = 0;
+}
+
+//释放求解器
+void FreeMineSolver(MineSolver* solver)
+{
+	assert(solver);
+	free(solver->flag);
+	free(solver->constraintOf);
+	free(solver->varOf);
+	free(solver->constraints);
+	free(solver->vars);
+	free(solver->order);
+	free(solver->component);
+	free(solver->assigned);
+	free(solver->mines);
+	free(solver->left);
+	free(solver->probability);
+	memset(solver, 0, sizeof(MineSolver));
+}
+
+//翻开格子(返回"MINE_BOOM"表示失败)
+static long long RevealCell(MineSolver* solver, int cell)
+{
+	return RevealMineBoard(solver->board, cell / solver->board->cols, cell % solver->board->cols);
+}
+
+//标记炸弹
+static void FlagCell(MineSolver* solver, int cell)
+{
+	if (!TestMineBit(solver->flag, cell))
+	{
+		SetFlagBit(solver->flag, cell);
+		solver->flags++;
+	}
+}
+
+//清除上一轮的约束与变量
+static void ClearConstraints(MineSolver* solver)
+{
+	for (int i = 0; i < solver->constraintCount; i++)
+	{
+		solver->constraintOf[solver->constraints[i].cell] = -1;
+	}
+	for (int i = 0; i < solver->varCount; i++)
+	{
+		solver->varOf[solver->vars[i]] = -1;
+	}
+	solver->constraintCount = solver->varCount = 0;
+}
+
+//收集约束：每个周围还有未知格子的数字格子
+static void BuildConstraints(MineSolver* solver)
+{
+	ClearConstraints(solver);
+	MineBoard* board = solver->board;
+	int offsets[8];
+	GetOffsets(board, offsets);
+	for (int x = 1; x <= board->row; x++)
+	{
+		for (int y = 1; y <= board->col; y++)
+		{
+			int cell = GetMineCell(board, x, y);
+			if (!TestMineBit(board->open, cell) || board->count[cell] == 0)
+			{
+				continue;
+			}
+			MineConstraint* constraint = solver->constraints + solver->constraintCount;
+			constraint->cell = cell;
+			constraint->need = board->count[cell];
+			constraint->size = 0;
+			for (int i = 0; i < 8; i++)
+			{
+				int next = cell + offsets[i];
+				if (TestMineBit(solver->flag, next))
+				{
+					constraint->need--;
+				}
+				else if (!TestMineBit(board->open, next))
+				{
+					constraint->cells[constraint->size++] = next;
+				}
+			}
+			if (constraint->size > 0)
+			{
+				solver->constraintOf[cell] = solver->constraintCount++;
+			}
+		}
+	}
+}
+
+//单格推理(返回本轮翻开与标记的格子数，失败时返回"MINE_BOOM")
+static long long SolveSingle(MineSolver* solver)
+{
+	long long progress = 0;
+	for (int i = 0; i < solver->constraintCount; i++)
+	{
+		const MineConstraint* constraint = solver->constraints + i;
+		if (constraint->need != 0 && constraint->need != constraint->size)
+		{
+			continue;
+		}
+		for (int j = 0; j < constraint->size; j++)
+		{
+			int cell = constraint->cells[j];
+			if (!IsUnknown(solver, cell))
+			{
+				continue;
+			}
+			if (constraint->need == 0)
+			{
+				if (RevealCell(solver, cell) == MINE_BOOM)
+				{
+					return MINE_BOOM;
+				}
+			}
+			else
+			{
+				FlagCell(solver, cell);
+			}
+			progress++;
+		}
+	}
+	return progress;
+}
+
+//判断约束"a"的未知格子是否都在约束"b"中
+static bool IsSubset(const MineConstraint* a, const MineConstraint* b)
+{
+	for (int i = 0; i < a->size; i++)
+	{
+		bool found = false;
+		for (int j = 0; j < b->size && !found; j++)
+		{
+			found = a->cells[i] == b->cells[j];
+		}
+		if (!found)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//子集推理(只比较数字格子相距不超过两格的约束，返回本轮翻开与标记的格子数，失败时返回"MINE_BOOM")
+static long long SolveSubset(MineSolver* solver)
+{
+	MineBoard* board = solver->board;
+	long long progress = 0;
+	for (int i = 0; i < solver->constraintCount; i++)
+	{
+		const MineConstraint* a = solver->constraints + i;
+		for (int dx = -2; dx <= 2; dx++)
+		{
+			for (int dy = -2; dy <= 2; dy++)
+			{
+				int x = a->cell / board->cols + dx, y = a->cell % board->cols + dy;
+				if ((dx == 0 && dy == 0) || x < 1 || x > board->row || y < 1 || y > board->col)
+				{
+					continue;
+				}
+				int index = solver->constraintOf[GetMineCell(board, x, y)];
+				if (index < 0 || solver->constraints[index].size <= a->size || !IsSubset(a, solver->constraints + index))
+				{
+					continue;
+				}
+				const MineConstraint* b = solver->constraints + index;
+				int rest = b->need - a->need, size = b->size - a->size;
+				if (rest != 0 && rest != size)
+				{
+					continue;
+				}
+				for (int j = 0; j < b->size; j++)
+				{
+					int cell = b->cells[j];
+					bool shared = false;
+					for (int k = 0; k < a->size && !shared; k++)
+					{
+						shared = a->cells[k] == cell;
+					}
+					if (shared || !IsUnknown(solver, cell))
+					{
+						continue;
+					}
+					if (rest == 0)
+					{
+						if (RevealCell(solver, cell) == MINE_BOOM)
+						{
+							return MINE_BOOM;
+						}
+					}
+					else
+					{
+						FlagCell(solver, cell);
+					}
+					progress++;
+				}
+			}
+		}
+	}
+	return progress;
+}
+
+//回溯枚举分量中第"depth"个变量的取值
+static void EnumerateMines(MineEnumeration* e, int depth)
+{
+	MineSolver* solver = e->solver;
+	MineComponent* component = e->component;
+	if (!component->exact)
+	{
+		return;
+	}
+	if (++e->nodes > SOLVER_MAX_NODES)
+	{
+		component->exact = false;
+		return;
+	}
+	if (depth == component->size)
+	{
+		component->total[e->mines]++;
+		for (int i = 0; i < component->size; i++)
+		{
+			if (solver->assigned[solver->order[component->begin + i]])
+			{
+				component->hits[i * (component->size + 1) + e->mines]++;
+			}
+		}
+		return;
+	}
+	int var = solver->order[component->begin + depth];
+	int cell = solver->vars[var];
+	int offsets[8];
+	GetOffsets(solver->board, offsets);
+	for (int value = 0; value <= 1; value++)
+	{
+		if (value == 1 && e->mines + 1 > e->limit)
+		{
+			break;
+		}
+		//变量取值后，周围的每个约束仍须可以满足
+		bool feasible = true;
+		for (int i = 0; i < 8; i++)
+		{
+			int index = solver->constraintOf[cell + offsets[i]];
+			if (index >= 0)
+			{
+				solver->mines[index] += value;
+				solver->left[index]--;
+				int need = solver->constraints[index].need;
+				feasible = feasible && solver->mines[index] <= need && solver->mines[index] + solver->left[index] >= need;
+			}
+		}
+		if (feasible)
+		{
+			solver->assigned[var] = value;
+			e->mines += value;
+			EnumerateMines(e, depth + 1);
+			e->mines -= value;
+		}
+		for (int i = 0; i < 8; i++)
+		{
+			int index = solver->constraintOf[cell + offsets[i]];
+			if (index >= 0)
+			{
+				solver->mines[index] -= value;
+				solver->left[index]++;
+			}
+		}
+	}
+}
+
+//卷积(多项式乘法："result"的长度为"m + n - 1")
+static void Convolve(const double* a, int m, const double* b, int n, double* result)
+{
+	for (int i = 0; i < m + n - 1; i++)
+	{
+		result[i] = 0;
+	}
+	for (int i = 0; i < m; i++)
+	{
+		for (int j = 0; j < n && a[i] != 0; j++)
+		{
+			result[i + j] += a[i] * b[j];
+		}
+	}
+}
+
+//划分分量并逐个枚举(返回分量个数，分量保存在"*result"中)
+static int BuildComponents(MineSolver* solver, MineComponent** result)
+{
+	//收集变量：约束周围的未知格子
+	for (int i = 0; i < solver->constraintCount; i++)
+	{
+		MineConstraint* constraint = solver->constraints + i;
+		for (int j = 0; j < constraint->size; j++)
+		{
+			int cell = constraint->cells[j];
+			if (solver->varOf[cell] < 0)
+			{
+				solver->varOf[cell] = solver->varCount;
+				solver->vars[solver->varCount] = cell;
+				solver->component[solver->varCount] = -1;
+				solver->varCount++;
+			}
+			constraint->vars[j] = solver->varOf[cell];
+		}
+		solver->mines[i] = 0;
+		solver->left[i] = constraint->size;
+	}
+	//广度优先划分分量(同一约束中的变量属于同一分量)，"order"中相邻的变量共享约束，枚举时剪枝更早
+	MineComponent* components = (MineComponent*)AllocSolver(sizeof(MineComponent) * (size_t)(solver->varCount + 1));
+	int count = 0, size = 0;
+	int offsets[8];
+	GetOffsets(solver->board, offsets);
+	for (int start = 0; start < solver->varCount; start++)
+	{
+		if (solver->component[start] >= 0)
+		{
+			continue;
+		}
+		int begin = size;
+		solver->component[start] = count;
+		solver->order[size++] = start;
+		for (int head = begin; head < size; head++)
+		{
+			int cell = solver->vars[solver->order[head]];
+			for (int i = 0; i < 8; i++)
+			{
+				int index = solver->constraintOf[cell + offsets[i]];
+				if (index < 0)
+				{
+					continue;
+				}
+				const MineConstraint* constraint = solver->constraints + index;
+				for (int j = 0; j < constraint->size; j++)
+				{
+					int var = constraint->vars[j];
+					if (solver->component[var] < 0)
+					{
+						solver->component[var] = count;
+						solver->order[size++] = var;
+					}
+				}
+			}
+		}
+		MineComponent* component = components + count++;
+		component->begin = begin;
+		component->size = size - begin;
+		component->exact = true;
+		component->total = (double*)calloc((size_t)component->size + 1, sizeof(double));
+		component->hits = (double*)calloc((size_t)component->size * (size_t)(component->size + 1), sizeof(double));
+		if (component->total == NULL || component->hits == NULL)
+		{
+			perror("BuildComponents");
+			exit(EXIT_FAILURE);
+		}
+		MineEnumeration e = { solver, component, 0, 0, solver->board->bombs - solver->flags };
+		EnumerateMines(&e, 0);
+		//解的个数按最大值归一化(只影响比例)，避免多个分量相乘后溢出
+		double max = 0;
+		for (int k = 0; k <= component->size; k++)
+		{
+			max = component->total[k] > max ? component->total[k] : max;
+		}
+		if (!component->exact || max == 0)
+		{
+			component->exact = false;
+			continue;
+		}
+		for (int k = 0; k <= component->size; k++)
+		{
+			component->total[k] /= max;
+		}
+		for (int i = 0; i < component->size * (component->size + 1); i++)
+		{
+			component->hits[i] /= max;
+		}
+	}
+	*result = components;
+	return count;
+}
+
+//取组合数的对数
+static double LogChoose(long long n, long long k)
+{
+	return lgamma((double)n + 1) - lgamma((double)k + 1) - lgamma((double)(n - k) + 1);
+}
+
+//概率推理(返回本轮翻开与标记的格子数，失败时返回"MINE_BOOM")
+static long long SolveProbability(MineSolver* solver)
+{
+	MineBoard* board = solver->board;
+	MineComponent* components;
+	int count = BuildComponents(solver, &components);
+	int offsets[8];
+	GetOffsets(board, offsets);
+	//内部格子：不与约束相邻的未知格子，以及未能精确枚举的分量中的格子
+	long long interior = 0;
+	int firstInterior = -1, firstNeighbors = 9;
+	for (int x = 1; x <= board->row; x++)
+	{
+		for (int y = 1; y <= board->col; y++)
+		{
+			int cell = GetMineCell(board, x, y);
+			if (IsUnknown(solver, cell) && solver->varOf[cell] < 0)
+			{
+				//猜测内部格子时优先选相邻格子少的(角上、边上)，它是空白格子的可能性更大，翻开后能展开更多格子
+				int neighbors = (x == 1 || x == board->row ? 2 : 3) * (y == 1 || y == board->col ? 2 : 3) - 1;
+				if (neighbors < firstNeighbors)
+				{
+					firstInterior = cell;
+					firstNeighbors = neighbors;
+				}
+				interior++;
+			}
+		}
+	}
+	int maxMines = 0;
+	for (int c = 0; c < count; c++)
+	{
+		if (components[c].exact)
+		{
+			maxMines += components[c].size;
+		}
+		else
+		{
+			interior += components[c].size;
+		}
+	}
+	//"weights[K]"：精确分量共有"K"个炸弹时，其余"M - K"个炸弹在内部格子中的组合数(相对值)
+	long long remain = board->bombs - solver->flags;
+	double* weights = (double*)AllocSolver(sizeof(double) * (size_t)(maxMines + 1));
+	double maxLog = -HUGE_VAL;
+	for (int k = 0; k <= maxMines; k++)
+	{
+		weights[k] = remain - k >= 0 && remain - k <= interior ? LogChoose(interior, remain - k) : -HUGE_VAL;
+		maxLog = weights[k] > maxLog ? weights[k] : maxLog;
+	}
+	for (int k = 0; k <= maxMines; k++)
+	{
+		weights[k] = weights[k] == -HUGE_VAL ? 0 : exp(weights[k] - maxLog);
+	}
+	//前缀与后缀卷积：除分量"c"以外的全部精确分量的炸弹数分布为"prefix[c]"与"suffix[c + 1]"的卷积
+	double** prefix = (double**)AllocSolver(sizeof(double*) * (size_t)(count + 1));
+	double** suffix = (double**)AllocSolver(sizeof(double*) * (size_t)(count + 1));
+	int* prefixSize = (int*)AllocSolver(sizeof(int) * (size_t)(count + 1));
+	int* suffixSize = (int*)AllocSolver(sizeof(int) * (size_t)(count + 1));
+	double* other = (double*)AllocSolver(sizeof(double) * (size_t)(maxMines + 1));
+	double* scale = (double*)AllocSolver(sizeof(double) * (size_t)(maxMines + 1));
+	prefix[0] = (double*)AllocSolver(sizeof(double));
+	prefix[0][0] = 1;
+	prefixSize[0] = 1;
+	suffix[count] = (double*)AllocSolver(sizeof(double));
+	suffix[count][0] = 1;
+	suffixSize[count] = 1;
+	for (int c = 0; c < count; c++)
+	{
+		int n = components[c].exact ? components[c].size + 1 : 1;
+		const double* total = components[c].exact ? components[c].total : suffix[count];
+		prefixSize[c + 1] = prefixSize[c] + n - 1;
+		prefix[c + 1] = (double*)AllocSolver(sizeof(double) * (size_t)prefixSize[c + 1]);
+		Convolve(prefix[c], prefixSize[c], total, n, prefix[c + 1]);
+	}
+	for (int c = count - 1; c >= 0; c--)
+	{
+		int n = components[c].exact ? components[c].size + 1 : 1;
+		const double* total = components[c].exact ? components[c].total : prefix[0];
+		suffixSize[c] = suffixSize[c + 1] + n - 1;
+		suffix[c] = (double*)AllocSolver(sizeof(double) * (size_t)suffixSize[c]);
+		Convolve(suffix[c + 1], suffixSize[c + 1], total, n, suffix[c]);
+	}
+	//精确分量中每个变量的概率："scale[k]"为本分量有"k"个炸弹时其余部分的权重之和
+	for (int c = 0; c < count; c++)
+	{
+		MineComponent* component = components + c;
+		if (!component->exact)
+		{
+			//局部估计：取相邻约束中剩余炸弹比例的最大值
+			for (int i = 0; i < component->size; i++)
+			{
+				int var = solver->order[component->begin + i];
+				double p = 0;
+				for (int j = 0; j < 8; j++)
+				{
+					int index = solver->constraintOf[solver->vars[var] + offsets[j]];
+					if (index >= 0 && (double)solver->constraints[index].need / solver->constraints[index].size > p)
+					{
+						p = (double)solver->constraints[index].need / solver->constraints[index].size;
+					}
+				}
+				solver->probability[var] = p > 0 && p < 1 ? p : 0.5;
+			}
+			continue;
+		}
+		int n = prefixSize[c] + suffixSize[c + 1] - 1;
+		Convolve(prefix[c], prefixSize[c], suffix[c + 1], suffixSize[c + 1], other);
+		double sum = 0;
+		for (int k = 0; k <= component->size; k++)
+		{
+			scale[k] = 0;
+			for (int j = 0; j < n && k + j <= maxMines; j++)
+			{
+				scale[k] += other[j] * weights[k + j];
+			}
+			sum += component->total[k] * scale[k];
+		}
+		for (int i = 0; i < component->size; i++)
+		{
+			double hit = 0;
+			for (int k = 0; k <= component->size; k++)
+			{
+				hit += component->hits[i * (component->size + 1) + k] * scale[k];
+			}
+			solver->probability[solver->order[component->begin + i]] = sum > 0 ? hit / sum : 0.5;
+		}
+	}
+	//内部格子的概率：内部炸弹数的期望除以内部格子数
+	double interiorProbability = 1;
+	if (interior > 0)
+	{
+		double expected = 0, sum = 0;
+		for (int k = 0; k < prefixSize[count]; k++)
+		{
+			expected += prefix[count][k] * weights[k] * (double)(remain - k);
+			sum += prefix[count][k] * weights[k];
+		}
+		interiorProbability = sum > 0 ? expected / sum / (double)interior : 1;
+	}
+	for (int c = 0; c <= count; c++)
+	{
+		free(prefix[c]);
+		free(suffix[c]);
+	}
+	free(prefix);
+	free(suffix);
+	free(prefixSize);
+	free(suffixSize);
+	free(other);
+	free(scale);
+	free(weights);
+
+	//先处理确定的格子：概率为零的翻开，为一的标记
+	long long progress = 0;
+	int best = -1;
+	double bestProbability = 2;
+	for (int c = 0; c < count; c++)
+	{
+		for (int i = 0; i < components[c].size; i++)
+		{
+			int var = solver->order[components[c].begin + i];
+			int cell = solver->vars[var];
+			double p = solver->probability[var];
+			if (components[c].exact && p == 0)
+			{
+				if (RevealCell(solver, cell) == MINE_BOOM)
+				{
+					progress = MINE_BOOM;
+					break;
+				}
+				progress++;
+			}
+			else if (components[c].exact && p == 1)
+			{
+				FlagCell(solver, cell);
+				progress++;
+			}
+			else if (p < bestProbability)
+			{
+				best = cell;
+				bestProbability = p;
+			}
+		}
+		if (progress == MINE_BOOM)
+		{
+			break;
+		}
+	}
+	for (int c = 0; c < count; c++)
+	{
+		free(components[c].total);
+		free(components[c].hits);
+	}
+	free(components);
+	if (progress != 0)
+	{
+		return progress;
+	}
+	if (firstInterior >= 0 && (interiorProbability == 0 || interiorProbability < bestProbability || best < 0))
+	{
+		best = firstInterior;
+		bestProbability = interiorProbability;
+	}
+	if (best < 0)
+	{
+		return MINE_BOOM;
+	}
+	//没有确定的格子时猜测(内部格子概率为零时也是确定的)
+	solver->guesses += bestProbability > 0;
+	return RevealCell(solver, best) == MINE_BOOM ? MINE_BOOM : 1;
+}
+
+//求解一局(棋盘已布雷且尚未翻开任何格子，从中心开始翻开，返回是否获胜)
+bool SolveMineBoard(MineSolver* solver)
+{
+	assert(solver);
+	MineBoard* board = solver->board;
+	ClearConstraints(solver);
+	memset(solver->flag, 0, sizeof(unsigned long long) * ((solver->capacity + 63) / 64));
+	solver->flags = 0;
+	long long safe = (long long)board->row * board->col - board->bombs;
+	if (RevealMineBoard(board, (board->row + 1) / 2, (board->col + 1) / 2) == MINE_BOOM)
+	{
+		return false;
+	}
+	while (board->revealed < safe)
+	{
+		BuildConstraints(solver);
+		long long progress = SolveSingle(solver);
+		if (progress == 0)
+		{
+			progress = SolveSubset(solver);
+		}
+		if (progress == 0)
+		{
+			progress = SolveProbability(solver);
+		}
+		if (progress == MINE_BOOM)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//定义结构体类型(批量模式的线程参数)
+typedef struct SolveTask
+{
+	int row;
+	int col;
+	long long bombs;
+	int games;
+	atomic_int* next;
+	SolveStats stats;
+} SolveTask;
+
+//批量模式的线程：领取局号，按局号布雷并求解
+static int SolveThread(void* arg)
+{
+	SolveTask* task = (SolveTask*)arg;
+	MineBoard board;
+	MineSolver solver;
+	InitMineBoard(&board, task->row, task->col, task->bombs);
+	InitMineSolver(&solver, &board);
+	int game;
+	while ((game = atomic_fetch_add(task->next, 1)) < task->games)
+	{
+		SetMineBombs(&board, (unsigned long long)game + 1);
+		solver.guesses = 0;
+		task->stats.wins += SolveMineBoard(&solver);
+		task->stats.guesses += solver.guesses;
+		task->stats.games++;
+	}
+	FreeMineSolver(&solver);
+	FreeMineBoard(&board);
+	return 0;
+}
+
+//取得当前时间(单位：秒)
+static double GetWallSeconds()
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//批量模式("threads"个线程共求解"games"局"row"行"col"列、"bombs"个炸弹的随机棋盘，打印胜率与每秒求解局数)
+void BatchMineSolver(int row, int col, long long bombs, int games, int threads)
+{
+	assert(games >= 0);
+	threads = threads < 1 ? 1 : threads > SOLVER_MAX_THREADS ? SOLVER_MAX_THREADS : threads;
+	atomic_int next;
+	atomic_init(&next, 0);
+	SolveTask tasks[SOLVER_MAX_THREADS];
+	thrd_t handles[SOLVER_MAX_THREADS];
+	bool started[SOLVER_MAX_THREADS];
+	double begin = GetWallSeconds();
+	for (int i = 0; i < threads; i++)
+	{
+		SolveTask init = { row, col, bombs, games, &next, { 0, 0, 0 } };
+		tasks[i] = init;
+		started[i] = thrd_create(handles + i, SolveThread, tasks + i) == thrd_success;
+	}
+	//创建失败的线程由当前线程代为执行
+	for (int i = 0; i < threads; i++)
+	{
+		if (!started[i])
+		{
+			SolveThread(tasks + i);
+		}
+	}
+	SolveStats stats = { 0, 0, 0 };
+	for (int i = 0; i < threads; i++)
+	{
+		if (started[i])
+		{
+			thrd_join(handles[i], NULL);
+		}
+		stats.games += tasks[i].stats.games;
+		stats.wins += tasks[i].stats.wins;
+		stats.guesses += tasks[i].stats.guesses;
+	}
+	double elapsed = GetWallSeconds() - begin;
+	printf("Board：%d×%d，Bombs：%lld，Threads：%d\n", row, col, bombs, threads);
+	printf("Games：%lld，Wins：%lld，Win Rate：%.2lf%%，Guesses：%.3lf/game\n", stats.games, stats.wins, stats.games > 0 ? 100.0 * stats.wins / stats.games : 0, stats.games > 0 ? (double)stats.guesses / stats.games : 0);
+	printf("Time：%lfs，%.1lf games/s\n", elapsed, elapsed > 0 ? stats.games / elapsed : 0);
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+//引用头文件
+#include <math.h>
+#include <threads.h>
+#include <stdatomic.h>
+#include "MineBoard.h"
+
+/*
+ * 扫雷自动求解(只使用已翻开格子的数字，不读取炸弹位棋盘)
+ * 1. 每个周围还有未知格子的数字格子是一个约束：周围未知格子中恰有"need"个炸弹(数字减去已标记的炸弹数)。
+ * 2. 单格推理："need"为零时周围的未知格子都安全，"need"等于未知格子数时都是炸弹。
+ * 3. 子集推理：约束"A"的未知格子是约束"B"的子集时，差集中恰有"B.need - A.need"个炸弹，可能全部安全或全部是炸弹。
+ * 4. 概率推理：与约束相邻的未知格子(边界格子)按约束连通分成若干分量，每个分量回溯枚举全部解，按炸弹数统计解的个数；
+ *    再与不与约束相邻的格子(内部格子)的组合数"C(I, M - K)"加权合并，得到每个格子是炸弹的精确概率。
+ *    概率为零的格子全部翻开、为一的全部标记，否则翻开概率最小的格子(猜测)。
+ * 5. 单个分量的枚举超过"SOLVER_MAX_NODES"个结点时放弃精确计算，该分量的格子按局部比例估计概率，并视为内部格子参与加权。
+ * 6. 批量模式把"games"局随机棋盘分给多个线程，每个线程有自己的棋盘与求解器，以原子计数器领取局号(局号决定布雷的种子)。
+ */
+
+//定义标识符
+#define SOLVER_MAX_NODES 1000000 //单个分量枚举的结点数上限
+#define SOLVER_MAX_THREADS 64    //批量模式的线程数上限
+
+//定义结构体类型(约束)
+typedef struct MineConstraint
+{
+	int cell;     //数字格子
+	int need;     //周围未知格子中的炸弹数
+	int size;     //周围未知格子数
+	int cells[8]; //周围未知格子
+	int vars[8];  //周围未知格子对应的变量
+} MineConstraint;
+
+//定义结构体类型(求解器)
+typedef struct MineSolver
+{
+	MineBoard* board;
+	unsigned long long* flag; //已标记的炸弹位棋盘
+	long long flags;
+	int* constraintOf;        //格子对应的约束(不是约束时为"-1")
+	int* varOf;               //格子对应的变量(不是变量时为"-1")
+	MineConstraint* constraints;
+	int constraintCount;
+	int* vars;                //变量对应的格子
+	int varCount;
+	int* order;               //按分量排列的变量
+	int* component;           //变量所在的分量(尚未划分时为"-1")
+	int* assigned;            //枚举时变量的取值
+	int* mines;               //枚举时约束中已确定的炸弹数
+	int* left;                //枚举时约束中尚未确定的变量数
+	double* probability;      //变量是炸弹的概率
+	size_t capacity;          //以上按格子数分配的数组的容量
+	long long guesses;        //猜测次数
+} MineSolver;
+
+//定义结构体类型(批量模式的统计)
+typedef struct SolveStats
+{
+	long long games;
+	long long wins;
+	long long guesses;
+} SolveStats;
+
+//初始化求解器
+void InitMineSolver(MineSolver* solver, MineBoard* board);
+
+//释放求解器
+void FreeMineSolver(MineSolver* solver);
+
+//求解一局(棋盘已布雷且尚未翻开任何格子，从中心开始翻开，返回是否获胜)
+bool SolveMineBoard(MineSolver* solver);
+
+//批量模式("threads"个线程共求解"games"局"row"行"col"列、"bombs"个炸弹的随机棋盘，打印胜率与每秒求解局数)
+void BatchMineSolver(int row, int col, long long bombs, int games, int threads);
\ No newline at end of file
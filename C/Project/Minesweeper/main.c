@@ -1,7 +1,32 @@
 #include "Game.h"
 
-int main()
+/*
+ * 扫雷
+ * 1. 不带参数运行时进入菜单。
+ * 2. bench [row] [col] [bombs]：在"row"行"col"列(默认"10000"行"10000"列)、"bombs"个炸弹(默认为格子数的"1%")的棋盘上测试布雷与翻开的耗时。
+ * 3. solve [games] [threads] [row] [col] [bombs]：用"threads"个线程(默认"4"个)自动求解"games"局(默认"10000"局)随机棋盘(默认"16"行"30"列、"99"个炸弹)，打印胜率与每秒求解局数。
+ */
+
+int main(int argc, char* argv[])
 {
+	if (argc >= 2 && strcmp(argv[1], "bench") == 0)
+	{
+		int row = argc >= 3 ? atoi(argv[2]) : BENCH_ROW;
+		int col = argc >= 4 ? atoi(argv[3]) : BENCH_COL;
+		long long bombs = argc >= 5 ? atoll(argv[4]) : (long long)row * col * BENCH_BOMB / 100;
+		BenchMineBoard(row, col, bombs);
+		return 0;
+	}
+	if (argc >= 2 && strcmp(argv[1], "solve") == 0)
+	{
+		int games = argc >= 3 ? atoi(argv[2]) : SOLVE_GAMES;
+		int threads = argc >= 4 ? atoi(argv[3]) : SOLVE_THREADS;
+		int row = argc >= 5 ? atoi(argv[4]) : SOLVE_ROW;
+		int col = argc >= 6 ? atoi(argv[5]) : SOLVE_COL;
+		long long bombs = argc >= 7 ? atoll(argv[6]) : SOLVE_BOMB;
+		BatchMineSolver(row, col, bombs, games, threads);
+		return 0;
+	}
 	int input = 0;
 	do
 	{
@@ -0,0 +1,503 @@
+#include "Engine.h"
+
+//定义四个方向(横、竖、左上到右下、右上到左下)
+static const int directions[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+
+//分配数组(失败时退出)
+static void* AllocEngine(size_t size)
+{
+	void* ptr = calloc(size, 1);
+	if (ptr == NULL)
+	{
+		perror("AllocEngine");
+		exit(EXIT_FAILURE);
+	}
+	return ptr;
+}
+
+//"SplitMix64"伪随机数(生成"Zobrist"随机数)
+static unsigned long long NextZobrist(unsigned long long* state)
+{
+	unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+//初始化引擎("row"行"col"列，"win"子连珠)
+void InitEngine(Engine* engine, int row, int col, int win)
+{
+	assert(engine && row > 0 && col > 0 && win > 0 && win <= ENGINE_MAX_WIN);
+	engine->row = row;
+	engine->col = col;
+	engine->win = win;
+	engine->cells = row * col;
+	engine->words = (engine->cells + 63) / 64;
+	for (int p = 0; p < 2; p++)
+	{
+		engine->stones[p] = (unsigned long long*)AllocEngine(sizeof(unsigned long long) * (size_t)engine->words);
+		engine->windowStones[p] = (unsigned char*)AllocEngine((size_t)engine->cells * 4);
+	}
+	engine->history = (int*)AllocEngine(sizeof(int) * (size_t)engine->cells);
+	engine->near = (unsigned char*)AllocEngine((size_t)engine->cells);
+	engine->cellWindows = (int*)AllocEngine(sizeof(int) * (size_t)engine->cells * 4 * (size_t)win);
+	engine->cellWindowCount = (unsigned char*)AllocEngine((size_t)engine->cells);
+	engine->value = (int*)AllocEngine(sizeof(int) * (size_t)(win + 1));
+	engine->moveBuffer = (int*)AllocEngine(sizeof(int) * (size_t)engine->cells * (ENGINE_MAX_DEPTH + 1));
+	engine->orderBuffer = (int*)AllocEngine(sizeof(int) * (size_t)engine->cells);
+	engine->zobrist = (unsigned long long*)AllocEngine(sizeof(unsigned long long) * (size_t)(2 * engine->cells + 1));
+	engine->table = NULL;
+	engine->stop = NULL;
+	//固定的种子：同样大小的引擎生成相同的随机数
+	unsigned long long state = ENGINE_ZOBRIST_SEED;
+	for (int i = 0; i <= 2 * engine->cells; i++)
+	{
+		engine->zobrist[i] = NextZobrist(&state);
+	}
+	//枚举每条长为"win"的线段，记入它经过的每个格子
+	engine->windowCount = 0;
+	for (int d = 0; d < 4; d++)
+	{
+		for (int x = 0; x < row; x++)
+		{
+			for (int y = 0; y < col; y++)
+			{
+				int endX = x + directions[d][0] * (win - 1), endY = y + directions[d][1] * (win - 1);
+				if (endX >= row || endY < 0 || endY >= col)
+				{
+					continue;
+				}
+				for (int k = 0; k < win; k++)
+				{
+					int cell = (x + directions[d][0] * k) * col + y + directions[d][1] * k;
+					engine->cellWindows[cell * 4 * win + engine->cellWindowCount[cell]++] = engine->windowCount;
+				}
+				engine->windowCount++;
+			}
+		}
+	}
+	//窗口分数：每多一个棋子乘以八
+	for (int k = 1; k <= win; k++)
+	{
+		engine->value[k] = 1 << (3 * (k - 1));
+	}
+	ClearEngine(engine);
+}
+
+//释放引擎
+void FreeEngine(Engine* engine)
+{
+	assert(engine);
+	for (int p = 0; p < 2; p++)
+	{
+		free(engine->stones[p]);
+		free(engine->windowStones[p]);
+		engine->stones[p] = NULL;
+		engine->windowStones[p] = NULL;
+	}
+	free(engine->history);
+	free(engine->near);
+	free(engine->cellWindows);
+	free(engine->cellWindowCount);
+	free(engine->value);
+	free(engine->moveBuffer);
+	free(engine->orderBuffer);
+	free(engine->zobrist);
+	engine->zobrist = NULL;
+	engine->history = engine->cellWindows = engine->value = engine->moveBuffer = engine->orderBuffer = NULL;
+	engine->near = engine->cellWindowCount = NULL;
+}
+
+//清空棋盘
+void ClearEngine(Engine* engine)
+{
+	assert(engine);
+	for (int p = 0; p < 2; p++)
+	{
+		memset(engine->stones[p], 0, sizeof(unsigned long long) * (size_t)engine->words);
+		memset(engine->windowStones[p], 0, (size_t)engine->windowCount);
+	}
+	memset(engine->near, 0, (size_t)engine->cells);
+	engine->side = 0;
+	engine->moves = 0;
+	engine->winner = ENGINE_NONE;
+	engine->score = 0;
+	engine->nodes = 0;
+	engine->hash = 0;
+}
+
+//复制引擎("dst"未初始化，复制后轮到走棋的一方与局面相同，不复制置换表与停止标志)
+void CopyEngine(Engine* dst, const Engine* src)
+{
+	assert(dst && src && dst != src);
+	InitEngine(dst, src->row, src->col, src->win);
+	for (int i = 0; i < src->moves; i++)
+	{
+		int cell = src->history[i];
+		PutEngineStone(dst, cell, (int)((src->stones[0][cell >> 6] >> (cell & 63)) & 1) ? 0 : 1);
+	}
+	if (dst->side != src->side)
+	{
+		dst->side ^= 1;
+		dst->hash ^= dst->zobrist[2 * dst->cells];
+	}
+}
+
+//判断格子是否为空
+bool IsEngineEmpty(const Engine* engine, int cell)
+{
+	assert(engine && cell >= 0 && cell < engine->cells);
+	return !(((engine->stones[0][cell >> 6] | engine->stones[1][cell >> 6]) >> (cell & 63)) & 1);
+}
+
+//窗口对局面分的贡献(只有一方棋子时才计分)
+static inline int WindowScore(const Engine* engine, int window)
+{
+	int first = engine->windowStones[0][window], second = engine->windowStones[1][window];
+	return second == 0 ? engine->value[first] : first == 0 ? -engine->value[second] : 0;
+}
+
+//更新周围两格以内的棋子数
+static void UpdateNear(Engine* engine, int cell, int delta)
+{
+	int x = cell / engine->col, y = cell % engine->col;
+	for (int i = x - ENGINE_NEAR; i <= x + ENGINE_NEAR; i++)
+	{
+		for (int j = y - ENGINE_NEAR; j <= y + ENGINE_NEAR; j++)
+		{
+			if (i >= 0 && i < engine->row && j >= 0 && j < engine->col)
+			{
+				engine->near[i * engine->col + j] += delta;
+			}
+		}
+	}
+}
+
+//放置或移除"player"的棋子("delta"为"1"或"-1"，返回放置后是否连成"win"子)
+static bool UpdateStone(Engine* engine, int cell, int player, int delta)
+{
+	engine->stones[player][cell >> 6] ^= 1ULL << (cell & 63);
+	engine->hash ^= engine->zobrist[player * engine->cells + cell];
+	bool won = false;
+	const int* windows = engine->cellWindows + cell * 4 * engine->win;
+	for (int i = 0; i < engine->cellWindowCount[cell]; i++)
+	{
+		int window = windows[i];
+		engine->score -= WindowScore(engine, window);
+		engine->windowStones[player][window] += delta;
+		engine->score += WindowScore(engine, window);
+		won = won || engine->windowStones[player][window] == engine->win;
+	}
+	UpdateNear(engine, cell, delta);
+	return won && delta > 0;
+}
+
+//在"cell"放置"player"的棋子(用于摆出局面，不改变轮到走棋的一方，返回是否获胜)
+bool PutEngineStone(Engine* engine, int cell, int player)
+{
+	assert(engine && IsEngineEmpty(engine, cell) && (player == 0 || player == 1));
+	bool won = UpdateStone(engine, cell, player, 1);
+	engine->history[engine->moves++] = cell;
+	if (won)
+	{
+		engine->winner = player;
+	}
+	return won;
+}
+
+//轮到走棋的一方在"cell"落子(返回是否获胜)
+bool MakeEngineMove(Engine* engine, int cell)
+{
+	assert(engine && IsEngineEmpty(engine, cell) && engine->winner == ENGINE_NONE);
+	bool won = UpdateStone(engine, cell, engine->side, 1);
+	engine->history[engine->moves++] = cell;
+	if (won)
+	{
+		engine->winner = engine->side;
+	}
+	engine->side ^= 1;
+	engine->hash ^= engine->zobrist[2 * engine->cells];
+	return won;
+}
+
+//悔棋(撤销最后一步)
+void UnmakeEngineMove(Engine* engine)
+{
+	assert(engine && engine->moves > 0);
+	int cell = engine->history[--engine->moves];
+	engine->side ^= 1;
+	engine->hash ^= engine->zobrist[2 * engine->cells];
+	UpdateStone(engine, cell, engine->side, -1);
+	engine->winner = ENGINE_NONE;
+}
+
+//判断空棋盘上的格子是否为对称等价的格子中的代表(只取左上角的部分，正方形棋盘再只取对角线上方，结果与全部格子相同)
+static bool IsCanonicalCell(const Engine* engine, int cell)
+{
+	int x = cell / engine->col, y = cell % engine->col;
+	if (x > engine->row - 1 - x || y > engine->col - 1 - y)
+	{
+		return false;
+	}
+	return engine->row != engine->col || x <= y;
+}
+
+//生成候选着法并按"进攻 + 防守"的窗口得分降序排列(返回着法个数)
+static int GenerateMoves(Engine* engine, int* moves)
+{
+	int count = 0;
+	int* orders = engine->orderBuffer;
+	const unsigned char* mine = engine->windowStones[engine->side];
+	const unsigned char* other = engine->windowStones[engine->side ^ 1];
+	//第一遍只取周围两格以内有棋子的空格，没有这样的空格时第二遍取全部空格
+	for (int pass = 0; pass < 2 && count == 0; pass++)
+	{
+		for (int cell = 0; cell < engine->cells; cell++)
+		{
+			if ((pass == 0 && engine->near[cell] == 0) || !IsEngineEmpty(engine, cell) || (engine->moves == 0 && !IsCanonicalCell(engine, cell)))
+			{
+				continue;
+			}
+			//进攻：己方窗口多一个棋子的得分(加倍，使连成"win"子优先于堵住对方)；防守：对方窗口被破坏前的得分
+			int order = 0;
+			const int* windows = engine->cellWindows + cell * 4 * engine->win;
+			for (int i = 0; i < engine->cellWindowCount[cell]; i++)
+			{
+				int window = windows[i];
+				if (other[window] == 0)
+				{
+					order += 2 * engine->value[mine[window] + 1];
+				}
+				if (mine[window] == 0)
+				{
+					order += engine->value[other[window] + 1];
+				}
+			}
+			int j = count++;
+			while (j > 0 && orders[j - 1] < order)
+			{
+				moves[j] = moves[j - 1];
+				orders[j] = orders[j - 1];
+				j--;
+			}
+			moves[j] = cell;
+			orders[j] = order;
+		}
+	}
+	return count;
+}
+
+//把置换表中的最佳着法移到最前面(其余着法顺序不变)
+static void PromoteMove(int* moves, int count, int move)
+{
+	for (int i = 0; i < count && move != ENGINE_NONE; i++)
+	{
+		if (moves[i] == move)
+		{
+			memmove(moves + 1, moves, sizeof(int) * (size_t)i);
+			moves[0] = move;
+			break;
+		}
+	}
+}
+
+//是否要求停止搜索
+static inline bool IsEngineStopped(const Engine* engine)
+{
+	return engine->stop != NULL && atomic_load_explicit(engine->stop, memory_order_relaxed);
+}
+
+//获胜分数换算为从当前局面起的步数(存入置换表)
+static inline int ScoreToTable(int score, int ply)
+{
+	return score >= ENGINE_WIN_BOUND ? score + ply : score <= -ENGINE_WIN_BOUND ? score - ply : score;
+}
+
+//获胜分数换算为从根结点起的步数(取出置换表)
+static inline int ScoreFromTable(int score, int ply)
+{
+	return score >= ENGINE_WIN_BOUND ? score - ply : score <= -ENGINE_WIN_BOUND ? score + ply : score;
+}
+
+//负极大值搜索("alpha-beta"剪枝与置换表，分数从轮到走棋的一方来看)
+static int Negamax(Engine* engine, int depth, int alpha, int beta, int ply)
+{
+	engine->nodes++;
+	if (engine->winner != ENGINE_NONE)
+	{
+		//上一步的一方已经获胜
+		return -(ENGINE_WIN_SCORE - ply);
+	}
+	if (engine->moves == engine->cells)
+	{
+		return 0;
+	}
+	if (depth == 0)
+	{
+		return engine->side == 0 ? engine->score : -engine->score;
+	}
+	//查表：深度足够且分数界限可以剪枝时直接返回，否则只取最佳着法
+	int hashMove = ENGINE_NONE;
+	TableEntry entry;
+	if (engine->table != NULL && ProbeTable(engine->table, engine->hash, &entry))
+	{
+		hashMove = entry.move;
+		int score = ScoreFromTable(entry.score, ply);
+		if (entry.depth >= depth && (entry.type == TABLE_EXACT || (entry.type == TABLE_LOWER && score >= beta) || (entry.type == TABLE_UPPER && score <= alpha)))
+		{
+			return score;
+		}
+	}
+	int* moves = engine->moveBuffer + ply * engine->cells;
+	int count = GenerateMoves(engine, moves);
+	PromoteMove(moves, count, hashMove);
+	int origin = alpha;
+	int best = -ENGINE_WIN_SCORE, bestMove = ENGINE_NONE;
+	for (int i = 0; i < count; i++)
+	{
+		MakeEngineMove(engine, moves[i]);
+		int score = -Negamax(engine, depth - 1, -beta, -alpha, ply + 1);
+		UnmakeEngineMove(engine);
+		if (IsEngineStopped(engine))
+		{
+			//被停止的搜索结果不完整，不能存入置换表
+			return 0;
+		}
+		if (score > best)
+		{
+			best = score;
+			bestMove = moves[i];
+		}
+		if (best > alpha)
+		{
+			alpha = best;
+		}
+		if (alpha >= beta)
+		{
+			break;
+		}
+	}
+	if (engine->table != NULL)
+	{
+		TableEntry store = { ScoreToTable(best, ply), depth, best <= origin ? TABLE_UPPER : best >= beta ? TABLE_LOWER : TABLE_EXACT, bestMove };
+		StoreTable(engine->table, engine->hash, &store);
+	}
+	return best;
+}
+
+//搜索"depth"层(不超过"ENGINE_MAX_DEPTH"，返回分数，"move"返回最佳着法，没有着法时为"ENGINE_NONE")
+int SearchEngine(Engine* engine, int depth, int* move)
+{
+	assert(engine && move && depth > 0 && depth <= ENGINE_MAX_DEPTH);
+	*move = ENGINE_NONE;
+	if (engine->winner != ENGINE_NONE || engine->moves == engine->cells)
+	{
+		return Negamax(engine, depth, -ENGINE_WIN_SCORE, ENGINE_WIN_SCORE, 0);
+	}
+	engine->nodes++;
+	int* moves = engine->moveBuffer;
+	int count = GenerateMoves(engine, moves);
+	TableEntry entry;
+	if (engine->table != NULL && ProbeTable(engine->table, engine->hash, &entry))
+	{
+		PromoteMove(moves, count, entry.move);
+	}
+	int alpha = -ENGINE_WIN_SCORE;
+	for (int i = 0; i < count; i++)
+	{
+		MakeEngineMove(engine, moves[i]);
+		int score = -Negamax(engine, depth - 1, -ENGINE_WIN_SCORE, -alpha, 1);
+		UnmakeEngineMove(engine);
+		if (IsEngineStopped(engine))
+		{
+			return alpha;
+		}
+		if (score > alpha || *move == ENGINE_NONE)
+		{
+			alpha = score > alpha ? score : alpha;
+			*move = moves[i];
+		}
+	}
+	if (engine->table != NULL)
+	{
+		TableEntry store = { alpha, depth, TABLE_EXACT, *move };
+		StoreTable(engine->table, engine->hash, &store);
+	}
+	return alpha;
+}
+
+//迭代加深搜索到"depth"层(返回分数，"move"返回最佳着法)
+int DeepenEngine(Engine* engine, int depth, int* move)
+{
+	assert(engine && move && depth > 0 && depth <= ENGINE_MAX_DEPTH);
+	*move = ENGINE_NONE;
+	int score = 0;
+	for (int d = 1; d <= depth; d++)
+	{
+		int current;
+		int result = SearchEngine(engine, d, &current);
+		if (IsEngineStopped(engine))
+		{
+			//只保留完整搜索完的一层的结果
+			break;
+		}
+		score = result;
+		*move = current;
+		//分出胜负或没有着法时更深的搜索不会改变结果
+		if (current == ENGINE_NONE || score >= ENGINE_WIN_BOUND || score <= -ENGINE_WIN_BOUND)
+		{
+			break;
+		}
+	}
+	return score;
+}
+
+//定义结构体类型(并行搜索的辅助线程参数)
+typedef struct EngineWorker
+{
+	Engine engine;
+	int depth;
+	int move;
+	int score;
+} EngineWorker;
+
+//并行搜索的辅助线程：在自己的引擎副本上迭代加深
+static int EngineThread(void* arg)
+{
+	EngineWorker* worker = (EngineWorker*)arg;
+	worker->score = DeepenEngine(&worker->engine, worker->depth, &worker->move);
+	return 0;
+}
+
+//用"threads"个线程并行搜索到"depth"层("engine"必须设置了置换表，"nodes"为全部线程的结点数之和)
+int ParallelEngine(Engine* engine, int depth, int threads, int* move)
+{
+	assert(engine && engine->table && move && depth > 0 && depth <= ENGINE_MAX_DEPTH);
+	threads = threads < 1 ? 1 : threads > ENGINE_MAX_THREADS ? ENGINE_MAX_THREADS : threads;
+	atomic_bool stop;
+	atomic_init(&stop, false);
+	EngineWorker workers[ENGINE_MAX_THREADS];
+	thrd_t handles[ENGINE_MAX_THREADS];
+	bool started[ENGINE_MAX_THREADS];
+	for (int i = 1; i < threads; i++)
+	{
+		CopyEngine(&workers[i].engine, engine);
+		workers[i].engine.table = engine->table;
+		workers[i].engine.stop = &stop;
+		workers[i].depth = depth + (i & 1) <= ENGINE_MAX_DEPTH ? depth + (i & 1) : ENGINE_MAX_DEPTH;
+		//辅助线程只是加速，创建失败时直接跳过
+		started[i] = thrd_create(handles + i, EngineThread, workers + i) == thrd_success;
+	}
+	int score = DeepenEngine(engine, depth, move);
+	atomic_store_explicit(&stop, true, memory_order_relaxed);
+	for (int i = 1; i < threads; i++)
+	{
+		if (started[i])
+		{
+			thrd_join(handles[i], NULL);
+		}
+		engine->nodes += workers[i].engine.nodes;
+		FreeEngine(&workers[i].engine);
+	}
+	return score;
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+//引用头文件
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <threads.h>
+#include <stdatomic.h>
+#include "Table.h"
+
+/*
+ * 运行时大小的"N×N"、"K"子连珠引擎
+ * 1. 格子按行优先编号为"x * col + y"，双方的棋子各用一个位棋盘保存(每个格子一位)。
+ * 2. 棋盘上每条长为"K"的线段(横、竖、两条斜线)是一个窗口，记录双方在窗口中的棋子数；每个格子预先记下经过它的窗口。
+ *    落子与悔棋时只更新经过该格子的窗口(最多"4K"个)：某方在一个窗口中的棋子数达到"K"即获胜(增量胜负判断)，
+ *    只有一方棋子的窗口按棋子数计分，局面分随之增量更新，叶子结点无需扫描棋盘。
+ * 3. 只在已有棋子周围两格以内的空格中落子(周围棋子数增量维护)；候选着法按"进攻 + 防守"的窗口得分降序排列，先搜索最有希望的着法。
+ *    空棋盘上没有已有棋子，生成全部空格中对称等价的代表(左上角的部分，正方形棋盘再只取对角线上方)，根结点的结果与搜索全部空格相同。
+ * 4. 搜索为带"alpha-beta"剪枝的负极大值搜索，分数总是从轮到走棋的一方来看；获胜分数减去步数，越快获胜越好。
+ * 5. 局面的"Zobrist"键为双方每个棋子的随机数与轮到走棋一方的随机数的异或，落子与悔棋时增量更新；随机数由固定的种子生成，同样大小的引擎键相同，可以共享置换表。
+ *    设置了置换表时，搜索先查表剪枝，并把表中的最佳着法放在最前面；获胜分数在表中保存为到该局面的步数，取出时再换算回到根结点的步数。
+ * 6. 迭代加深从一层起逐层搜索到"depth"层，浅层搜索存入置换表的最佳着法使深层搜索的排序更好；找到必胜或必败时提前结束。
+ * 7. 并行搜索为"Lazy SMP"：每个线程各有一份引擎副本，共享同一个置换表，各自迭代加深；奇数号辅助线程多搜一层，使各线程错开。
+ *    主线程搜索完成后设置停止标志，辅助线程的结果只通过置换表起作用。
+ */
+
+//定义标识符
+#define ENGINE_WIN_SCORE 1000000000 //获胜的分数
+#define ENGINE_NEAR 2               //候选着法与已有棋子的最大距离
+#define ENGINE_MAX_WIN 8            //获胜连棋数的上限(窗口分数不超过"int"的范围)
+#define ENGINE_MAX_DEPTH 64         //搜索深度的上限
+#define ENGINE_WIN_BOUND (ENGINE_WIN_SCORE / 2) //绝对值不小于它的分数为分出胜负
+#define ENGINE_ZOBRIST_SEED 20240105ULL         //"Zobrist"随机数的种子
+#define ENGINE_MAX_THREADS 64       //并行搜索的线程数上限
+#define ENGINE_NONE (-1)
+
+//定义结构体类型(连珠引擎)
+typedef struct Engine
+{
+	int row;
+	int col;
+	int win;                        //获胜连棋数
+	int cells;
+	int words;                      //位棋盘的字数
+	unsigned long long* stones[2];  //双方的位棋盘
+	int side;                       //轮到走棋的一方("0"或"1")
+	int moves;                      //已落子数
+	int winner;                     //获胜的一方(尚未分出胜负时为"ENGINE_NONE")
+	int* history;                   //落子顺序
+	unsigned char* near;            //周围两格以内的棋子数
+	int windowCount;
+	unsigned char* windowStones[2]; //窗口中双方的棋子数
+	int* cellWindows;               //经过每个格子的窗口("cellWindows[cell * 4 * win + i]")
+	unsigned char* cellWindowCount; //经过每个格子的窗口数
+	int* value;                     //"value[k]"为只有一方"k"个棋子的窗口的分数
+	int score;                      //局面分(从"0"方来看)
+	long long nodes;                //搜索的结点数
+	int* moveBuffer;                //每一层的候选着法("moveBuffer[ply * cells + i]")
+	int* orderBuffer;               //候选着法的排序分数
+	unsigned long long* zobrist;    //"zobrist[player * cells + cell]"为棋子的随机数，"zobrist[2 * cells]"为轮到"1"方走棋的随机数
+	unsigned long long hash;        //局面的"Zobrist"键
+	Table* table;                   //置换表(为"NULL"时不使用)
+	atomic_bool* stop;              //停止标志(为"NULL"时不检查)
+} Engine;
+
+//初始化引擎("row"行"col"列，"win"子连珠)
+void InitEngine(Engine* engine, int row, int col, int win);
+
+//复制引擎("dst"未初始化，复制后轮到走棋的一方与局面相同，不复制置换表与停止标志)
+void CopyEngine(Engine* dst, const Engine* src);
+
+//释放引擎
+void FreeEngine(Engine* engine);
+
+//清空棋盘
+void ClearEngine(Engine* engine);
+
+//判断格子是否为空
+bool IsEngineEmpty(const Engine* engine, int cell);
+
+//在"cell"放置"player"的棋子(用于摆出局面，不改变轮到走棋的一方，返回是否获胜)
+bool PutEngineStone(Engine* engine, int cell, int player);
+
+//轮到走棋的一方在"cell"落子(返回是否获胜)
+bool MakeEngineMove(Engine* engine, int cell);
+
+//悔棋(撤销最后一步)
+void UnmakeEngineMove(Engine* engine);
+
+//搜索"depth"层(不超过"ENGINE_MAX_DEPTH"，返回分数，"move"返回最佳着法，没有着法时为"ENGINE_NONE")
+int SearchEngine(Engine* engine, int depth, int* move);
+
+//迭代加深搜索到"depth"层(返回分数，"move"返回最佳着法)
+int DeepenEngine(Engine* engine, int depth, int* move);
+
+//用"threads"个线程并行搜索到"depth"层("engine"必须设置了置换表，"nodes"为全部线程的结点数之和)
+int ParallelEngine(Engine* engine, int depth, int threads, int* move);
\ No newline at end of file
@@ -97,20 +97,34 @@ char PlayerMove(char board[ROW][COL], int row, int col)
 	}
 }
 
-//电脑移动
+//电脑移动(用引擎与置换表迭代加深搜索到"DEPTH"层，"ROW×COL"不超过"DEPTH"个格子时即为完美下法)
 char ComputerMove(char board[ROW][COL], int row, int col)
 {
 	printf("\nComputer move\n");
-	while (1)
+	Engine engine;
+	InitEngine(&engine, row, col, WIN);
+	for (int i = 0; i < row; ++i)
 	{
-		int x = rand() % row, y = rand() % col;
-		if (board[x][y] == ' ')
+		for (int j = 0; j < col; ++j)
 		{
-			board[x][y] = 'X';
-			char ret = JudgmentWinner(board, x, y);
-			return ret;
+			if (board[i][j] != ' ')
+			{
+				PutEngineStone(&engine, i * col + j, board[i][j] == 'X' ? 0 : 1);
+			}
 		}
 	}
+	engine.side = 0;
+	Table table;
+	InitTable(&table, TABLE_BITS);
+	engine.table = &table;
+	int move;
+	DeepenEngine(&engine, DEPTH, &move);
+	FreeTable(&table);
+	FreeEngine(&engine);
+	int x = move / col, y = move % col;
+	board[x][y] = 'X';
+	char ret = JudgmentWinner(board, x, y);
+	return ret;
 }
 
 //判断平局(仅由"JudgmentWinner"函数调用)
@@ -263,7 +277,6 @@ char JudgmentWinner(char board[ROW][COL], int x, int y)
 void Game()
 {
 	system("cls");
-	srand((unsigned int)time(NULL));
 	char ret;
 	char board[ROW][COL];
 	InitBoard(board, ROW, COL);
@@ -303,4 +316,165 @@ void Game()
 		printf("\nTie!\n\n");
 		system("pause");
 	}
+}
+
+//取得当前时间(单位：秒)
+static double GetSeconds()
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//摆出大棋盘的开局(中央双方各两子)
+static void OpenBench(Engine* engine)
+{
+	int center = BENCH_SIZE / 2;
+	MakeEngineMove(engine, center * BENCH_SIZE + center);
+	MakeEngineMove(engine, center * BENCH_SIZE + center + 1);
+	MakeEngineMove(engine, (center + 1) * BENCH_SIZE + center + 1);
+	MakeEngineMove(engine, (center - 1) * BENCH_SIZE + center - 1);
+}
+
+//基准测试(先与"JudgmentWinner"对照胜负判断，再在"BENCH_SIZE×BENCH_SIZE"、"BENCH_WIN"子连珠的棋盘上测试搜索到每个深度的结点数与耗时)
+void BenchEngine(int depth)
+{
+	//随机对局：每一步引擎的增量胜负判断必须与"JudgmentWinner"相同
+	bool succeed = true;
+	Engine engine;
+	InitEngine(&engine, ROW, COL, WIN);
+	char board[ROW][COL];
+	srand(20240105);
+	for (int game = 0; game < BENCH_GAMES && succeed; game++)
+	{
+		ClearEngine(&engine);
+		InitBoard(board, ROW, COL);
+		char ret = '~';
+		while (ret == '~' && succeed)
+		{
+			int cell;
+			do
+			{
+				cell = rand() % (ROW * COL);
+			} while (!IsEngineEmpty(&engine, cell));
+			board[cell / COL][cell % COL] = engine.side == 0 ? 'X' : 'O';
+			bool won = MakeEngineMove(&engine, cell);
+			ret = JudgmentWinner(board, cell / COL, cell % COL);
+			succeed = won == (ret == 'X' || ret == 'O');
+		}
+	}
+	//空棋盘完美下法的结果为平局(根结点只搜索对称等价的代表)，再逐个走出全部第一步分别搜索到底，最好的结果必须相同
+	ClearEngine(&engine);
+	int move;
+	int score = SearchEngine(&engine, ROW * COL, &move);
+	long long nodes = engine.nodes;
+	int full = -ENGINE_WIN_SCORE;
+	for (int cell = 0; cell < ROW * COL; cell++)
+	{
+		int reply;
+		ClearEngine(&engine);
+		MakeEngineMove(&engine, cell);
+		int value = -SearchEngine(&engine, ROW * COL - 1, &reply);
+		full = value > full ? value : full;
+	}
+	succeed = succeed && score == 0 && full == 0;
+	printf("Check：%d random games，%d×%d perfect play：%d(%lld nodes)，best of all %d first moves：%d\n", BENCH_GAMES, ROW, COL, score, nodes, ROW * COL, full);
+	FreeEngine(&engine);
+
+	//大棋盘：中央摆出双方各两子的开局，依次搜索到"depth"层
+	InitEngine(&engine, BENCH_SIZE, BENCH_SIZE, BENCH_WIN);
+	OpenBench(&engine);
+	printf("Board：%d×%d，Win：%d，Moves：%d\n", BENCH_SIZE, BENCH_SIZE, BENCH_WIN, engine.moves);
+	printf("%-8s%-14s%-12s%-14s%s\n", "Depth", "Nodes", "Time(s)", "Nodes/s", "Best(Score)");
+	for (int d = 1; d <= depth && d <= ENGINE_MAX_DEPTH; d++)
+	{
+		engine.nodes = 0;
+		double begin = GetSeconds();
+		score = SearchEngine(&engine, d, &move);
+		double elapsed = GetSeconds() - begin;
+		printf("%-8d%-14lld%-12.4lf%-14.0lf(%d,%d)(%d)\n", d, engine.nodes, elapsed, elapsed > 0 ? engine.nodes / elapsed : 0, move / BENCH_SIZE + 1, move % BENCH_SIZE + 1, score);
+		succeed = succeed && move != ENGINE_NONE;
+	}
+	FreeEngine(&engine);
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
+}
+
+//并行基准测试(先对照有无置换表、并行与否的完美下法分数，再在"BENCH_SIZE×BENCH_SIZE"的棋盘上比较置换表与迭代加深的效果，并测试"1"到"threads"个线程的每秒结点数)
+void BenchParallel(int depth, int threads)
+{
+	depth = depth < 1 ? 1 : depth > ENGINE_MAX_DEPTH ? ENGINE_MAX_DEPTH : depth;
+	threads = threads < 1 ? 1 : threads > ENGINE_MAX_THREADS ? ENGINE_MAX_THREADS : threads;
+	bool succeed = true;
+	Table table;
+	InitTable(&table, BENCH_TABLE_BITS);
+	//小棋盘：双方各走一步之后搜索到底的分数(含获胜步数)，有无置换表、单线程与多线程都必须相同
+	Engine engine;
+	InitEngine(&engine, ROW, COL, WIN);
+	long long plain = 0, hashed = 0;
+	for (int cell = 0; cell < ROW * COL * ROW * COL && succeed; cell++)
+	{
+		if (cell / (ROW * COL) == cell % (ROW * COL))
+		{
+			continue;
+		}
+		int move;
+		ClearEngine(&engine);
+		MakeEngineMove(&engine, cell / (ROW * COL));
+		MakeEngineMove(&engine, cell % (ROW * COL));
+		engine.table = NULL;
+		int expect = SearchEngine(&engine, ROW * COL, &move);
+		plain += engine.nodes;
+		engine.nodes = 0;
+		ClearTable(&table);
+		engine.table = &table;
+		int score = DeepenEngine(&engine, ROW * COL, &move);
+		hashed += engine.nodes;
+		ClearTable(&table);
+		int parallel = ParallelEngine(&engine, ROW * COL, threads, &move);
+		succeed = score == expect && parallel == expect;
+	}
+	ClearEngine(&engine);
+	ClearTable(&table);
+	int move;
+	int score = ParallelEngine(&engine, ROW * COL, threads, &move);
+	succeed = succeed && score == 0;
+	printf("Check：%d×%d perfect play：%d，nodes without table：%lld，with table：%lld\n", ROW, COL, score, plain, hashed);
+	FreeEngine(&engine);
+
+	//大棋盘：同一个开局分别不用置换表、用置换表迭代加深搜索到"depth"层
+	InitEngine(&engine, BENCH_SIZE, BENCH_SIZE, BENCH_WIN);
+	OpenBench(&engine);
+	printf("Board：%d×%d，Win：%d，Moves：%d，Depth：%d\n", BENCH_SIZE, BENCH_SIZE, BENCH_WIN, engine.moves, depth);
+	printf("%-20s%-14s%-12s%-14s%s\n", "Search", "Nodes", "Time(s)", "Nodes/s", "Best(Score)");
+	double begin = GetSeconds();
+	score = SearchEngine(&engine, depth, &move);
+	double elapsed = GetSeconds() - begin;
+	printf("%-20s%-14lld%-12.4lf%-14.0lf(%d,%d)(%d)\n", "Alpha-Beta", engine.nodes, elapsed, elapsed > 0 ? engine.nodes / elapsed : 0, move / BENCH_SIZE + 1, move % BENCH_SIZE + 1, score);
+	engine.nodes = 0;
+	ClearTable(&table);
+	engine.table = &table;
+	begin = GetSeconds();
+	score = DeepenEngine(&engine, depth, &move);
+	elapsed = GetSeconds() - begin;
+	printf("%-20s%-14lld%-12.4lf%-14.0lf(%d,%d)(%d)\n", "Table + Deepening", engine.nodes, elapsed, elapsed > 0 ? engine.nodes / elapsed : 0, move / BENCH_SIZE + 1, move % BENCH_SIZE + 1, score);
+	succeed = succeed && move != ENGINE_NONE;
+
+	//并行：线程数依次翻倍，每次清空置换表，"Lazy SMP"的结点数包含全部线程
+	printf("%-20s%-14s%-12s%-14s%-10s%s\n", "Threads", "Nodes", "Time(s)", "Nodes/s", "Scaling", "Best(Score)");
+	double base = 0;
+	for (int t = 1; t <= threads; t *= 2)
+	{
+		engine.nodes = 0;
+		ClearTable(&table);
+		begin = GetSeconds();
+		score = ParallelEngine(&engine, depth, t, &move);
+		elapsed = GetSeconds() - begin;
+		double rate = elapsed > 0 ? engine.nodes / elapsed : 0;
+		base = t == 1 ? rate : base;
+		printf("%-20d%-14lld%-12.4lf%-14.0lf%-10.2lf(%d,%d)(%d)\n", t, engine.nodes, elapsed, rate, base > 0 ? rate / base : 0, move / BENCH_SIZE + 1, move % BENCH_SIZE + 1, score);
+		succeed = succeed && move != ENGINE_NONE;
+	}
+	FreeEngine(&engine);
+	FreeTable(&table);
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
 }
\ No newline at end of file
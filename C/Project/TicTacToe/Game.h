@@ -4,12 +4,25 @@
 #include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include "Engine.h"
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#define scanf_s scanf
+#endif
 
 //定义标识符
 #define ROW 3 //行数(ROW)
 #define COL 3 //列数(COL)
 #define WIN 3 //获胜连棋数(WIN)
+#define DEPTH 9 //电脑的搜索深度(DEPTH)
+#define BENCH_SIZE 15     //基准测试的棋盘边长(BENCH_SIZE)
+#define BENCH_WIN 5       //基准测试的获胜连棋数(BENCH_WIN)
+#define BENCH_DEPTH 6     //基准测试的默认最大深度(BENCH_DEPTH)
+#define BENCH_GAMES 10000 //与"JudgmentWinner"对照的随机对局数(BENCH_GAMES)
+#define TABLE_BITS 12       //电脑搜索的置换表大小("2^TABLE_BITS"项)
+#define BENCH_TABLE_BITS 20 //基准测试的置换表大小("2^BENCH_TABLE_BITS"项)
+#define BENCH_THREADS 4     //并行基准测试的默认最大线程数(BENCH_THREADS)
 
 //菜单
 void Menu();
@@ -30,4 +43,10 @@ char PlayerMove(char board[ROW][COL], int row, int col);
 char ComputerMove(char board[ROW][COL], int row, int col);
 
 //判断输赢
-char JudgmentWinner(char board[ROW][COL], int x, int y);
\ No newline at end of file
+char JudgmentWinner(char board[ROW][COL], int x, int y);
+
+//基准测试(先与"JudgmentWinner"对照胜负判断，再在"BENCH_SIZE×BENCH_SIZE"、"BENCH_WIN"子连珠的棋盘上测试搜索到每个深度的结点数与耗时)
+void BenchEngine(int depth);
+
+//并行基准测试(先对照有无置换表、并行与否的完美下法分数，再在"BENCH_SIZE×BENCH_SIZE"的棋盘上比较置换表与迭代加深的效果，并测试"1"到"threads"个线程的每秒结点数)
+void BenchParallel(int depth, int threads);
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "Table.h"
+
+//打包项(分数32位、深度8位、类型2位、着法+1占20位)
+static unsigned long long PackEntry(const TableEntry* entry)
+{
+	return (unsigned long long)(unsigned int)entry->score
+		| (unsigned long long)(entry->depth & 0xFF) << 32
+		| (unsigned long long)(entry->type & 0x3) << 40
+		| (unsigned long long)((entry->move + 1) & 0xFFFFF) << 42;
+}
+
+//解包项
+static void UnpackEntry(unsigned long long data, TableEntry* entry)
+{
+	entry->score = (int)(unsigned int)(data & 0xFFFFFFFFULL);
+	entry->depth = (int)(data >> 32 & 0xFF);
+	entry->type = (int)(data >> 40 & 0x3);
+	entry->move = (int)(data >> 42 & 0xFFFFF) - 1;
+}
+
+//初始化置换表("2^bits"个项)
+void InitTable(Table* table, int bits)
+{
+	assert(table && bits >= 1 && bits < 40);
+	size_t size = (size_t)1 << bits;
+	table->check = (atomic_ullong*)malloc(sizeof(atomic_ullong) * size);
+	table->data = (atomic_ullong*)malloc(sizeof(atomic_ullong) * size);
+	if (table->check == NULL || table->data == NULL)
+	{
+		perror("InitTable");
+		exit(EXIT_FAILURE);
+	}
+	table->mask = size - 1;
+	for (size_t i = 0; i < size; i++)
+	{
+		atomic_init(table->check + i, 0);
+		atomic_init(table->data + i, 0);
+	}
+}
+
+//释放置换表
+void FreeTable(Table* table)
+{
+	assert(table);
+	free(table->check);
+	free(table->data);
+	table->check = table->data = NULL;
+	table->mask = 0;
+}
+
+//清空置换表
+void ClearTable(Table* table)
+{
+	assert(table);
+	for (size_t i = 0; i <= table->mask; i++)
+	{
+		atomic_store_explicit(table->check + i, 0, memory_order_relaxed);
+		atomic_store_explicit(table->data + i, 0, memory_order_relaxed);
+	}
+}
+
+//读取第"index"项(校验失败时返回"false")
+static bool ReadSlot(const Table* table, size_t index, unsigned long long key, unsigned long long* data)
+{
+	unsigned long long check = atomic_load_explicit(table->check + index, memory_order_relaxed);
+	*data = atomic_load_explicit(table->data + index, memory_order_relaxed);
+	return (check ^ *data) == key && *data != 0;
+}
+
+//查找局面"key"(命中时返回"true"并写入"entry")
+bool ProbeTable(const Table* table, unsigned long long key, TableEntry* entry)
+{
+	assert(table && entry);
+	size_t index = (size_t)key & table->mask & ~(size_t)1;
+	unsigned long long data;
+	if (ReadSlot(table, index, key, &data) || ReadSlot(table, index + 1, key, &data))
+	{
+		UnpackEntry(data, entry);
+		return true;
+	}
+	return false;
+}
+
+//保存局面"key"
+void StoreTable(Table* table, unsigned long long key, const TableEntry* entry)
+{
+	assert(table && entry);
+	size_t index = (size_t)key & table->mask & ~(size_t)1;
+	//第一项：同一局面或深度不小于原有的项时替换，否则写入第二项
+	unsigned long long old;
+	bool same = ReadSlot(table, index, key, &old);
+	TableEntry current;
+	UnpackEntry(old, &current);
+	if (!same && old != 0 && entry->depth < current.depth)
+	{
+		index++;
+	}
+	unsigned long long data = PackEntry(entry);
+	atomic_store_explicit(table->data + index, data, memory_order_relaxed);
+	atomic_store_explicit(table->check + index, key ^ data, memory_order_relaxed);
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+//引用头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/*
+ * 无锁置换表
+ * 1. 表的大小固定为"2^bits"个项，两个相邻的项为一组：第一项按深度优先替换，第二项总是替换。
+ * 2. 每项由两个64位原子变量组成："check"保存"key ^ data"，"data"保存分数、深度、类型与最佳着法。
+ *    读写均不加锁，两个变量可能被不同线程交错写入；读取时只有"check ^ data == key"才算命中，因此交错写入的项会被当作未命中，而不会读到错误的数据。
+ * 3. 所有读写均为"relaxed"原子操作，置换表只是搜索的缓存，读到旧数据不影响正确性。
+ */
+
+//定义标识符
+#define TABLE_EXACT 0 //精确值
+#define TABLE_LOWER 1 //下界(发生了"beta"剪枝)
+#define TABLE_UPPER 2 //上界(没有着法超过"alpha")
+
+//定义结构体类型(置换表的项)
+typedef struct TableEntry
+{
+	int score;
+	int depth;
+	int type;
+	int move; //最佳着法(没有时为"-1")
+} TableEntry;
+
+//定义结构体类型(置换表)
+typedef struct Table
+{
+	atomic_ullong* check;
+	atomic_ullong* data;
+	size_t mask;
+} Table;
+
+//初始化置换表("2^bits"个项)
+void InitTable(Table* table, int bits);
+
+//释放置换表
+void FreeTable(Table* table);
+
+//清空置换表
+void ClearTable(Table* table);
+
+//查找局面"key"(命中时返回"true"并写入"entry")
+bool ProbeTable(const Table* table, unsigned long long key, TableEntry* entry);
+
+//保存局面"key"
+void StoreTable(Table* table, unsigned long long key, const TableEntry* entry);
\ No newline at end of file
@@ -1,7 +1,24 @@
 #include "Game.h"
 
-int main()
+/*
+ * 井字棋
+ * 1. 不带参数运行时进入菜单。
+ * 2. bench [depth]：对照胜负判断，并在"15×15"、五子连珠的棋盘上测试搜索到每个深度(默认"6"层)的结点数与耗时。
+ * 3. parallel [depth] [threads]：对照置换表与并行搜索的分数，并在"15×15"的棋盘上比较置换表、迭代加深的效果与"1"到"threads"(默认"4")个线程的每秒结点数。
+ */
+
+int main(int argc, char* argv[])
 {
+	if (argc >= 2 && strcmp(argv[1], "bench") == 0)
+	{
+		BenchEngine(argc >= 3 ? atoi(argv[2]) : BENCH_DEPTH);
+		return 0;
+	}
+	if (argc >= 2 && strcmp(argv[1], "parallel") == 0)
+	{
+		BenchParallel(argc >= 3 ? atoi(argv[2]) : BENCH_DEPTH, argc >= 4 ? atoi(argv[3]) : BENCH_THREADS);
+		return 0;
+	}
 	int input = 0;
 	do
 	{
@@ -5,7 +5,7 @@ void Init_SequenceList(SeqList* ptr)
 {
 	assert(ptr);
 	ptr->array_ptr = NULL;
-	ptr->capacity = ptr->size = 0;
+	ptr->capacity = ptr->size = ptr->reserved = 0;
 }
 
 //打印顺序表
@@ -26,7 +26,32 @@ void Remove_SequenceList(SeqList* ptr)
 	assert(ptr);
 	free(ptr->array_ptr);
 	ptr->array_ptr = NULL;
-	ptr->capacity = ptr->size = 0;
+	ptr->capacity = ptr->size = ptr->reserved = 0;
+}
+
+//重新分配容量
+static void Realloc_SequenceList(SeqList* ptr, size_t newCapacity)
+{
+	SeqListDataType* tmp = (SeqListDataType*)realloc(ptr->array_ptr, sizeof(SeqListDataType) * newCapacity);
+	if (tmp == NULL)
+	{
+		perror("Realloc_SequenceList");
+		exit(EXIT_FAILURE);
+	}
+	ptr->array_ptr = tmp;
+	ptr->capacity = newCapacity;
+}
+
+//扩容至至少能容纳"minCapacity"个数据元素(按几何增长)
+static void Grow_SequenceList(SeqList* ptr, size_t minCapacity)
+{
+	if (minCapacity <= ptr->capacity)
+	{
+		return;
+	}
+	size_t newCapacity = ptr->capacity == 0 ? DEFAULT_SIZE : ptr->capacity / GROWTH_DENOMINATOR * GROWTH_NUMERATOR;
+	newCapacity = newCapacity > ptr->capacity ? newCapacity : ptr->capacity + 1;
+	Realloc_SequenceList(ptr, newCapacity > minCapacity ? newCapacity : minCapacity);
 }
 
 //检查容量
@@ -35,15 +60,30 @@ void Check_SequenceList(SeqList* ptr)
 	assert(ptr);
 	if (ptr->size == ptr->capacity)
 	{
-		size_t newCapacity = ptr->capacity == 0 ? DEFAULT_SIZE : ptr->capacity + EXPAND_SIZE;
-		SeqListDataType* tmp = (SeqListDataType*)realloc(ptr->array_ptr, sizeof(SeqListDataType) * newCapacity);
-		if (tmp == NULL)
-		{
-			perror("Check_SequenceList");
-			exit(EXIT_FAILURE);
-		}
-		ptr->array_ptr = tmp;
-		ptr->capacity = newCapacity;
+		Grow_SequenceList(ptr, ptr->size + 1);
+	}
+}
+
+//预留容量(容量至少为"capacity"，并且之后不会自动缩容到"capacity"以下)
+void Reserve_SequenceList(SeqList* ptr, size_t capacity)
+{
+	assert(ptr);
+	ptr->reserved = capacity;
+	if (capacity > ptr->capacity)
+	{
+		Realloc_SequenceList(ptr, capacity);
+	}
+}
+
+//缩减容量(元素个数过少时)
+void Shrink_SequenceList(SeqList* ptr)
+{
+	assert(ptr);
+	size_t minCapacity = ptr->reserved > DEFAULT_SIZE ? ptr->reserved : DEFAULT_SIZE;
+	if (ptr->capacity > minCapacity && ptr->size <= ptr->capacity / SHRINK_THRESHOLD)
+	{
+		size_t newCapacity = ptr->capacity / 2;
+		Realloc_SequenceList(ptr, newCapacity > minCapacity ? newCapacity : minCapacity);
 	}
 }
 
@@ -73,10 +113,7 @@ void Head_Insert_SequenceList(SeqList* ptr, SeqListDataType data)
 {
 	assert(ptr);
 	Check_SequenceList(ptr);
-	for (size_t i = ptr->size; i > 0; --i)
-	{
-		ptr->array_ptr[i] = ptr->array_ptr[i - 1];
-	}
+	memmove(ptr->array_ptr + 1, ptr->array_ptr, sizeof(SeqListDataType) * ptr->size);
 	ptr->array_ptr[0] = data;
 	++ptr->size;
 }
@@ -95,11 +132,9 @@ void Head_Delete_SequenceList(SeqList* ptr)
 {
 	assert(ptr);
 	assert(ptr->size);
-	for (size_t i = 0; i < ptr->size - 1; ++i)
-	{
-		ptr->array_ptr[i] = ptr->array_ptr[i + 1];
-	}
+	memmove(ptr->array_ptr, ptr->array_ptr + 1, sizeof(SeqListDataType) * (ptr->size - 1));
 	--ptr->size;
+	Shrink_SequenceList(ptr);
 }
 
 //在顺序表的末位置删除数据元素(尾删)
@@ -108,6 +143,7 @@ void Tail_Delete_SequenceList(SeqList* ptr)
 	assert(ptr);
 	assert(ptr->size);
 	--ptr->size;
+	Shrink_SequenceList(ptr);
 }
 
 //在顺序表的任意位置插入数据元素
@@ -116,10 +152,7 @@ void Insert_SequenceList(SeqList* ptr, size_t pos, SeqListDataType data)
 	assert(ptr);
 	assert(pos <= ptr->size);
 	Check_SequenceList(ptr);
-	for (size_t i = ptr->size; i > pos; --i)
-	{
-		ptr->array_ptr[i] = ptr->array_ptr[i - 1];
-	}
+	memmove(ptr->array_ptr + pos + 1, ptr->array_ptr + pos, sizeof(SeqListDataType) * (ptr->size - pos));
 	ptr->array_ptr[pos] = data;
 	++ptr->size;
 }
@@ -129,9 +162,51 @@ void Delete_SequenceList(SeqList* ptr, size_t pos)
 {
 	assert(ptr);
 	assert(pos < ptr->size);
-	for (size_t i = pos; i < ptr->size - 1; ++i)
+	memmove(ptr->array_ptr + pos, ptr->array_ptr + pos + 1, sizeof(SeqListDataType) * (ptr->size - pos - 1));
+	--ptr->size;
+	Shrink_SequenceList(ptr);
+}
+
+//在顺序表的末位置批量插入数据元素
+void Append_Range_SequenceList(SeqList* ptr, const SeqListDataType* data, size_t count)
+{
+	Insert_Range_SequenceList(ptr, ptr->size, data, count);
+}
+
+//在顺序表的任意位置批量插入数据元素
+void Insert_Range_SequenceList(SeqList* ptr, size_t pos, const SeqListDataType* data, size_t count)
+{
+	assert(ptr);
+	assert(pos <= ptr->size);
+	assert(data || count == 0);
+	if (count == 0)
 	{
-		ptr->array_ptr[i] = ptr->array_ptr[i + 1];
+		return;
 	}
-	--ptr->size;
+	//"data"可能指向顺序表自身：扩容后按偏移量重新定位，"pos"之后的部分在移动后整体后移"count"个位置
+	bool inside = ptr->array_ptr != NULL && data >= ptr->array_ptr && data < ptr->array_ptr + ptr->size;
+	size_t offset = inside ? (size_t)(data - ptr->array_ptr) : 0;
+	Grow_SequenceList(ptr, ptr->size + count);
+	memmove(ptr->array_ptr + pos + count, ptr->array_ptr + pos, sizeof(SeqListDataType) * (ptr->size - pos));
+	if (inside)
+	{
+		size_t before = offset < pos ? (pos - offset < count ? pos - offset : count) : 0;
+		memcpy(ptr->array_ptr + pos, ptr->array_ptr + offset, sizeof(SeqListDataType) * before);
+		memcpy(ptr->array_ptr + pos + before, ptr->array_ptr + offset + before + count, sizeof(SeqListDataType) * (count - before));
+	}
+	else
+	{
+		memcpy(ptr->array_ptr + pos, data, sizeof(SeqListDataType) * count);
+	}
+	ptr->size += count;
+}
+
+//在顺序表的任意位置批量删除数据元素
+void Erase_Range_SequenceList(SeqList* ptr, size_t pos, size_t count)
+{
+	assert(ptr);
+	assert(pos <= ptr->size && count <= ptr->size - pos);
+	memmove(ptr->array_ptr + pos, ptr->array_ptr + pos + count, sizeof(SeqListDataType) * (ptr->size - pos - count));
+	ptr->size -= count;
+	Shrink_SequenceList(ptr);
 }
\ No newline at end of file
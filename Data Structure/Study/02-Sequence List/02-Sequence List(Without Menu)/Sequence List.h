@@ -3,11 +3,22 @@
 //引用头文件
 #include <stdio.h>
 #include <assert.h>
+#include <string.h>
 #include <stdlib.h>
+#include <stdbool.h>
+
+/*
+ * 容量策略
+ * 1. 扩容：容量不足时按"GROWTH_NUMERATOR / GROWTH_DENOMINATOR"倍(默认"2"倍)几何增长，尾插"N"个元素的均摊时间复杂度为：O(1)。
+ * 2. 缩容：删除后元素个数不超过容量的"1 / SHRINK_THRESHOLD"时，容量减半(但不小于"DEFAULT_SIZE"，也不小于最近一次"Reserve_SequenceList"预留的容量)。
+ * 3. 扩容与缩容的阈值不同(满时扩容，四分之一时缩容)，形成滞后区间，避免在临界点反复插入删除时频繁分配内存。
+ */
 
 //定义标识符
-#define EXPAND_SIZE 5
 #define DEFAULT_SIZE 5
+#define GROWTH_NUMERATOR 2
+#define GROWTH_DENOMINATOR 1
+#define SHRINK_THRESHOLD 4
 
 //重命名顺序表数据元素类型
 typedef int SeqListDataType;
@@ -18,6 +29,7 @@ typedef struct SequenceList
 	SeqListDataType* array_ptr;
 	size_t size;
 	size_t capacity;
+	size_t reserved; //最近一次预留的容量(缩容的下限)
 } SeqList;
 
 //初始化顺序表
@@ -32,6 +44,12 @@ void Remove_SequenceList(SeqList* ptr);
 //检查容量
 void Check_SequenceList(SeqList* ptr);
 
+//预留容量(容量至少为"capacity"，并且之后不会自动缩容到"capacity"以下)
+void Reserve_SequenceList(SeqList* ptr, size_t capacity);
+
+//缩减容量(元素个数过少时)
+void Shrink_SequenceList(SeqList* ptr);
+
 //查找顺序表数据元素的位置
 size_t Search_SequenceList(SeqList* ptr, SeqListDataType data);
 
@@ -54,4 +72,13 @@ void Tail_Delete_SequenceList(SeqList* ptr);
 void Insert_SequenceList(SeqList* ptr, size_t pos, SeqListDataType data);
 
 //在顺序表的任意位置删除数据元素
-void Delete_SequenceList(SeqList* ptr, size_t pos);
\ No newline at end of file
+void Delete_SequenceList(SeqList* ptr, size_t pos);
+
+//在顺序表的末位置批量插入数据元素
+void Append_Range_SequenceList(SeqList* ptr, const SeqListDataType* data, size_t count);
+
+//在顺序表的任意位置批量插入数据元素
+void Insert_Range_SequenceList(SeqList* ptr, size_t pos, const SeqListDataType* data, size_t count);
+
+//在顺序表的任意位置批量删除数据元素
+void Erase_Range_SequenceList(SeqList* ptr, size_t pos, size_t count);
\ No newline at end of file
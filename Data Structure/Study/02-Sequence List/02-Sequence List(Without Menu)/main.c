@@ -1,4 +1,26 @@
 #include "Sequence List.h"
+#include <time.h>
+
+//旧版扩容策略(每次扩容"5"个)，仅用于性能对比
+#define LINEAR_EXPAND_SIZE 5
+
+//按旧版扩容策略尾插数据元素
+void Tail_Insert_Linear_SequenceList(SeqList* ptr, SeqListDataType data)
+{
+	if (ptr->size == ptr->capacity)
+	{
+		size_t newCapacity = ptr->capacity == 0 ? DEFAULT_SIZE : ptr->capacity + LINEAR_EXPAND_SIZE;
+		SeqListDataType* tmp = (SeqListDataType*)realloc(ptr->array_ptr, sizeof(SeqListDataType) * newCapacity);
+		if (tmp == NULL)
+		{
+			perror("Tail_Insert_Linear_SequenceList");
+			exit(EXIT_FAILURE);
+		}
+		ptr->array_ptr = tmp;
+		ptr->capacity = newCapacity;
+	}
+	ptr->array_ptr[ptr->size++] = data;
+}
 
 void Test_SequenceList_01()
 {
@@ -151,6 +173,116 @@ void Test_SequenceList_07()
 	printf("*****************************EXIT*****************************\n\n");
 }
 
+void Test_SequenceList_08()
+{
+	printf("******************************08******************************\n");
+	SeqList seqList;
+	Init_SequenceList(&seqList);
+
+	SeqListDataType data[] = { 10, 20, 30, 40, 50 };
+	Append_Range_SequenceList(&seqList, data, 5);
+	Print_SequenceList(&seqList);
+
+	Insert_Range_SequenceList(&seqList, 2, data, 3);
+	Print_SequenceList(&seqList);
+
+	Erase_Range_SequenceList(&seqList, 1, 4);
+	Print_SequenceList(&seqList);
+
+	Reserve_SequenceList(&seqList, 1000);
+	printf("Size = %zu, Capacity = %zu\n", seqList.size, seqList.capacity);
+	Erase_Range_SequenceList(&seqList, 0, 2);
+	printf("Size = %zu, Capacity = %zu\n", seqList.size, seqList.capacity);
+
+	Remove_SequenceList(&seqList);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_SequenceList_09()
+{
+	printf("******************************09******************************\n");
+	size_t count = 10000000;
+	SeqList seqList1, seqList2, seqList3;
+	Init_SequenceList(&seqList1);
+	Init_SequenceList(&seqList2);
+	Init_SequenceList(&seqList3);
+
+	size_t reallocCount = 0;
+	clock_t begin = clock();
+	for (size_t i = 0; i < count; ++i)
+	{
+		size_t capacity = seqList1.capacity;
+		Tail_Insert_Linear_SequenceList(&seqList1, (SeqListDataType)i);
+		reallocCount += seqList1.capacity != capacity;
+	}
+	printf("Tail_Insert(Linear)：%lfs，Realloc = %zu\n", (double)(clock() - begin) / CLOCKS_PER_SEC, reallocCount);
+
+	reallocCount = 0;
+	begin = clock();
+	for (size_t i = 0; i < count; ++i)
+	{
+		size_t capacity = seqList2.capacity;
+		Tail_Insert_SequenceList(&seqList2, (SeqListDataType)i);
+		reallocCount += seqList2.capacity != capacity;
+	}
+	printf("Tail_Insert(Geometric)：%lfs，Realloc = %zu\n", (double)(clock() - begin) / CLOCKS_PER_SEC, reallocCount);
+
+	begin = clock();
+	Reserve_SequenceList(&seqList3, count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		Tail_Insert_SequenceList(&seqList3, (SeqListDataType)i);
+	}
+	printf("Tail_Insert(Reserve)：%lfs\n", (double)(clock() - begin) / CLOCKS_PER_SEC);
+
+	begin = clock();
+	while (seqList2.size > 0)
+	{
+		Tail_Delete_SequenceList(&seqList2);
+	}
+	printf("Tail_Delete(Shrink)：%lfs，Capacity = %zu\n", (double)(clock() - begin) / CLOCKS_PER_SEC, seqList2.capacity);
+
+	Remove_SequenceList(&seqList1);
+	Remove_SequenceList(&seqList2);
+	Remove_SequenceList(&seqList3);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_SequenceList_10()
+{
+	printf("******************************10******************************\n");
+	//将顺序表自身的一段插入自身(插入位置在这一段之前、之中与之后，且插入时需要扩容)，与逐个计算的结果对照
+	bool succeed = true;
+	for (size_t size = 1; size <= 12; ++size)
+	{
+		for (size_t offset = 0; offset < size; ++offset)
+		{
+			for (size_t count = 1; offset + count <= size; ++count)
+			{
+				for (size_t pos = 0; pos <= size; ++pos)
+				{
+					SeqList seqList;
+					Init_SequenceList(&seqList);
+					SeqListDataType expected[32];
+					for (size_t i = 0; i < size; ++i)
+					{
+						Tail_Insert_SequenceList(&seqList, (SeqListDataType)i);
+					}
+					for (size_t i = 0; i < size + count; ++i)
+					{
+						expected[i] = (SeqListDataType)(i < pos ? i : (i < pos + count ? offset + i - pos : i - count));
+					}
+					Insert_Range_SequenceList(&seqList, pos, seqList.array_ptr + offset, count);
+					succeed = succeed && seqList.size == size + count && memcmp(seqList.array_ptr, expected, sizeof(SeqListDataType) * (size + count)) == 0;
+					Remove_SequenceList(&seqList);
+				}
+			}
+		}
+	}
+	printf("%s\n", succeed ? "Good Luck!" : "Oops!");
+	printf("*****************************EXIT*****************************\n\n");
+}
+
 int main()
 {
 	Test_SequenceList_01();
@@ -160,5 +292,8 @@ int main()
 	Test_SequenceList_05();
 	Test_SequenceList_06();
 	Test_SequenceList_07();
+	Test_SequenceList_08();
+	Test_SequenceList_09();
+	Test_SequenceList_10();
 	return 0;
 }
\ No newline at end of file
@@ -1,9 +1,9 @@
 #include "Singly Linked List.h"
 
-//创建一个单链表节点
-SLLNode* Create_SinglyLinkedListNode(SLLDataType data)
+//从内存池(为空时使用"malloc")中申请一个单链表节点
+static SLLNode* Alloc_SinglyLinkedListNode(MemoryPool* pool, SLLDataType data)
 {
-	SLLNode* newNode = (SLLNode*)malloc(sizeof(SLLNode));
+	SLLNode* newNode = pool == NULL ? (SLLNode*)malloc(sizeof(SLLNode)) : (SLLNode*)Alloc_Pool(pool);
 	if (newNode == NULL)
 	{
 		perror("Create_SinglyLinkedListNode");
@@ -14,6 +14,29 @@ SLLNode* Create_SinglyLinkedListNode(SLLDataType data)
 	return newNode;
 }
 
+//将一个单链表节点归还给内存池(为空时使用"free")
+static void Free_SinglyLinkedListNode(MemoryPool* pool, SLLNode* node)
+{
+	pool == NULL ? free(node) : Free_Pool(pool, node);
+}
+
+//释放从"node"开始的全部节点
+static void Free_SinglyLinkedList(MemoryPool* pool, SLLNode* node)
+{
+	while (node != NULL)
+	{
+		SLLNode* next = node->next;
+		Free_SinglyLinkedListNode(pool, node);
+		node = next;
+	}
+}
+
+//创建一个单链表节点
+SLLNode* Create_SinglyLinkedListNode(SLLDataType data)
+{
+	return Alloc_SinglyLinkedListNode(NULL, data);
+}
+
 //打印单链表
 void Print_SinglyLinkedList(SLLNode* phead)
 {
@@ -217,4 +240,219 @@ void Destroy_SinglyLinkedList(SLLNode** pphead)
 		cur = next;
 	}
 	*pphead = NULL;
+}
+
+//初始化带首尾指针的单链表
+void Init_SLList(SLList* ptr)
+{
+	Init_Pool_SLList(ptr, NULL);
+}
+
+//初始化使用内存池的带首尾指针的单链表(内存池为空时使用"malloc/free")
+void Init_Pool_SLList(SLList* ptr, MemoryPool* pool)
+{
+	assert(ptr);
+	assert(pool == NULL || pool->blockSize >= sizeof(SLLNode));
+	ptr->head = ptr->tail = NULL;
+	ptr->size = 0;
+	ptr->pool = pool;
+}
+
+//打印带首尾指针的单链表
+void Print_SLList(SLList* ptr)
+{
+	assert(ptr);
+	Print_SinglyLinkedList(ptr->head);
+}
+
+//在带首尾指针的单链表的首位置插入节点(头插)
+void Head_Insert_SLList(SLList* ptr, SLLDataType data)
+{
+	assert(ptr);
+	After_Insert_SLList(ptr, NULL, data);
+}
+
+//在带首尾指针的单链表的末位置插入节点(尾插)
+void Tail_Insert_SLList(SLList* ptr, SLLDataType data)
+{
+	assert(ptr);
+	After_Insert_SLList(ptr, ptr->tail, data);
+}
+
+//删除带首尾指针的单链表的首位置节点(头删)
+void Head_Delete_SLList(SLList* ptr)
+{
+	assert(ptr);
+	After_Erase_SLList(ptr, NULL);
+}
+
+//删除带首尾指针的单链表的末位置节点(尾删)
+void Tail_Delete_SLList(SLList* ptr)
+{
+	assert(ptr);
+	assert(ptr->head);
+	SLLNode* prev = NULL;
+	if (ptr->head != ptr->tail)
+	{
+		prev = ptr->head;
+		while (prev->next != ptr->tail)
+		{
+			prev = prev->next;
+		}
+	}
+	After_Erase_SLList(ptr, prev);
+}
+
+//在带首尾指针的单链表节点之后插入新节点("pos"为空时插入到首位置)
+void After_Insert_SLList(SLList* ptr, SLLNode* pos, SLLDataType data)
+{
+	assert(ptr);
+	SLLNode* newNode = Alloc_SinglyLinkedListNode(ptr->pool, data);
+	if (pos == NULL)
+	{
+		newNode->next = ptr->head;
+		ptr->head = newNode;
+	}
+	else
+	{
+		newNode->next = pos->next;
+		pos->next = newNode;
+	}
+	if (pos == ptr->tail)
+	{
+		ptr->tail = newNode;
+	}
+	++ptr->size;
+}
+
+//删除带首尾指针的单链表节点的后一个节点("pos"为空时删除首节点)
+void After_Erase_SLList(SLList* ptr, SLLNode* pos)
+{
+	assert(ptr);
+	SLLNode* del = pos == NULL ? ptr->head : pos->next;
+	assert(del);
+	pos == NULL ? (ptr->head = del->next) : (pos->next = del->next);
+	if (del == ptr->tail)
+	{
+		ptr->tail = pos;
+	}
+	Free_SinglyLinkedListNode(ptr->pool, del);
+	--ptr->size;
+}
+
+//将单链表"src"的全部节点拼接到单链表"dst"的末尾("src"变为空表)
+void Concat_SLList(SLList* dst, SLList* src)
+{
+	assert(dst && src);
+	Splice_SLList(dst, dst->tail, src);
+}
+
+//将单链表"src"的全部节点插入到单链表"dst"的节点"pos"之后("pos"为空时插入到首位置，"src"变为空表)
+void Splice_SLList(SLList* dst, SLLNode* pos, SLList* src)
+{
+	assert(dst && src);
+	assert(dst != src);
+	//节点归还给各自表头中的内存池，只能在使用同一内存池的单链表之间移动
+	assert(dst->pool == src->pool);
+	if (src->head == NULL)
+	{
+		return;
+	}
+	if (pos == NULL)
+	{
+		src->tail->next = dst->head;
+		dst->head = src->head;
+	}
+	else
+	{
+		src->tail->next = pos->next;
+		pos->next = src->head;
+	}
+	if (pos == dst->tail)
+	{
+		dst->tail = src->tail;
+	}
+	dst->size += src->size;
+	src->head = src->tail = NULL;
+	src->size = 0;
+}
+
+//合并两个有序单链表，返回合并结果的首节点
+static SLLNode* Merge_SLList(SLLNode* left, SLLNode* right)
+{
+	SLLNode guard;
+	SLLNode* prev = &guard;
+	while (left != NULL && right != NULL)
+	{
+		//相等时先取左侧节点(保证稳定性)
+		if (right->data < left->data)
+		{
+			prev->next = right;
+			right = right->next;
+		}
+		else
+		{
+			prev->next = left;
+			left = left->next;
+		}
+		prev = prev->next;
+	}
+	prev->next = left != NULL ? left : right;
+	return guard.next;
+}
+
+//排序带首尾指针的单链表(升序，原地归并排序)
+void Sort_SLList(SLList* ptr)
+{
+	assert(ptr);
+	if (ptr->size < 2)
+	{
+		return;
+	}
+	//"bins[i]"为空或为一段长度为"2^i"的有序链表，每取下一个节点就像二进制加法一样向高位合并进位，
+	//使合并总是发生在最近访问过的节点之间(比逐轮遍历整个链表的自底向上归并对缓存更友好)
+	SLLNode* bins[64] = { NULL };
+	size_t used = 0;
+	SLLNode* cur = ptr->head;
+	while (cur != NULL)
+	{
+		SLLNode* carry = cur;
+		cur = cur->next;
+		carry->next = NULL;
+		size_t i = 0;
+		for (; i < used && bins[i] != NULL; ++i)
+		{
+			carry = Merge_SLList(bins[i], carry);
+			bins[i] = NULL;
+		}
+		used = i == used ? used + 1 : used;
+		bins[i] = carry;
+	}
+	SLLNode* head = NULL;
+	for (size_t i = 0; i < used; ++i)
+	{
+		head = bins[i] == NULL ? head : Merge_SLList(bins[i], head);
+	}
+	ptr->head = head;
+	while (head->next != NULL)
+	{
+		head = head->next;
+	}
+	ptr->tail = head;
+}
+
+//获取带首尾指针的单链表的长度
+size_t Length_SLList(SLList* ptr)
+{
+	assert(ptr);
+	return ptr->size;
+}
+
+//销毁带首尾指针的单链表
+void Destroy_SLList(SLList* ptr)
+{
+	assert(ptr);
+	Free_SinglyLinkedList(ptr->pool, ptr->head);
+	ptr->head = ptr->tail = NULL;
+	ptr->size = 0;
 }
\ No newline at end of file
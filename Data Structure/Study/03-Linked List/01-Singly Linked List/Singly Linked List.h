@@ -5,6 +5,9 @@
 #include <stdlib.h>
 #include <assert.h>
 
+//引用内存池头文件
+#include "../../07-Memory Pool/Memory Pool.h"
+
 //重命名单链表数据元素类型
 typedef int SLLDataType;
 
@@ -15,6 +18,22 @@ typedef struct SinglyLinkedListNode
 	struct SinglyLinkedListNode* next;
 } SLLNode;
 
+/*
+ * 带首尾指针与长度的单链表(SLList)
+ * 1. 以"SLList"记录首节点、尾节点与节点个数，节点类型与无头单链表相同；表头中保存该单链表所使用的内存池(为空时使用"malloc/free")，不同单链表互不影响。
+ * 2. 头插、尾插、头删、获取长度、拼接两个单链表的时间复杂度均为：O(1)；尾删仍需找到尾节点的前一个节点，时间复杂度为：O(N)。
+ * 3. 排序为自底向上的归并排序，只修改节点的指针而不移动数据，时间复杂度为：O(N * logN)，额外空间复杂度为：O(1)(64个指针)，稳定。
+ */
+
+//定义结构体类型(带首尾指针与长度的单链表)
+typedef struct SinglyLinkedList
+{
+	SLLNode* head;
+	SLLNode* tail;
+	size_t size;
+	MemoryPool* pool;
+} SLList;
+
 //创建一个单链表节点
 SLLNode* Create_SinglyLinkedListNode(SLLDataType data);
 
@@ -55,4 +74,46 @@ void After_Erase_SinglyLinkedListNode(SLLNode* pos);
 size_t Length_SinglyLinkedList(SLLNode* phead);
 
 //销毁单链表
-void Destroy_SinglyLinkedList(SLLNode** pphead);
\ No newline at end of file
+void Destroy_SinglyLinkedList(SLLNode** pphead);
+
+//初始化带首尾指针的单链表
+void Init_SLList(SLList* ptr);
+
+//初始化使用内存池的带首尾指针的单链表(内存池为空时使用"malloc/free")
+void Init_Pool_SLList(SLList* ptr, MemoryPool* pool);
+
+//打印带首尾指针的单链表
+void Print_SLList(SLList* ptr);
+
+//在带首尾指针的单链表的首位置插入节点(头插)
+void Head_Insert_SLList(SLList* ptr, SLLDataType data);
+
+//在带首尾指针的单链表的末位置插入节点(尾插)
+void Tail_Insert_SLList(SLList* ptr, SLLDataType data);
+
+//删除带首尾指针的单链表的首位置节点(头删)
+void Head_Delete_SLList(SLList* ptr);
+
+//删除带首尾指针的单链表的末位置节点(尾删)
+void Tail_Delete_SLList(SLList* ptr);
+
+//在带首尾指针的单链表节点之后插入新节点("pos"为空时插入到首位置)
+void After_Insert_SLList(SLList* ptr, SLLNode* pos, SLLDataType data);
+
+//删除带首尾指针的单链表节点的后一个节点("pos"为空时删除首节点)
+void After_Erase_SLList(SLList* ptr, SLLNode* pos);
+
+//将单链表"src"的全部节点拼接到单链表"dst"的末尾("src"变为空表)
+void Concat_SLList(SLList* dst, SLList* src);
+
+//将单链表"src"的全部节点插入到单链表"dst"的节点"pos"之后("pos"为空时插入到首位置，"src"变为空表)
+void Splice_SLList(SLList* dst, SLLNode* pos, SLList* src);
+
+//排序带首尾指针的单链表(升序，原地归并排序)
+void Sort_SLList(SLList* ptr);
+
+//获取带首尾指针的单链表的长度
+size_t Length_SLList(SLList* ptr);
+
+//销毁带首尾指针的单链表
+void Destroy_SLList(SLList* ptr);
\ No newline at end of file
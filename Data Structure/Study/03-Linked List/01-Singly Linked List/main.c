@@ -1,4 +1,5 @@
 #include "Singly Linked List.h"
+#include <time.h>
 
 void Test_SinglyLinkedList_01()
 {
@@ -258,6 +259,161 @@ void Test_SinglyLinkedList_08()
 	printf("*****************************EXIT*****************************\n\n");
 }
 
+void Test_SinglyLinkedList_09()
+{
+	printf("******************************09******************************\n");
+	MemoryPool pool;
+	Init_Pool(&pool, sizeof(SLLNode), 4, false);
+	SLList list01, list02;
+	Init_Pool_SLList(&list01, &pool);
+	Init_SLList(&list02);
+
+	for (int i = 0; i < 10; ++i)
+	{
+		Tail_Insert_SLList(&list01, i);
+		Tail_Insert_SLList(&list02, i);
+	}
+	Print_SLList(&list01);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	Head_Delete_SLList(&list01);
+	Tail_Delete_SLList(&list01);
+	Print_SLList(&list01);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	//释放的节点被重新使用，不再申请新的大块内存
+	Head_Insert_SLList(&list01, 0);
+	Head_Insert_SLList(&list01, -1);
+	Print_SLList(&list01);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	//"list02"未使用内存池，它的节点不计入内存池
+	Print_SLList(&list02);
+
+	Destroy_SLList(&list01);
+	Destroy_SLList(&list02);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	Destroy_Pool(&pool);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_SinglyLinkedList_10()
+{
+	printf("******************************10******************************\n");
+	SLList list01, list02;
+	Init_SLList(&list01);
+	Init_SLList(&list02);
+
+	for (int i = 0; i < 5; ++i)
+	{
+		Tail_Insert_SLList(&list01, i);
+		Head_Insert_SLList(&list02, 10 + i);
+	}
+	Print_SLList(&list01);
+	Print_SLList(&list02);
+	Concat_SLList(&list01, &list02);
+	Print_SLList(&list01);
+	printf("Length = %zu, Tail = %d, Empty = %zu\n", Length_SLList(&list01), list01.tail->data, Length_SLList(&list02));
+
+	Tail_Insert_SLList(&list02, 7);
+	Tail_Insert_SLList(&list02, 5);
+	Splice_SLList(&list01, Search_SinglyLinkedListNode(list01.head, 2), &list02);
+	Tail_Insert_SLList(&list02, -1);
+	Splice_SLList(&list01, NULL, &list02);
+	Print_SLList(&list01);
+	Head_Delete_SLList(&list01);
+	Tail_Delete_SLList(&list01);
+	Tail_Insert_SLList(&list01, 3);
+	Print_SLList(&list01);
+	Sort_SLList(&list01);
+	Print_SLList(&list01);
+	printf("Length = %zu, Tail = %d\n", Length_SLList(&list01), list01.tail->data);
+
+	//随机数据排序后与"qsort"排序的结果比较
+	bool good = true;
+	srand(0);
+	for (size_t size = 0; size < 300 && good; ++size)
+	{
+		SLLDataType arr[300];
+		for (size_t i = 0; i < size; ++i)
+		{
+			arr[i] = rand() % 50;
+			Tail_Insert_SLList(&list02, arr[i]);
+		}
+		for (size_t i = 1; i < size; ++i)
+		{
+			for (size_t j = i; j > 0 && arr[j - 1] > arr[j]; --j)
+			{
+				SLLDataType temp = arr[j];
+				arr[j] = arr[j - 1];
+				arr[j - 1] = temp;
+			}
+		}
+		Sort_SLList(&list02);
+		SLLNode* cur = list02.head;
+		for (size_t i = 0; i < size; ++i, cur = cur->next)
+		{
+			good = good && cur->data == arr[i];
+		}
+		good = good && cur == NULL && Length_SLList(&list02) == size && (size == 0 || list02.tail->data == arr[size - 1]);
+		Destroy_SLList(&list02);
+	}
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+
+	Destroy_SLList(&list01);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_SinglyLinkedList_11()
+{
+	printf("******************************11******************************\n");
+	//无头单链表的尾插需要遍历整个链表，建立链表的总耗时随长度平方增长
+	for (size_t size = 5000; size <= 40000; size *= 2)
+	{
+		SLLNode* phead = NULL;
+		clock_t begin = clock();
+		for (size_t i = 0; i < size; ++i)
+		{
+			Tail_Insert_SinglyLinkedListNode(&phead, (SLLDataType)i);
+		}
+		clock_t end = clock();
+		printf("Tail_Insert_SinglyLinkedListNode: %-10zu%.1lfms\n", size, (double)(end - begin) * 1000.0 / CLOCKS_PER_SEC);
+		Destroy_SinglyLinkedList(&phead);
+	}
+
+	//带首尾指针的单链表的尾插为"O(1)"，建立链表的总耗时随长度线性增长
+	for (size_t size = 1250000; size <= 10000000; size *= 2)
+	{
+		SLList list;
+		Init_SLList(&list);
+		clock_t begin = clock();
+		for (size_t i = 0; i < size; ++i)
+		{
+			Tail_Insert_SLList(&list, (SLLDataType)i);
+		}
+		clock_t end = clock();
+		printf("Tail_Insert_SLList: %-10zu%.1lfms\n", size, (double)(end - begin) * 1000.0 / CLOCKS_PER_SEC);
+		Destroy_SLList(&list);
+	}
+
+	SLList list;
+	Init_SLList(&list);
+	srand(0);
+	for (size_t i = 0; i < 10000000; ++i)
+	{
+		Tail_Insert_SLList(&list, rand());
+	}
+	clock_t begin = clock();
+	Sort_SLList(&list);
+	clock_t end = clock();
+	bool good = true;
+	for (SLLNode* cur = list.head; cur->next != NULL; cur = cur->next)
+	{
+		good = good && cur->data <= cur->next->data;
+	}
+	printf("Sort_SLList: %-10zu%.1lfms\n", Length_SLList(&list), (double)(end - begin) * 1000.0 / CLOCKS_PER_SEC);
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+	Destroy_SLList(&list);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
 int main()
 {
 	Test_SinglyLinkedList_01();
@@ -268,5 +424,8 @@ int main()
 	Test_SinglyLinkedList_06();
 	Test_SinglyLinkedList_07();
 	Test_SinglyLinkedList_08();
+	Test_SinglyLinkedList_09();
+	Test_SinglyLinkedList_10();
+	Test_SinglyLinkedList_11();
 	return 0;
 }
\ No newline at end of file
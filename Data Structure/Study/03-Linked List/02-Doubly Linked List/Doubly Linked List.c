@@ -1,14 +1,57 @@
 #include "Doubly Linked List.h"
 
+//定义结构体类型(双向链表的表头：哨兵节点与该链表所使用的内存池)
+typedef struct DoublyLinkedListHead
+{
+	DLLNode guard;
+	MemoryPool* pool;
+} DLLHead;
+
+//获取双向链表所使用的内存池
+static MemoryPool* Pool_DoublyLinkedList(DLLNode* phead)
+{
+	return ((DLLHead*)phead)->pool;
+}
+
+//从内存池(为空时使用"malloc")中申请一个双向链表节点
+static DLLNode* Alloc_DoublyLinkedListNode(MemoryPool* pool, DLLDataType data)
+{
+	DLLNode* newNode = pool == NULL ? (DLLNode*)malloc(sizeof(DLLNode)) : (DLLNode*)Alloc_Pool(pool);
+	if (newNode == NULL)
+	{
+		perror("Create_SinglyLinkedListNode");
+		exit(EXIT_FAILURE);
+	}
+	newNode->data = data;
+	newNode->prev = newNode;
+	newNode->next = newNode;
+	return newNode;
+}
+
+//将一个双向链表节点归还给内存池(为空时使用"free")
+static void Free_DoublyLinkedListNode(MemoryPool* pool, DLLNode* node)
+{
+	pool == NULL ? free(node) : Free_Pool(pool, node);
+}
+
 //初识化双向链表
 DLLNode* Init_DoublyLinkedListNode()
 {
-	DLLNode* guard = (DLLNode*)malloc(sizeof(DLLNode));
-	if (guard == NULL)
+	return Init_Pool_DoublyLinkedListNode(NULL);
+}
+
+//初始化使用内存池的双向链表(内存池为空时使用"malloc/free"，哨兵节点总是使用"malloc")
+DLLNode* Init_Pool_DoublyLinkedListNode(MemoryPool* pool)
+{
+	assert(pool == NULL || pool->blockSize >= sizeof(DLLNode));
+	DLLHead* head = (DLLHead*)malloc(sizeof(DLLHead));
+	if (head == NULL)
 	{
 		perror("Init_DoublyLinkedListNode");
 		exit(EXIT_FAILURE);
 	}
+	head->pool = pool;
+	DLLNode* guard = &head->guard;
 	guard->prev = guard;
 	guard->next = guard;
 	return guard;
@@ -17,16 +60,7 @@ DLLNode* Init_DoublyLinkedListNode()
 //创建一个双向链表节点
 DLLNode* Create_DoublyLinkedListNode(DLLDataType data)
 {
-	DLLNode* newNode = (DLLNode*)malloc(sizeof(DLLNode));
-	if (newNode == NULL)
-	{
-		perror("Create_SinglyLinkedListNode");
-		exit(EXIT_FAILURE);
-	}
-	newNode->data = data;
-	newNode->prev = newNode;
-	newNode->next = newNode;
-	return newNode;
+	return Alloc_DoublyLinkedListNode(NULL, data);
 }
 
 //打印双向链表
@@ -70,7 +104,7 @@ void Print_DoublyLinkedList(DLLNode* phead)
 void Head_Insert_DoublyLinkedListNode(DLLNode* phead, DLLDataType data)
 {
 	assert(phead);
-	DLLNode* newNode = Create_DoublyLinkedListNode(data);
+	DLLNode* newNode = Alloc_DoublyLinkedListNode(Pool_DoublyLinkedList(phead), data);
 	newNode->prev = phead;
 	newNode->next = phead->next;
 	phead->next->prev = newNode;
@@ -81,7 +115,7 @@ void Head_Insert_DoublyLinkedListNode(DLLNode* phead, DLLDataType data)
 void Tail_Insert_DoublyLinkedListNode(DLLNode* phead, DLLDataType data)
 {
 	assert(phead);
-	DLLNode* newNode = Create_DoublyLinkedListNode(data);
+	DLLNode* newNode = Alloc_DoublyLinkedListNode(Pool_DoublyLinkedList(phead), data);
 	newNode->next = phead;
 	newNode->prev = phead->prev;
 	phead->prev->next = newNode;
@@ -96,7 +130,7 @@ void Head_Delete_DoublyLinkedListNode(DLLNode* phead)
 	DLLNode* del = phead->next;
 	phead->next->next->prev = phead;
 	phead->next = phead->next->next;
-	free(del);
+	Free_DoublyLinkedListNode(Pool_DoublyLinkedList(phead), del);
 }
 
 //删除双向链表的末位置节点(尾删)
@@ -107,7 +141,7 @@ void Tail_Delete_DoublyLinkedListNode(DLLNode* phead)
 	DLLNode* del = phead->prev;
 	phead->prev->prev->next = phead;
 	phead->prev = phead->prev->prev;
-	free(del);
+	Free_DoublyLinkedListNode(Pool_DoublyLinkedList(phead), del);
 }
 
 //查找双向链表数据元素的节点地址
@@ -131,7 +165,7 @@ void Insert_DoublyLinkedListNode(DLLNode* phead, DLLNode* pos, DLLDataType data)
 {
 	assert(phead);
 	assert(pos);
-	DLLNode* newNode = Create_DoublyLinkedListNode(data);
+	DLLNode* newNode = Alloc_DoublyLinkedListNode(Pool_DoublyLinkedList(phead), data);
 	newNode->next = pos;
 	newNode->prev = pos->prev;
 	pos->prev->next = newNode;
@@ -139,12 +173,13 @@ void Insert_DoublyLinkedListNode(DLLNode* phead, DLLNode* pos, DLLDataType data)
 }
 
 //删除当前双向链表节点
-void Erase_DoublyLinkedList(DLLNode* pos)
+void Erase_DoublyLinkedList(DLLNode* phead, DLLNode* pos)
 {
-	assert(pos);
+	assert(phead);
+	assert(pos && pos != phead);
 	pos->prev->next = pos->next;
 	pos->next->prev = pos->prev;
-	free(pos);
+	Free_DoublyLinkedListNode(Pool_DoublyLinkedList(phead), pos);
 }
 
 //判断双向链表是否为空表
@@ -176,8 +211,8 @@ void Destroy_DoublyLinkedList(DLLNode* phead)
 	while (cur != phead)
 	{
 		DLLNode* next = cur->next;
-		free(cur);
+		Free_DoublyLinkedListNode(Pool_DoublyLinkedList(phead), cur);
 		cur = next;
 	}
-	free(phead);
+	free((DLLHead*)phead);
 }
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include <assert.h>
 #include <stdbool.h>
 
+//引用内存池头文件
+#include "../../07-Memory Pool/Memory Pool.h"
+
 //重命名双向链表数据元素类型
 typedef int DLLDataType;
 
@@ -17,9 +20,19 @@ typedef struct DoublyLinkedListNode
 	struct DoublyLinkedListNode* next;
 } DLLNode;
 
+/*
+ * 内存池
+ * 1. 哨兵节点所在的表头中保存该双向链表所使用的内存池，插入与删除的节点均从该内存池申请、归还给该内存池，不同双向链表互不影响。
+ * 2. "Init_DoublyLinkedListNode"初始化的双向链表不使用内存池(使用"malloc/free")。
+ * 3. 删除节点需要知道它所在的双向链表，故"Erase_DoublyLinkedList"需要传入哨兵节点。
+ */
+
 //初识化双向链表
 DLLNode* Init_DoublyLinkedListNode();
 
+//初始化使用内存池的双向链表(内存池为空时使用"malloc/free"，哨兵节点总是使用"malloc")
+DLLNode* Init_Pool_DoublyLinkedListNode(MemoryPool* pool);
+
 //创建一个双向链表节点
 DLLNode* Create_DoublyLinkedListNode(DLLDataType data);
 
@@ -45,7 +58,7 @@ DLLNode* Search_DoublyLinkedListNode(DLLNode* phead, DLLDataType data);
 void Insert_DoublyLinkedListNode(DLLNode* phead, DLLNode* pos, DLLDataType data);
 
 //删除当前双向链表节点
-void Erase_DoublyLinkedList(DLLNode* pos);
+void Erase_DoublyLinkedList(DLLNode* phead, DLLNode* pos);
 
 //判断双向链表是否为空表
 bool Empty_DoublyLinkedList(DLLNode* phead);
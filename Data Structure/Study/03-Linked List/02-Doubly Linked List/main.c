@@ -183,7 +183,7 @@ void Test_DoublyLinkedList_06()
 	DLLNode* pos = Search_DoublyLinkedListNode(phead, 1);
 	if (pos != NULL)
 	{
-		Erase_DoublyLinkedList(pos);
+		Erase_DoublyLinkedList(phead, pos);
 	}
 	Print_DoublyLinkedList(phead);
 	pos = Search_DoublyLinkedListNode(phead, 8);
@@ -194,12 +194,12 @@ void Test_DoublyLinkedList_06()
 	pos = Search_DoublyLinkedListNode(phead, 7);
 	if (pos != NULL)
 	{
-		Erase_DoublyLinkedList(pos);
+		Erase_DoublyLinkedList(phead, pos);
 	}
 	pos = Search_DoublyLinkedListNode(phead, 9);
 	if (pos != NULL)
 	{
-		Erase_DoublyLinkedList(pos);
+		Erase_DoublyLinkedList(phead, pos);
 	}
 	pos = Search_DoublyLinkedListNode(phead, 2);
 	if (pos != NULL)
@@ -214,6 +214,41 @@ void Test_DoublyLinkedList_06()
 	printf("************************************************EXIT************************************************\n\n");
 }
 
+void Test_DoublyLinkedList_07()
+{
+	printf("**************************************************07**************************************************\n");
+	MemoryPool pool;
+	Init_Pool(&pool, sizeof(DLLNode), 4, false);
+	DLLNode* phead01 = Init_Pool_DoublyLinkedListNode(&pool);
+	DLLNode* phead02 = Init_DoublyLinkedListNode();
+
+	for (int i = 0; i < 10; ++i)
+	{
+		Tail_Insert_DoublyLinkedListNode(phead01, i);
+		Tail_Insert_DoublyLinkedListNode(phead02, i);
+	}
+	Print_DoublyLinkedList(phead01);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	Head_Delete_DoublyLinkedListNode(phead01);
+	Tail_Delete_DoublyLinkedListNode(phead01);
+	Erase_DoublyLinkedList(phead01, Search_DoublyLinkedListNode(phead01, 5));
+	Print_DoublyLinkedList(phead01);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	//释放的节点被重新使用，不再申请新的大块内存
+	Head_Insert_DoublyLinkedListNode(phead01, 0);
+	Insert_DoublyLinkedListNode(phead01, Search_DoublyLinkedListNode(phead01, 6), 5);
+	Print_DoublyLinkedList(phead01);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	//"phead02"未使用内存池，它的节点不计入内存池
+	Print_DoublyLinkedList(phead02);
+
+	Destroy_DoublyLinkedList(phead01);
+	Destroy_DoublyLinkedList(phead02);
+	printf("Used = %zu, Slabs = %zu\n", Used_Pool(&pool), pool.slabNumber);
+	Destroy_Pool(&pool);
+	printf("************************************************EXIT************************************************\n\n");
+}
+
 int main()
 {
 	Test_DoublyLinkedList_01();
@@ -222,5 +257,6 @@ int main()
 	Test_DoublyLinkedList_04();
 	Test_DoublyLinkedList_05();
 	Test_DoublyLinkedList_06();
+	Test_DoublyLinkedList_07();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,280 @@
+#include "Unrolled Linked List.h"
+
+//初始化展开链表
+void Init_UnrolledLinkedList(ULList* ptr)
+{
+	assert(ptr);
+	ptr->head = NULL;
+	ptr->tail = NULL;
+	ptr->size = 0;
+}
+
+//创建一个展开链表节点
+ULLNode* Create_UnrolledLinkedListNode()
+{
+	ULLNode* newNode = (ULLNode*)malloc(sizeof(ULLNode));
+	if (newNode == NULL)
+	{
+		perror("Create_UnrolledLinkedListNode");
+		exit(EXIT_FAILURE);
+	}
+	newNode->prev = NULL;
+	newNode->next = NULL;
+	newNode->count = 0;
+	return newNode;
+}
+
+//在节点"pos"之后链接新节点("pos"为空时链接为首节点)
+static ULLNode* Link_UnrolledLinkedListNode(ULList* ptr, ULLNode* pos)
+{
+	ULLNode* newNode = Create_UnrolledLinkedListNode();
+	ULLNode* next = pos == NULL ? ptr->head : pos->next;
+	newNode->prev = pos;
+	newNode->next = next;
+	pos == NULL ? (ptr->head = newNode) : (pos->next = newNode);
+	next == NULL ? (ptr->tail = newNode) : (next->prev = newNode);
+	return newNode;
+}
+
+//断开并释放节点
+static void Unlink_UnrolledLinkedListNode(ULList* ptr, ULLNode* pos)
+{
+	pos->prev == NULL ? (ptr->head = pos->next) : (pos->prev->next = pos->next);
+	pos->next == NULL ? (ptr->tail = pos->prev) : (pos->next->prev = pos->prev);
+	free(pos);
+}
+
+//定位第"pos"个数据元素所在的节点及其在节点内的下标(从距离较近的一端开始查找)
+static ULLNode* Locate_UnrolledLinkedList(ULList* ptr, size_t pos, size_t* offset)
+{
+	ULLNode* cur = NULL;
+	if (pos < ptr->size / 2)
+	{
+		cur = ptr->head;
+		while (pos >= cur->count)
+		{
+			pos -= cur->count;
+			cur = cur->next;
+		}
+	}
+	else
+	{
+		size_t rest = ptr->size - pos;
+		cur = ptr->tail;
+		while (rest > cur->count)
+		{
+			rest -= cur->count;
+			cur = cur->prev;
+		}
+		pos = cur->count - rest;
+	}
+	*offset = pos;
+	return cur;
+}
+
+//打印展开链表
+void Print_UnrolledLinkedList(ULList* ptr)
+{
+	assert(ptr);
+	ULLNode* cur = ptr->head;
+	while (cur != NULL)
+	{
+		printf("[");
+		for (size_t i = 0; i < cur->count; ++i)
+		{
+			printf(i == 0 ? "%d" : " %d", cur->data[i]);
+		}
+		printf("] -> ");
+		cur = cur->next;
+	}
+	printf("NULL\n");
+}
+
+//在展开链表的首位置插入数据元素(头插)
+void Head_Insert_UnrolledLinkedList(ULList* ptr, ULLDataType data)
+{
+	assert(ptr);
+	ULLNode* head = ptr->head;
+	if (head == NULL || head->count == ULL_NODE_CAPACITY)
+	{
+		head = Link_UnrolledLinkedListNode(ptr, NULL);
+	}
+	memmove(head->data + 1, head->data, sizeof(ULLDataType) * head->count);
+	head->data[0] = data;
+	++head->count;
+	++ptr->size;
+}
+
+//在展开链表的末位置插入数据元素(尾插)
+void Tail_Insert_UnrolledLinkedList(ULList* ptr, ULLDataType data)
+{
+	assert(ptr);
+	ULLNode* tail = ptr->tail;
+	if (tail == NULL || tail->count == ULL_NODE_CAPACITY)
+	{
+		tail = Link_UnrolledLinkedListNode(ptr, tail);
+	}
+	tail->data[tail->count++] = data;
+	++ptr->size;
+}
+
+//删除展开链表的首位置数据元素(头删)
+void Head_Delete_UnrolledLinkedList(ULList* ptr)
+{
+	assert(ptr);
+	assert(!Empty_UnrolledLinkedList(ptr));
+	ULLNode* head = ptr->head;
+	--head->count;
+	--ptr->size;
+	if (head->count == 0)
+	{
+		Unlink_UnrolledLinkedListNode(ptr, head);
+	}
+	else
+	{
+		memmove(head->data, head->data + 1, sizeof(ULLDataType) * head->count);
+	}
+}
+
+//删除展开链表的末位置数据元素(尾删)
+void Tail_Delete_UnrolledLinkedList(ULList* ptr)
+{
+	assert(ptr);
+	assert(!Empty_UnrolledLinkedList(ptr));
+	ULLNode* tail = ptr->tail;
+	--tail->count;
+	--ptr->size;
+	if (tail->count == 0)
+	{
+		Unlink_UnrolledLinkedListNode(ptr, tail);
+	}
+}
+
+//查找展开链表数据元素的位置(不存在时返回"-1")
+size_t Search_UnrolledLinkedList(ULList* ptr, ULLDataType data)
+{
+	assert(ptr);
+	size_t base = 0;
+	ULLNode* cur = ptr->head;
+	while (cur != NULL)
+	{
+		for (size_t i = 0; i < cur->count; ++i)
+		{
+			if (cur->data[i] == data)
+			{
+				return base + i;
+			}
+		}
+		base += cur->count;
+		cur = cur->next;
+	}
+	return (size_t)-1;
+}
+
+//获取展开链表任意位置的数据元素
+ULLDataType Get_UnrolledLinkedList(ULList* ptr, size_t pos)
+{
+	assert(ptr);
+	assert(pos < ptr->size);
+	size_t offset = 0;
+	ULLNode* cur = Locate_UnrolledLinkedList(ptr, pos, &offset);
+	return cur->data[offset];
+}
+
+//在展开链表的任意位置插入数据元素
+void Insert_UnrolledLinkedList(ULList* ptr, size_t pos, ULLDataType data)
+{
+	assert(ptr);
+	assert(pos <= ptr->size);
+	if (pos == ptr->size)
+	{
+		Tail_Insert_UnrolledLinkedList(ptr, data);
+		return;
+	}
+	size_t offset = 0;
+	ULLNode* cur = Locate_UnrolledLinkedList(ptr, pos, &offset);
+	//节点已满时分裂为两个半满节点
+	if (cur->count == ULL_NODE_CAPACITY)
+	{
+		ULLNode* newNode = Link_UnrolledLinkedListNode(ptr, cur);
+		size_t half = ULL_NODE_CAPACITY / 2;
+		newNode->count = ULL_NODE_CAPACITY - half;
+		memcpy(newNode->data, cur->data + half, sizeof(ULLDataType) * newNode->count);
+		cur->count = half;
+		if (offset > half)
+		{
+			offset -= half;
+			cur = newNode;
+		}
+	}
+	memmove(cur->data + offset + 1, cur->data + offset, sizeof(ULLDataType) * (cur->count - offset));
+	cur->data[offset] = data;
+	++cur->count;
+	++ptr->size;
+}
+
+//删除展开链表任意位置的数据元素
+void Delete_UnrolledLinkedList(ULList* ptr, size_t pos)
+{
+	assert(ptr);
+	assert(pos < ptr->size);
+	size_t offset = 0;
+	ULLNode* cur = Locate_UnrolledLinkedList(ptr, pos, &offset);
+	--cur->count;
+	--ptr->size;
+	memmove(cur->data + offset, cur->data + offset + 1, sizeof(ULLDataType) * (cur->count - offset));
+	if (cur->count == 0)
+	{
+		Unlink_UnrolledLinkedListNode(ptr, cur);
+		return;
+	}
+	//节点元素个数少于一半时，与后继节点合并或从后继节点借用元素
+	ULLNode* next = cur->next;
+	if (cur->count < ULL_NODE_CAPACITY / 2 && next != NULL)
+	{
+		if (cur->count + next->count <= ULL_NODE_CAPACITY)
+		{
+			memcpy(cur->data + cur->count, next->data, sizeof(ULLDataType) * next->count);
+			cur->count += next->count;
+			Unlink_UnrolledLinkedListNode(ptr, next);
+		}
+		else
+		{
+			size_t move = ULL_NODE_CAPACITY / 2 - cur->count;
+			memcpy(cur->data + cur->count, next->data, sizeof(ULLDataType) * move);
+			memmove(next->data, next->data + move, sizeof(ULLDataType) * (next->count - move));
+			cur->count += move;
+			next->count -= move;
+		}
+	}
+}
+
+//判断展开链表是否为空表
+bool Empty_UnrolledLinkedList(ULList* ptr)
+{
+	assert(ptr);
+	return ptr->size == 0;
+}
+
+//获取展开链表的长度
+size_t Length_UnrolledLinkedList(ULList* ptr)
+{
+	assert(ptr);
+	return ptr->size;
+}
+
+//销毁展开链表
+void Destroy_UnrolledLinkedList(ULList* ptr)
+{
+	assert(ptr);
+	ULLNode* cur = ptr->head;
+	while (cur != NULL)
+	{
+		ULLNode* next = cur->next;
+		free(cur);
+		cur = next;
+	}
+	ptr->head = NULL;
+	ptr->tail = NULL;
+	ptr->size = 0;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+//引用头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+
+/*
+ * 展开链表(Unrolled Linked List)
+ * 1. 每个节点保存一个最多容纳"ULL_NODE_CAPACITY"个数据元素的数组，节点之间以双向指针相连，并记录首尾节点与元素个数。
+ * 2. 与每个节点只保存一个元素的单链表、双向链表相比，指针与"malloc"的额外开销被"ULL_NODE_CAPACITY"个元素分摊，遍历时大部分访问为连续内存访问。
+ * 3. 节点满时分裂为两个半满节点；删除后节点元素个数少于一半时，与后继节点合并或从后继节点借用元素。
+ * 4. 头插、尾插、头删、尾删的时间复杂度为：O(K)，任意位置插入、删除、查找的时间复杂度为：O(N / K + K)，其中"K"为"ULL_NODE_CAPACITY"。
+ * 5. "ULL_NODE_CAPACITY"取"58"时，64位平台上每个节点恰好为"256"字节(4个缓存行)。
+ * 6. 位置均从"0"开始计数。
+ */
+
+//定义标识符
+#define ULL_NODE_CAPACITY 58
+
+//重命名展开链表数据元素类型
+typedef int ULLDataType;
+
+//定义结构体类型(展开链表节点)
+typedef struct UnrolledLinkedListNode
+{
+	struct UnrolledLinkedListNode* prev;
+	struct UnrolledLinkedListNode* next;
+	size_t count;
+	ULLDataType data[ULL_NODE_CAPACITY];
+} ULLNode;
+
+//定义结构体类型(展开链表)
+typedef struct UnrolledLinkedList
+{
+	ULLNode* head;
+	ULLNode* tail;
+	size_t size;
+} ULList;
+
+//初始化展开链表
+void Init_UnrolledLinkedList(ULList* ptr);
+
+//创建一个展开链表节点
+ULLNode* Create_UnrolledLinkedListNode();
+
+//打印展开链表
+void Print_UnrolledLinkedList(ULList* ptr);
+
+//在展开链表的首位置插入数据元素(头插)
+void Head_Insert_UnrolledLinkedList(ULList* ptr, ULLDataType data);
+
+//在展开链表的末位置插入数据元素(尾插)
+void Tail_Insert_UnrolledLinkedList(ULList* ptr, ULLDataType data);
+
+//删除展开链表的首位置数据元素(头删)
+void Head_Delete_UnrolledLinkedList(ULList* ptr);
+
+//删除展开链表的末位置数据元素(尾删)
+void Tail_Delete_UnrolledLinkedList(ULList* ptr);
+
+//查找展开链表数据元素的位置(不存在时返回"-1")
+size_t Search_UnrolledLinkedList(ULList* ptr, ULLDataType data);
+
+//获取展开链表任意位置的数据元素
+ULLDataType Get_UnrolledLinkedList(ULList* ptr, size_t pos);
+
+//在展开链表的任意位置插入数据元素
+void Insert_UnrolledLinkedList(ULList* ptr, size_t pos, ULLDataType data);
+
+//删除展开链表任意位置的数据元素
+void Delete_UnrolledLinkedList(ULList* ptr, size_t pos);
+
+//判断展开链表是否为空表
+bool Empty_UnrolledLinkedList(ULList* ptr);
+
+//获取展开链表的长度
+size_t Length_UnrolledLinkedList(ULList* ptr);
+
+//销毁展开链表
+void Destroy_UnrolledLinkedList(ULList* ptr);
\ No newline at end of file
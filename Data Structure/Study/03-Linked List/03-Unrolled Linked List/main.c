@@ -0,0 +1,154 @@
+#include "Unrolled Linked List.h"
+
+//引用单链表与双向链表头文件(以比较性能)
+#include "../01-Singly Linked List/Singly Linked List.h"
+#include "../02-Doubly Linked List/Doubly Linked List.h"
+
+#include <time.h>
+
+//基准测试的最大元素个数(100000000个元素时，单链表与双向链表分别需要约1.6GB与3.2GB内存)
+#define BENCH_MAX_SIZE 10000000
+
+//计算两个时刻之间的耗时(单位：毫秒)
+static double Elapsed(clock_t begin, clock_t end)
+{
+	return (double)(end - begin) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void Test_UnrolledLinkedList_01()
+{
+	printf("******************************01******************************\n");
+	ULList list;
+	Init_UnrolledLinkedList(&list);
+
+	for (int i = 0; i < 5; ++i)
+	{
+		Tail_Insert_UnrolledLinkedList(&list, i);
+	}
+	Print_UnrolledLinkedList(&list);
+	for (int i = -1; i >= -5; --i)
+	{
+		Head_Insert_UnrolledLinkedList(&list, i);
+	}
+	Print_UnrolledLinkedList(&list);
+	printf("Unrolled Linked List Length = %zu\n", Length_UnrolledLinkedList(&list));
+
+	Head_Delete_UnrolledLinkedList(&list);
+	Tail_Delete_UnrolledLinkedList(&list);
+	Print_UnrolledLinkedList(&list);
+	printf("Search 0 -> %zu\n", Search_UnrolledLinkedList(&list, 0));
+	printf("Search 9 -> %d\n", (int)Search_UnrolledLinkedList(&list, 9));
+
+	Destroy_UnrolledLinkedList(&list);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_UnrolledLinkedList_02()
+{
+	printf("******************************02******************************\n");
+	ULList list;
+	Init_UnrolledLinkedList(&list);
+
+	//以数组作为参照，随机插入、删除后逐个比较
+	enum { COUNT = 20000 };
+	static ULLDataType arr[COUNT];
+	size_t size = 0;
+	bool good = true;
+	srand(0);
+	for (int i = 0; i < COUNT; ++i)
+	{
+		size_t pos = (size_t)rand() % (size + 1);
+		memmove(arr + pos + 1, arr + pos, sizeof(ULLDataType) * (size - pos));
+		arr[pos] = i;
+		++size;
+		Insert_UnrolledLinkedList(&list, pos, i);
+	}
+	for (int i = 0; i < COUNT / 2; ++i)
+	{
+		size_t pos = (size_t)rand() % size;
+		memmove(arr + pos, arr + pos + 1, sizeof(ULLDataType) * (size - pos - 1));
+		--size;
+		Delete_UnrolledLinkedList(&list, pos);
+	}
+	good = good && Length_UnrolledLinkedList(&list) == size;
+	for (size_t i = 0; i < size && good; ++i)
+	{
+		good = Get_UnrolledLinkedList(&list, i) == arr[i] && Search_UnrolledLinkedList(&list, arr[i]) == i;
+	}
+	size_t nodes = 0;
+	for (ULLNode* cur = list.head; cur != NULL; cur = cur->next)
+	{
+		++nodes;
+	}
+	printf("Size = %zu, Nodes = %zu, Load = %.1lf%%\n", size, nodes, 100.0 * (double)size / (double)(nodes * ULL_NODE_CAPACITY));
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+
+	while (!Empty_UnrolledLinkedList(&list))
+	{
+		rand() % 2 == 0 ? Head_Delete_UnrolledLinkedList(&list) : Tail_Delete_UnrolledLinkedList(&list);
+	}
+	printf("Head = %p, Tail = %p\n", (void*)list.head, (void*)list.tail);
+
+	Destroy_UnrolledLinkedList(&list);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_UnrolledLinkedList_03()
+{
+	printf("******************************03******************************\n");
+	printf("%-12s%-24s%-16s%-16s%-16s\n", "Size", "List", "Insert(ms)", "Scan(ms)", "Destroy(ms)");
+	for (size_t size = 1000000; size <= BENCH_MAX_SIZE; size *= 10)
+	{
+		//单链表(头插)
+		SLLNode* phead = NULL;
+		clock_t begin = clock();
+		for (size_t i = 0; i < size; ++i)
+		{
+			Head_Insert_SinglyLinkedListNode(&phead, (SLLDataType)i);
+		}
+		clock_t insert = clock();
+		SLLNode* found1 = Search_SinglyLinkedListNode(phead, -1);
+		clock_t scan = clock();
+		Destroy_SinglyLinkedList(&phead);
+		clock_t end = clock();
+		printf("%-12zu%-24s%-16.1lf%-16.1lf%-16.1lf%s\n", size, "Singly Linked List", Elapsed(begin, insert), Elapsed(insert, scan), Elapsed(scan, end), found1 == NULL ? "" : "Oops!");
+
+		//双向链表(尾插)
+		DLLNode* guard = Init_DoublyLinkedListNode();
+		begin = clock();
+		for (size_t i = 0; i < size; ++i)
+		{
+			Tail_Insert_DoublyLinkedListNode(guard, (DLLDataType)i);
+		}
+		insert = clock();
+		DLLNode* found2 = Search_DoublyLinkedListNode(guard, -1);
+		scan = clock();
+		Destroy_DoublyLinkedList(guard);
+		end = clock();
+		printf("%-12zu%-24s%-16.1lf%-16.1lf%-16.1lf%s\n", size, "Doubly Linked List", Elapsed(begin, insert), Elapsed(insert, scan), Elapsed(scan, end), found2 == NULL ? "" : "Oops!");
+
+		//展开链表(尾插)
+		ULList list;
+		Init_UnrolledLinkedList(&list);
+		begin = clock();
+		for (size_t i = 0; i < size; ++i)
+		{
+			Tail_Insert_UnrolledLinkedList(&list, (ULLDataType)i);
+		}
+		insert = clock();
+		size_t found3 = Search_UnrolledLinkedList(&list, -1);
+		scan = clock();
+		Destroy_UnrolledLinkedList(&list);
+		end = clock();
+		printf("%-12zu%-24s%-16.1lf%-16.1lf%-16.1lf%s\n", size, "Unrolled Linked List", Elapsed(begin, insert), Elapsed(insert, scan), Elapsed(scan, end), found3 == (size_t)-1 ? "" : "Oops!");
+	}
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_UnrolledLinkedList_01();
+	Test_UnrolledLinkedList_02();
+	Test_UnrolledLinkedList_03();
+	return 0;
+}
\ No newline at end of file
@@ -6,6 +6,16 @@ void Init_Deque(Deque* ptr)
 	assert(ptr);
 	ptr->size = 0;
 	ptr->head = ptr->tail = NULL;
+	ptr->pool = NULL;
+}
+
+//初始化双端队列(节点从内存池"pool"中申请)
+void Init_Pool_Deque(Deque* ptr, MemoryPool* pool)
+{
+	assert(ptr);
+	assert(pool == NULL || pool->blockSize >= sizeof(DequeNode));
+	Init_Deque(ptr);
+	ptr->pool = pool;
 }
 
 //创建一个双端队列节点
@@ -22,11 +32,30 @@ DequeNode* Create_DequeNode(DequeDataType data)
 	return newNode;
 }
 
+//为双端队列申请一个节点
+static DequeNode* Alloc_DequeNode(Deque* ptr, DequeDataType data)
+{
+	if (ptr->pool == NULL)
+	{
+		return Create_DequeNode(data);
+	}
+	DequeNode* newNode = (DequeNode*)Alloc_Pool(ptr->pool);
+	newNode->data = data;
+	newNode->prev = newNode->next = NULL;
+	return newNode;
+}
+
+//释放双端队列的一个节点
+static void Free_DequeNode(Deque* ptr, DequeNode* node)
+{
+	ptr->pool == NULL ? free(node) : Free_Pool(ptr->pool, node);
+}
+
 //向双端队列的首端插入元素
 void Push_Front_Deque(Deque* ptr, DequeDataType data)
 {
 	assert(ptr);
-	DequeNode* newNode = Create_DequeNode(data);
+	DequeNode* newNode = Alloc_DequeNode(ptr, data);
 	if (ptr->head == NULL)
 	{
 		ptr->head = ptr->tail = newNode;
@@ -44,7 +73,7 @@ void Push_Front_Deque(Deque* ptr, DequeDataType data)
 void Push_Back_Deque(Deque* ptr, DequeDataType data)
 {
 	assert(ptr);
-	DequeNode* newNode = Create_DequeNode(data);
+	DequeNode* newNode = Alloc_DequeNode(ptr, data);
 	if (ptr->head == NULL)
 	{
 		ptr->head = ptr->tail = newNode;
@@ -66,13 +95,13 @@ DequeDataType Pop_Front_Deque(Deque* ptr)
 	DequeDataType ans = ptr->head->data;
 	if (ptr->head->next == NULL)
 	{
-		free(ptr->head);
+		Free_DequeNode(ptr, ptr->head);
 		ptr->head = ptr->tail = NULL;
 	}
 	else
 	{
 		ptr->head = ptr->head->next;
-		free(ptr->head->prev);
+		Free_DequeNode(ptr, ptr->head->prev);
 		ptr->head->prev = NULL;
 	}
 	--ptr->size;
@@ -87,13 +116,13 @@ DequeDataType Pop_Back_Deque(Deque* ptr)
 	DequeDataType ans = ptr->tail->data;
 	if (ptr->tail->prev == NULL)
 	{
-		free(ptr->tail);
+		Free_DequeNode(ptr, ptr->tail);
 		ptr->head = ptr->tail = NULL;
 	}
 	else
 	{
 		ptr->tail = ptr->tail->prev;
-		free(ptr->tail->next);
+		Free_DequeNode(ptr, ptr->tail->next);
 		ptr->tail->next = NULL;
 	}
 	--ptr->size;
@@ -138,7 +167,7 @@ void Destroy_Queue(Deque* ptr)
 	while (cur != NULL)
 	{
 		DequeNode* next = cur->next;
-		free(cur);
+		Free_DequeNode(ptr, cur);
 		cur = next;
 	}
 }
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include <assert.h>
 #include <stdbool.h>
 
+//引用内存池头文件
+#include "../../07-Memory Pool/Memory Pool.h"
+
 //重命名双端队列数据元素类型
 typedef int DequeDataType;
 
@@ -23,11 +26,15 @@ typedef struct Deque
 	size_t size;
 	DequeNode* head;
 	DequeNode* tail;
+	MemoryPool* pool;
 } Deque;
 
 //初始化双端队列
 void Init_Deque(Deque* ptr);
 
+//初始化双端队列(节点从内存池"pool"中申请)
+void Init_Pool_Deque(Deque* ptr, MemoryPool* pool);
+
 //创建一个双端队列节点
 DequeNode* Create_DequeNode(DequeDataType data);
 
@@ -298,6 +298,50 @@ void Test_Deque_05()
 	printf("*****************************EXIT*****************************\n\n");
 }
 
+void Test_Deque_06()
+{
+	printf("******************************06******************************\n");
+	MemoryPool pool;
+	Init_Pool(&pool, sizeof(DequeNode), 0, false);
+	Deque deque01;
+	Deque deque02;
+	Init_Deque(&deque01);
+	Init_Pool_Deque(&deque02, &pool);
+
+	//两个双端队列执行相同的随机操作序列，分别统计耗时
+	int testTime = 20000000;
+	Deque* deque[2] = { &deque01, &deque02 };
+	clock_t time[2] = { 0 };
+	long long sum[2] = { 0 };
+	for (int round = 0; round < 2; ++round)
+	{
+		srand(0);
+		clock_t begin = clock();
+		for (int i = 0; i < testTime; ++i)
+		{
+			int decide = rand() % 4;
+			if (decide < 2 || Empty_Deque(deque[round]))
+			{
+				decide == 0 ? Push_Front_Deque(deque[round], i) : Push_Back_Deque(deque[round], i);
+			}
+			else
+			{
+				sum[round] += decide == 2 ? Pop_Front_Deque(deque[round]) : Pop_Back_Deque(deque[round]);
+			}
+		}
+		time[round] = clock() - begin;
+	}
+	bool good = sum[0] == sum[1] && Size_Deque(&deque01) == Size_Deque(&deque02) && Used_Pool(&pool) == Size_Deque(&deque02);
+	printf("malloc/free: %.1lfms\n", (double)time[0] * 1000.0 / CLOCKS_PER_SEC);
+	printf("Memory Pool: %.1lfms\n", (double)time[1] * 1000.0 / CLOCKS_PER_SEC);
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+
+	Destroy_Queue(&deque01);
+	Destroy_Queue(&deque02);
+	Destroy_Pool(&pool);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
 int main()
 {
 	Test_Deque_01();
@@ -305,5 +349,6 @@ int main()
 	Test_Deque_03();
 	//Test_Deque_04();
 	Test_Deque_05();
+	Test_Deque_06();
 	return 0;
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 //引用队列头文件
 #include "Queue/Queue.h"
 
+//引用栈头文件
+#include "Stack/Stack.h"
+
 //创建一个二叉树节点
 BTNode* Create_BinaryTreeNode(BTDataType data)
 {
@@ -18,43 +21,207 @@ BTNode* Create_BinaryTreeNode(BTDataType data)
 	return newNode;
 }
 
+//打印节点数据(供遍历函数调用)
+static void Print_Data(BTDataType data, void* arg)
+{
+	(void)arg;
+	printf("%d ", data);
+}
+
+//以先序(头左右)遍历二叉树(依次对每个节点的数据调用"Visit")
+void Preorder_Traversals_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg)
+{
+	if (root == NULL)
+	{
+		return;
+	}
+	Visit(root->data, arg);
+	Preorder_Traversals_Visit(root->left, Visit, arg);
+	Preorder_Traversals_Visit(root->right, Visit, arg);
+}
+
 //以先序(头左右)遍历二叉树
 void Preorder_Traversals(BTNode* root)
+{
+	Preorder_Traversals_Visit(root, Print_Data, NULL);
+}
+
+//以中序(左头右)遍历二叉树(依次对每个节点的数据调用"Visit")
+void Inorder_Traversals_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg)
 {
 	if (root == NULL)
 	{
 		return;
 	}
-	printf("%d ", root->data);
-	Preorder_Traversals(root->left);
-	Preorder_Traversals(root->right);
+	Inorder_Traversals_Visit(root->left, Visit, arg);
+	Visit(root->data, arg);
+	Inorder_Traversals_Visit(root->right, Visit, arg);
 }
 
 //以中序(左头右)遍历二叉树
 void Inorder_Traversals(BTNode* root)
+{
+	Inorder_Traversals_Visit(root, Print_Data, NULL);
+}
+
+//以后序(左右头)遍历二叉树(依次对每个节点的数据调用"Visit")
+void Postorder_Traversals_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg)
 {
 	if (root == NULL)
 	{
 		return;
 	}
-	Inorder_Traversals(root->left);
-	printf("%d ", root->data);
-	Inorder_Traversals(root->right);
+	Postorder_Traversals_Visit(root->left, Visit, arg);
+	Postorder_Traversals_Visit(root->right, Visit, arg);
+	Visit(root->data, arg);
 }
 
 //以后序(左右头)遍历二叉树
 void Postorder_Traversals(BTNode* root)
 {
-	if (root == NULL)
+	Postorder_Traversals_Visit(root, Print_Data, NULL);
+}
+
+//先序(头左右)遍历二叉树(非递归实现)(依次对每个节点的数据调用"Visit")
+void Preorder_Traversals_UnRecursive_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg)
+{
+	Stack help;
+	Init_Stack(&help);
+	BTNode* cur = root;
+	//访问当前节点后先压入右孩子，再处理左孩子
+	while (cur != NULL || !Empty_Stack(&help))
 	{
-		return;
+		if (cur == NULL)
+		{
+			cur = Pop_Stack(&help);
+		}
+		Visit(cur->data, arg);
+		if (cur->right != NULL)
+		{
+			Push_Stack(&help, cur->right);
+		}
+		cur = cur->left;
+	}
+	Destroy_Stack(&help);
+}
+
+//先序(头左右)遍历二叉树(非递归实现)
+void Preorder_Traversals_UnRecursive(BTNode* root)
+{
+	Preorder_Traversals_UnRecursive_Visit(root, Print_Data, NULL);
+	printf("\n");
+}
+
+//中序(左头右)遍历二叉树(非递归实现)(依次对每个节点的数据调用"Visit")
+void Inorder_Traversals_UnRecursive_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg)
+{
+	Stack help;
+	Init_Stack(&help);
+	BTNode* cur = root;
+	//沿左边界全部压栈，弹出时访问节点并转向右子树
+	while (cur != NULL || !Empty_Stack(&help))
+	{
+		if (cur != NULL)
+		{
+			Push_Stack(&help, cur);
+			cur = cur->left;
+		}
+		else
+		{
+			cur = Pop_Stack(&help);
+			Visit(cur->data, arg);
+			cur = cur->right;
+		}
+	}
+	Destroy_Stack(&help);
+}
+
+//中序(左头右)遍历二叉树(非递归实现)
+void Inorder_Traversals_UnRecursive(BTNode* root)
+{
+	Inorder_Traversals_UnRecursive_Visit(root, Print_Data, NULL);
+	printf("\n");
+}
+
+//后序(左右头)遍历二叉树(非递归实现)(依次对每个节点的数据调用"Visit")
+void Postorder_Traversals_UnRecursive_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg)
+{
+	Stack help;
+	Init_Stack(&help);
+	BTNode* cur = root;
+	BTNode* prev = NULL;
+	//栈顶节点的右子树为空或刚访问完毕时才访问栈顶节点
+	while (cur != NULL || !Empty_Stack(&help))
+	{
+		if (cur != NULL)
+		{
+			Push_Stack(&help, cur);
+			cur = cur->left;
+		}
+		else
+		{
+			BTNode* top = Top_Stack(&help);
+			if (top->right != NULL && top->right != prev)
+			{
+				cur = top->right;
+			}
+			else
+			{
+				Visit(top->data, arg);
+				prev = Pop_Stack(&help);
+			}
+		}
 	}
-	Postorder_Traversals(root->left);
-	Postorder_Traversals(root->right);
-	printf("%d ", root->data);
+	Destroy_Stack(&help);
+}
+
+//后序(左右头)遍历二叉树(非递归实现)
+void Postorder_Traversals_UnRecursive(BTNode* root)
+{
+	Postorder_Traversals_UnRecursive_Visit(root, Print_Data, NULL);
+	printf("\n");
 }
 
-//按层遍历二叉树(由队列实现)
+//中序(左头右)遍历二叉树(Morris遍历，额外空间复杂度为：O(1))(依次对每个节点的数据调用"Visit")
+void Inorder_Traversals_Morris_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg)
+{
+	BTNode* cur = root;
+	//利用左子树中最右节点的空右指针指回当前节点(线索)，第二次回到当前节点时恢复该指针
+	while (cur != NULL)
+	{
+		if (cur->left == NULL)
+		{
+			Visit(cur->data, arg);
+			cur = cur->right;
+			continue;
+		}
+		BTNode* mostRight = cur->left;
+		while (mostRight->right != NULL && mostRight->right != cur)
+		{
+			mostRight = mostRight->right;
+		}
+		if (mostRight->right == NULL)
+		{
+			mostRight->right = cur;
+			cur = cur->left;
+		}
+		else
+		{
+			mostRight->right = NULL;
+			Visit(cur->data, arg);
+			cur = cur->right;
+		}
+	}
+}
+
+//中序(左头右)遍历二叉树(Morris遍历，额外空间复杂度为：O(1))
+void Inorder_Traversals_Morris(BTNode* root)
+{
+	Inorder_Traversals_Morris_Visit(root, Print_Data, NULL);
+	printf("\n");
+}
+
+//按层遍历二叉树(由环形队列实现)
 void Level_Traversals(BTNode* root)
 {
 	if (root == NULL)
@@ -82,10 +249,37 @@ void Level_Traversals(BTNode* root)
 	Destroy_Queue(&help);
 }
 
-//获取二叉树的节点个数
+//获取二叉树的节点个数(Morris遍历)
 size_t Size_BinaryTree(BTNode* root)
 {
-	return root == NULL ? 0 : Size_BinaryTree(root->left) + Size_BinaryTree(root->right) + 1;
+	size_t size = 0;
+	BTNode* cur = root;
+	while (cur != NULL)
+	{
+		if (cur->left == NULL)
+		{
+			++size;
+			cur = cur->right;
+			continue;
+		}
+		BTNode* mostRight = cur->left;
+		while (mostRight->right != NULL && mostRight->right != cur)
+		{
+			mostRight = mostRight->right;
+		}
+		if (mostRight->right == NULL)
+		{
+			mostRight->right = cur;
+			cur = cur->left;
+		}
+		else
+		{
+			mostRight->right = NULL;
+			++size;
+			cur = cur->right;
+		}
+	}
+	return size;
 }
 
 //获取二叉树的叶子节点个数
@@ -95,11 +289,29 @@ size_t Size_Leaf_BinaryTree(BTNode* root)
 	{
 		return 0;
 	}
-	if (root->left == NULL && root->right == NULL)
+	Queue help;
+	Init_Queue(&help);
+	Push_Queue(&help, root);
+	size_t count = 0;
+	while (!Empty_Queue(&help))
 	{
-		return 1;
+		BTNode* cur = Front_Queue(&help);
+		Pop_Queue(&help);
+		if (cur->left == NULL && cur->right == NULL)
+		{
+			++count;
+		}
+		if (cur->left != NULL)
+		{
+			Push_Queue(&help, cur->left);
+		}
+		if (cur->right != NULL)
+		{
+			Push_Queue(&help, cur->right);
+		}
 	}
-	return Size_Leaf_BinaryTree(root->left) + Size_Leaf_BinaryTree(root->right);
+	Destroy_Queue(&help);
+	return count;
 }
 
 //获取二叉树度为一的节点个数
@@ -109,23 +321,62 @@ size_t Size_OneSpend_BinaryTree(BTNode* root)
 	{
 		return 0;
 	}
-	if ((root->left == NULL && root->right != NULL) || (root->left != NULL && root->right == NULL))
+	Queue help;
+	Init_Queue(&help);
+	Push_Queue(&help, root);
+	size_t count = 0;
+	while (!Empty_Queue(&help))
 	{
-		return Size_OneSpend_BinaryTree(root->left) + Size_OneSpend_BinaryTree(root->right) + 1;
+		BTNode* cur = Front_Queue(&help);
+		Pop_Queue(&help);
+		if ((cur->left == NULL) != (cur->right == NULL))
+		{
+			++count;
+		}
+		if (cur->left != NULL)
+		{
+			Push_Queue(&help, cur->left);
+		}
+		if (cur->right != NULL)
+		{
+			Push_Queue(&help, cur->right);
+		}
 	}
-	return Size_OneSpend_BinaryTree(root->left) + Size_OneSpend_BinaryTree(root->right);
+	Destroy_Queue(&help);
+	return count;
 }
 
-//获取二叉树的高度
+//获取二叉树的高度(按层遍历，每处理完一层高度加一)
 size_t Height_BinaryTree(BTNode* root)
 {
 	if (root == NULL)
 	{
 		return 0;
 	}
-	size_t leftHeight = Height_BinaryTree(root->left);
-	size_t rightHeight = Height_BinaryTree(root->right);
-	return leftHeight > rightHeight ? leftHeight + 1 : rightHeight + 1;
+	Queue help;
+	Init_Queue(&help);
+	Push_Queue(&help, root);
+	size_t height = 0;
+	while (!Empty_Queue(&help))
+	{
+		//队列中恰好是当前层的全部节点
+		for (size_t count = Size_Queue(&help); count > 0; --count)
+		{
+			BTNode* cur = Front_Queue(&help);
+			Pop_Queue(&help);
+			if (cur->left != NULL)
+			{
+				Push_Queue(&help, cur->left);
+			}
+			if (cur->right != NULL)
+			{
+				Push_Queue(&help, cur->right);
+			}
+		}
+		++height;
+	}
+	Destroy_Queue(&help);
+	return height;
 }
 
 //获取二叉树的最大宽度
@@ -138,28 +389,24 @@ size_t Max_Width_BinaryTree(BTNode* root)
 	Queue help;
 	Init_Queue(&help);
 	Push_Queue(&help, root);
-	size_t max = 0, curCount = 0;
-	BTNode* curEnd = root, * nextEnd = NULL;
+	size_t max = 0;
 	while (!Empty_Queue(&help))
 	{
-		BTNode* cur = Front_Queue(&help);
-		Pop_Queue(&help);
-		if (cur->left != NULL)
+		//队列中恰好是当前层的全部节点
+		size_t count = Size_Queue(&help);
+		max = count > max ? count : max;
+		for (; count > 0; --count)
 		{
-			Push_Queue(&help, cur->left);
-			nextEnd = cur->left;
-		}
-		if (cur->right != NULL)
-		{
-			Push_Queue(&help, cur->right);
-			nextEnd = cur->right;
-		}
-		++curCount;
-		if (cur == curEnd)
-		{
-			max = curCount > max ? curCount : max;
-			curCount = 0;
-			curEnd = nextEnd;
+			BTNode* cur = Front_Queue(&help);
+			Pop_Queue(&help);
+			if (cur->left != NULL)
+			{
+				Push_Queue(&help, cur->left);
+			}
+			if (cur->right != NULL)
+			{
+				Push_Queue(&help, cur->right);
+			}
 		}
 	}
 	Destroy_Queue(&help);
@@ -174,35 +421,55 @@ size_t K_Layer_BinaryTree(BTNode* root, size_t k)
 	{
 		return 0;
 	}
-	if (k == 1)
+	Queue help;
+	Init_Queue(&help);
+	Push_Queue(&help, root);
+	//逐层展开，展开"k - 1"层后队列中即为第"k"层的节点
+	for (size_t layer = 1; layer < k && !Empty_Queue(&help); ++layer)
 	{
-		return 1;
+		for (size_t count = Size_Queue(&help); count > 0; --count)
+		{
+			BTNode* cur = Front_Queue(&help);
+			Pop_Queue(&help);
+			if (cur->left != NULL)
+			{
+				Push_Queue(&help, cur->left);
+			}
+			if (cur->right != NULL)
+			{
+				Push_Queue(&help, cur->right);
+			}
+		}
 	}
-	return K_Layer_BinaryTree(root->left, k - 1) + K_Layer_BinaryTree(root->right, k - 1);
+	size_t count = Size_Queue(&help);
+	Destroy_Queue(&help);
+	return count;
 }
 
-//查找二叉树节点
+//查找二叉树节点(按先序(头左右)顺序查找)
 BTNode* Find_BinaryTree(BTNode* root, BTDataType data)
 {
-	if (root == NULL)
+	Stack help;
+	Init_Stack(&help);
+	BTNode* cur = root;
+	while (cur != NULL || !Empty_Stack(&help))
 	{
-		return NULL;
-	}
-	if (root->data == data)
-	{
-		return root;
-	}
-	BTNode* left = Find_BinaryTree(root->left, data);
-	if (left)
-	{
-		return left;
-	}
-	BTNode* right = Find_BinaryTree(root->right, data);
-	if (right)
-	{
-		return right;
+		if (cur == NULL)
+		{
+			cur = Pop_Stack(&help);
+		}
+		if (cur->data == data)
+		{
+			break;
+		}
+		if (cur->right != NULL)
+		{
+			Push_Stack(&help, cur->right);
+		}
+		cur = cur->left;
 	}
-	return NULL;
+	Destroy_Stack(&help);
+	return cur;
 }
 
 //判断二叉树是否为完全二叉树
@@ -214,7 +481,7 @@ bool Is_Complete_BinaryTree(BTNode* root)
 	}
 	Queue help;
 	Init_Queue(&help);
-	bool leaf = false;
+	bool leaf = false, complete = true;
 	BTNode* left = NULL, * right = NULL;
 	Push_Queue(&help, root);
 	while (!Empty_Queue(&help))
@@ -225,7 +492,8 @@ bool Is_Complete_BinaryTree(BTNode* root)
 		right = cur->right;
 		if ((leaf && (left != NULL || right != NULL)) || (left == NULL && right != NULL))
 		{
-			return false;
+			complete = false;
+			break;
 		}
 		if (left != NULL)
 		{
@@ -241,17 +509,27 @@ bool Is_Complete_BinaryTree(BTNode* root)
 		}
 	}
 	Destroy_Queue(&help);
-	return true;
+	return complete;
 }
 
-//销毁二叉树
+//销毁二叉树(不断右旋把左子树转到右侧，再沿右链逐个释放，额外空间复杂度为：O(1))
 void Destroy_BinaryTree(BTNode* root)
 {
-	if (root == NULL)
+	BTNode* cur = root;
+	while (cur != NULL)
 	{
-		return;
+		if (cur->left != NULL)
+		{
+			BTNode* left = cur->left;
+			cur->left = left->right;
+			left->right = cur;
+			cur = left;
+		}
+		else
+		{
+			BTNode* right = cur->right;
+			free(cur);
+			cur = right;
+		}
 	}
-	Destroy_BinaryTree(root->left);
-	Destroy_BinaryTree(root->right);
-	free(root);
 }
\ No newline at end of file
@@ -13,7 +13,7 @@
 //重命名二叉树数据元素类型
 typedef int BTDataType;
 
-//定义结构体类型(普通二叉树(除创建一个二叉树节点，其余都为递归实现))
+//定义结构体类型(普通二叉树(遍历提供递归与非递归两种实现，其余操作均为非递归实现，不会因树过深而栈溢出))
 typedef struct BinaryTreeNode
 {
 	BTDataType data;
@@ -27,13 +27,46 @@ BTNode* Create_BinaryTreeNode(BTDataType data);
 //先序(头左右)遍历二叉树
 void Preorder_Traversals(BTNode* root);
 
+//先序(头左右)遍历二叉树(依次对每个节点的数据调用"Visit")
+void Preorder_Traversals_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg);
+
 //中序(左头右)遍历二叉树
 void Inorder_Traversals(BTNode* root);
 
+//中序(左头右)遍历二叉树(依次对每个节点的数据调用"Visit")
+void Inorder_Traversals_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg);
+
 //后序(左右头)遍历二叉树
 void Postorder_Traversals(BTNode* root);
 
-//按层遍历二叉树(由队列实现)
+//后序(左右头)遍历二叉树(依次对每个节点的数据调用"Visit")
+void Postorder_Traversals_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg);
+
+//先序(头左右)遍历二叉树(非递归实现)
+void Preorder_Traversals_UnRecursive(BTNode* root);
+
+//先序(头左右)遍历二叉树(非递归实现)(依次对每个节点的数据调用"Visit")
+void Preorder_Traversals_UnRecursive_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg);
+
+//中序(左头右)遍历二叉树(非递归实现)
+void Inorder_Traversals_UnRecursive(BTNode* root);
+
+//中序(左头右)遍历二叉树(非递归实现)(依次对每个节点的数据调用"Visit")
+void Inorder_Traversals_UnRecursive_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg);
+
+//后序(左右头)遍历二叉树(非递归实现)
+void Postorder_Traversals_UnRecursive(BTNode* root);
+
+//后序(左右头)遍历二叉树(非递归实现)(依次对每个节点的数据调用"Visit")
+void Postorder_Traversals_UnRecursive_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg);
+
+//中序(左头右)遍历二叉树(Morris遍历，额外空间复杂度为：O(1))
+void Inorder_Traversals_Morris(BTNode* root);
+
+//中序(左头右)遍历二叉树(Morris遍历，额外空间复杂度为：O(1))(依次对每个节点的数据调用"Visit")
+void Inorder_Traversals_Morris_Visit(BTNode* root, void (*Visit)(BTDataType data, void* arg), void* arg);
+
+//按层遍历二叉树(由环形队列实现)
 void Level_Traversals(BTNode* root);
 
 //获取二叉树的节点个数
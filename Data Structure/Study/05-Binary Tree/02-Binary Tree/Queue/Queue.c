@@ -4,34 +4,43 @@
 void Init_Queue(Queue* ptr)
 {
 	assert(ptr);
-	ptr->head = ptr->tail = NULL;
-	ptr->size = 0;
+	ptr->array_ptr = ptr->buffer;
+	ptr->head = ptr->size = 0;
+	ptr->capacity = QUEUE_INLINE_SIZE;
 }
 
-//向队列尾部插入元素
-void Push_Queue(Queue* ptr, QueueDataType data)
+//将队列容量扩大为原来的两倍
+static void Grow_Queue(Queue* ptr)
 {
-	assert(ptr);
-	QueueNode* newNode = (QueueNode*)malloc(sizeof(QueueNode));
-	if (newNode == NULL)
+	size_t newCapacity = ptr->capacity * 2;
+	QueueDataType* tmp = (QueueDataType*)malloc(sizeof(QueueDataType) * newCapacity);
+	if (tmp == NULL)
 	{
-		perror("Push_Queue");
+		perror("Grow_Queue");
 		exit(EXIT_FAILURE);
 	}
-	else
-	{
-		newNode->data = data;
-		newNode->next = NULL;
-	}
-	if (ptr->head == NULL && ptr->tail == NULL)
+	//把回绕的两段按顺序复制到新数组的开头
+	size_t first = ptr->capacity - ptr->head < ptr->size ? ptr->capacity - ptr->head : ptr->size;
+	memcpy(tmp, ptr->array_ptr + ptr->head, sizeof(QueueDataType) * first);
+	memcpy(tmp + first, ptr->array_ptr, sizeof(QueueDataType) * (ptr->size - first));
+	if (ptr->array_ptr != ptr->buffer)
 	{
-		ptr->head = ptr->tail = newNode;
+		free(ptr->array_ptr);
 	}
-	else
+	ptr->array_ptr = tmp;
+	ptr->head = 0;
+	ptr->capacity = newCapacity;
+}
+
+//向队列尾部插入元素
+void Push_Queue(Queue* ptr, QueueDataType data)
+{
+	assert(ptr);
+	if (ptr->size == ptr->capacity)
 	{
-		ptr->tail->next = newNode;
-		ptr->tail = newNode;
+		Grow_Queue(ptr);
 	}
+	ptr->array_ptr[(ptr->head + ptr->size) & (ptr->capacity - 1)] = data;
 	++ptr->size;
 }
 
@@ -40,17 +49,7 @@ void Pop_Queue(Queue* ptr)
 {
 	assert(ptr);
 	assert(!Empty_Queue(ptr));
-	if (ptr->head->next == NULL)
-	{
-		free(ptr->head);
-		ptr->head = ptr->tail = NULL;
-	}
-	else
-	{
-		QueueNode* del = ptr->head;
-		ptr->head = ptr->head->next;
-		free(del);
-	}
+	ptr->head = (ptr->head + 1) & (ptr->capacity - 1);
 	--ptr->size;
 }
 
@@ -59,7 +58,7 @@ QueueDataType Front_Queue(Queue* ptr)
 {
 	assert(ptr);
 	assert(!Empty_Queue(ptr));
-	return ptr->head->data;
+	return ptr->array_ptr[ptr->head];
 }
 
 //获取队列的尾部元素数据
@@ -67,14 +66,14 @@ QueueDataType Back_Queue(Queue* ptr)
 {
 	assert(ptr);
 	assert(!Empty_Queue(ptr));
-	return ptr->tail->data;
+	return ptr->array_ptr[(ptr->head + ptr->size - 1) & (ptr->capacity - 1)];
 }
 
 //判断队列是否为空队列
 bool Empty_Queue(Queue* ptr)
 {
 	assert(ptr);
-	return ((ptr->head == NULL) && (ptr->tail == NULL));
+	return ptr->size == 0;
 }
 
 //获取队列中的元素个数
@@ -88,12 +87,9 @@ size_t Size_Queue(Queue* ptr)
 void Destroy_Queue(Queue* ptr)
 {
 	assert(ptr);
-	QueueNode* cur = ptr->head;
-	while (cur != NULL)
+	if (ptr->array_ptr != ptr->buffer)
 	{
-		QueueNode* del = cur;
-		cur = cur->next;
-		free(del);
+		free(ptr->array_ptr);
 	}
-	ptr->head = ptr->tail = NULL;
+	Init_Queue(ptr);
 }
\ No newline at end of file
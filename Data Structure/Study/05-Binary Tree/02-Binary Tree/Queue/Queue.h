@@ -3,22 +3,31 @@
 //引用二叉树头文件
 #include "../Binary Tree.h"
 
+//引用头文件
+#include <string.h>
+
+/*
+ * 队列(环形缓冲区实现，带内联缓冲区)
+ * 1. 元素保存在一段连续的环形数组中，容量为"2"的幂，下标以"& (capacity - 1)"回绕，入队、出队不申请节点。
+ * 2. 队列结构体内含一个可容纳"QUEUE_INLINE_SIZE"个元素的内联缓冲区，元素个数不超过该值时不申请堆内存(按层遍历时队列长度不超过二叉树相邻两层的宽度)。
+ * 3. 内联缓冲区用尽后改为在堆上申请连续数组，容量按两倍增长，入队、出队的均摊时间复杂度为：O(1)。
+ * 4. 使用内联缓冲区时数组指针指向队列结构体自身，因此初始化后不能按值复制或移动队列结构体。
+ */
+
+//定义标识符
+#define QUEUE_INLINE_SIZE 64
+
 //重命名队列数据元素类型
 typedef BTNode* QueueDataType;
 
-//定义结构体类型(队列节点(单链表节点))
-typedef struct QueueNode
-{
-	QueueDataType data;
-	struct QueueNode* next;
-} QueueNode;
-
-//定义结构体类型(双端链表实现队列)
+//定义结构体类型(环形缓冲区实现队列)
 typedef struct Queue
 {
+	QueueDataType* array_ptr;
+	size_t head;
 	size_t size;
-	QueueNode* head;
-	QueueNode* tail;
+	size_t capacity;
+	QueueDataType buffer[QUEUE_INLINE_SIZE];
 } Queue;
 
 //初始化队列
@@ -0,0 +1,88 @@
+#include "Stack.h"
+
+//初始化栈
+void Init_Stack(Stack* ptr)
+{
+	assert(ptr);
+	ptr->array_ptr = ptr->buffer;
+	ptr->top = 0;
+	ptr->capacity = STACK_INLINE_SIZE;
+}
+
+//保证栈至少还能容纳"count"个元素
+static void Reserve_Stack(Stack* ptr, size_t count)
+{
+	if (ptr->top + count <= ptr->capacity)
+	{
+		return;
+	}
+	size_t newCapacity = ptr->capacity * 2;
+	while (newCapacity < ptr->top + count)
+	{
+		newCapacity *= 2;
+	}
+	//第一次扩容时从内联缓冲区复制到堆上，之后使用"realloc"
+	StackDataType* tmp = ptr->array_ptr == ptr->buffer ?
+		(StackDataType*)malloc(sizeof(StackDataType) * newCapacity) :
+		(StackDataType*)realloc(ptr->array_ptr, sizeof(StackDataType) * newCapacity);
+	if (tmp == NULL)
+	{
+		perror("Reserve_Stack");
+		exit(EXIT_FAILURE);
+	}
+	if (ptr->array_ptr == ptr->buffer)
+	{
+		memcpy(tmp, ptr->buffer, sizeof(StackDataType) * ptr->top);
+	}
+	ptr->array_ptr = tmp;
+	ptr->capacity = newCapacity;
+}
+
+//将一个元素压入栈中
+void Push_Stack(Stack* ptr, StackDataType data)
+{
+	assert(ptr);
+	Reserve_Stack(ptr, 1);
+	ptr->array_ptr[ptr->top++] = data;
+}
+
+//将一个元素从栈中弹出
+StackDataType Pop_Stack(Stack* ptr)
+{
+	assert(ptr);
+	assert(!Empty_Stack(ptr));
+	return ptr->array_ptr[--ptr->top];
+}
+
+//获取栈的栈顶元素数据
+StackDataType Top_Stack(Stack* ptr)
+{
+	assert(ptr);
+	assert(!Empty_Stack(ptr));
+	return ptr->array_ptr[ptr->top - 1];
+}
+
+//判断栈是否为空栈
+bool Empty_Stack(Stack* ptr)
+{
+	assert(ptr);
+	return ptr->top == 0;
+}
+
+//获取栈中的元素个数
+size_t Size_Stack(Stack* ptr)
+{
+	assert(ptr);
+	return ptr->top;
+}
+
+//销毁栈
+void Destroy_Stack(Stack* ptr)
+{
+	assert(ptr);
+	if (ptr->array_ptr != ptr->buffer)
+	{
+		free(ptr->array_ptr);
+	}
+	Init_Stack(ptr);
+}
\ No newline at end of file
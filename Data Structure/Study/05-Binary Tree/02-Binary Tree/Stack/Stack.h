@@ -0,0 +1,50 @@
+#pragma once
+
+//引用二叉树头文件
+#include "../Binary Tree.h"
+
+//引用头文件
+#include <string.h>
+
+/*
+ * 栈(数组实现，带内联缓冲区)
+ * 1. 栈结构体内含一个可容纳"STACK_INLINE_SIZE"个元素的内联缓冲区，元素个数不超过该值时不申请堆内存(遍历时栈深度不超过二叉树的高度)。
+ * 2. 内联缓冲区用尽后改为在堆上申请连续数组，容量按两倍增长，压栈、弹栈的均摊时间复杂度为：O(1)。
+ * 3. 使用内联缓冲区时数组指针指向栈结构体自身，因此初始化后不能按值复制或移动栈结构体。
+ */
+
+//定义标识符
+#define STACK_INLINE_SIZE 64
+
+//重命名栈数据元素类型
+typedef BTNode* StackDataType;
+
+//定义结构体类型(数组实现栈)
+typedef struct Stack
+{
+	StackDataType* array_ptr;
+	size_t top;
+	size_t capacity;
+	StackDataType buffer[STACK_INLINE_SIZE];
+} Stack;
+
+//初始化栈
+void Init_Stack(Stack* ptr);
+
+//将一个元素压入栈中
+void Push_Stack(Stack* ptr, StackDataType data);
+
+//将一个元素从栈中弹出
+StackDataType Pop_Stack(Stack* ptr);
+
+//获取栈的栈顶元素数据
+StackDataType Top_Stack(Stack* ptr);
+
+//判断栈是否为空栈
+bool Empty_Stack(Stack* ptr);
+
+//获取栈中的元素个数
+size_t Size_Stack(Stack* ptr);
+
+//销毁栈
+void Destroy_Stack(Stack* ptr);
\ No newline at end of file
@@ -1,5 +1,10 @@
 #include "Binary Tree.h"
 
+//引用栈头文件(以使用"STACK_INLINE_SIZE")
+#include "Stack/Stack.h"
+
+#include <time.h>
+
 void Test_BinaryTree_01()
 {
 	printf("******************************01******************************\n");
@@ -93,9 +98,188 @@ void Test_BinaryTree_02()
 	printf("*****************************EXIT*****************************\n\n");
 }
 
+//构建退化为链表的二叉树("left"为真时每个节点只有左孩子，否则只有右孩子)
+static BTNode* Build_Chain(size_t size, bool left)
+{
+	BTNode* root = NULL;
+	for (size_t i = size; i > 0; --i)
+	{
+		BTNode* newNode = Create_BinaryTreeNode((BTDataType)i);
+		left ? (newNode->left = root) : (newNode->right = root);
+		root = newNode;
+	}
+	return root;
+}
+
+//定义结构体类型(按遍历顺序收集节点数据)
+typedef struct Collector
+{
+	BTDataType* data;
+	size_t size;
+} Collector;
+
+//收集节点数据
+static void Collect_Data(BTDataType data, void* arg)
+{
+	Collector* collector = (Collector*)arg;
+	collector->data[collector->size++] = data;
+}
+
+//比较递归与非递归遍历的结果("size"为节点个数)
+static bool Same_Traversals(BTNode* root, size_t size,
+	void (*Recursive)(BTNode*, void (*)(BTDataType, void*), void*),
+	void (*UnRecursive)(BTNode*, void (*)(BTDataType, void*), void*))
+{
+	BTDataType* expect = (BTDataType*)malloc(sizeof(BTDataType) * (size + 1));
+	BTDataType* actual = (BTDataType*)malloc(sizeof(BTDataType) * (size + 1));
+	if (expect == NULL || actual == NULL)
+	{
+		perror("Same_Traversals");
+		exit(EXIT_FAILURE);
+	}
+	Collector left = { expect, 0 }, right = { actual, 0 };
+	Recursive(root, Collect_Data, &left);
+	UnRecursive(root, Collect_Data, &right);
+	bool same = left.size == size && right.size == size;
+	for (size_t i = 0; same && i < size; ++i)
+	{
+		same = expect[i] == actual[i];
+	}
+	free(expect);
+	free(actual);
+	return same;
+}
+
+//比较一棵树的全部递归与非递归遍历(含Morris遍历)
+static bool Check_Traversals(BTNode* root, size_t size)
+{
+	bool ok = Same_Traversals(root, size, Preorder_Traversals_Visit, Preorder_Traversals_UnRecursive_Visit);
+	ok = Same_Traversals(root, size, Inorder_Traversals_Visit, Inorder_Traversals_UnRecursive_Visit) && ok;
+	ok = Same_Traversals(root, size, Postorder_Traversals_Visit, Postorder_Traversals_UnRecursive_Visit) && ok;
+	ok = Same_Traversals(root, size, Inorder_Traversals_Visit, Inorder_Traversals_Morris_Visit) && ok;
+	return ok;
+}
+
+void Test_BinaryTree_03()
+{
+	printf("******************************03******************************\n");
+	BTNode* root = Create_BinaryTreeNode(1);
+	root->left = Create_BinaryTreeNode(2);
+	root->right = Create_BinaryTreeNode(3);
+	root->left->left = Create_BinaryTreeNode(4);
+	root->left->right = Create_BinaryTreeNode(5);
+	root->right->left = Create_BinaryTreeNode(6);
+	root->right->right = Create_BinaryTreeNode(7);
+	root->left->left->right = Create_BinaryTreeNode(8);
+
+	Preorder_Traversals(root);
+	printf("\n");
+	Preorder_Traversals_UnRecursive(root);
+	Inorder_Traversals(root);
+	printf("\n");
+	Inorder_Traversals_UnRecursive(root);
+	Postorder_Traversals(root);
+	printf("\n");
+	Postorder_Traversals_UnRecursive(root);
+	Inorder_Traversals_Morris(root);
+	bool ok = Check_Traversals(root, 8);
+	Destroy_BinaryTree(root);
+
+	//只有左孩子的长链使中序、后序遍历的栈深度超过内联缓冲区，只有右孩子的长链使后序遍历的栈深度超过内联缓冲区
+	const size_t depth = 4 * STACK_INLINE_SIZE;
+	root = Build_Chain(depth, true);
+	ok = Check_Traversals(root, depth) && ok;
+	Destroy_BinaryTree(root);
+	root = Build_Chain(depth, false);
+	ok = Check_Traversals(root, depth) && ok;
+	Destroy_BinaryTree(root);
+	ok = Check_Traversals(NULL, 0) && ok;
+
+	printf("%s\n", ok ? "Good Luck!" : "Oops!");
+	root = NULL;
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+//计算两个时刻之间的耗时(单位：毫秒)
+static double Elapsed(clock_t begin, clock_t end)
+{
+	return (double)(end - begin) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+//构建完全二叉树(节点"i"的孩子为"2i + 1"与"2i + 2")
+static BTNode* Build_Complete(size_t size)
+{
+	if (size == 0)
+	{
+		return NULL;
+	}
+	BTNode** nodes = (BTNode**)malloc(sizeof(BTNode*) * size);
+	if (nodes == NULL)
+	{
+		perror("Build_Complete");
+		exit(EXIT_FAILURE);
+	}
+	for (size_t i = 0; i < size; ++i)
+	{
+		nodes[i] = Create_BinaryTreeNode((BTDataType)i);
+	}
+	for (size_t i = 0; 2 * i + 1 < size; ++i)
+	{
+		nodes[i]->left = nodes[2 * i + 1];
+		nodes[i]->right = 2 * i + 2 < size ? nodes[2 * i + 2] : NULL;
+	}
+	BTNode* root = nodes[0];
+	free(nodes);
+	return root;
+}
+
+//压力测试：对一棵树依次执行各项非递归操作并计时("last"为最后一层的节点个数)
+static bool Stress_BinaryTree(const char* name, BTNode* root, size_t size, size_t height, size_t width, size_t last, bool complete)
+{
+	clock_t t0 = clock();
+	bool ok = Size_BinaryTree(root) == size;
+	clock_t t1 = clock();
+	ok = Height_BinaryTree(root) == height && ok;
+	clock_t t2 = clock();
+	ok = Max_Width_BinaryTree(root) == width && ok;
+	clock_t t3 = clock();
+	ok = K_Layer_BinaryTree(root, height) == last && ok;
+	clock_t t4 = clock();
+	ok = Is_Complete_BinaryTree(root) == complete && ok;
+	clock_t t5 = clock();
+	ok = Find_BinaryTree(root, -1) == NULL && ok;
+	clock_t t6 = clock();
+	//Morris遍历结束后树的结构应恢复原状
+	ok = Size_BinaryTree(root) == size && Height_BinaryTree(root) == height && ok;
+	clock_t t7 = clock();
+	Destroy_BinaryTree(root);
+	clock_t t8 = clock();
+	printf("%-12s%-10.1lf%-10.1lf%-10.1lf%-10.1lf%-10.1lf%-10.1lf%-10.1lf%s\n", name,
+			Elapsed(t0, t1), Elapsed(t1, t2), Elapsed(t2, t3), Elapsed(t3, t4), Elapsed(t4, t5), Elapsed(t5, t6), Elapsed(t7, t8),
+			ok ? "Yes" : "No");
+	return ok;
+}
+
+void Test_BinaryTree_04()
+{
+	printf("******************************04******************************\n");
+	//1M个节点的退化树(深度为1M，递归实现会栈溢出)与完全二叉树，单位：毫秒
+	const size_t size = 1000000;
+	printf("%-12s%-10s%-10s%-10s%-10s%-10s%-10s%-10s%s\n", "Tree", "Size", "Height", "Width", "K_Layer", "Complete", "Find", "Destroy", "Correct");
+	bool ok = Stress_BinaryTree("Left", Build_Chain(size, true), size, size, 1, 1, false);
+	ok = Stress_BinaryTree("Right", Build_Chain(size, false), size, size, 1, 1, false) && ok;
+	//前"19"层是满的，第"20"层有"size - (2^19 - 1)"个节点，也是最宽的一层
+	size_t last = size - (((size_t)1 << 19) - 1);
+	ok = Stress_BinaryTree("Complete", Build_Complete(size), size, 20, last, last, true) && ok;
+	printf("%s\n", ok ? "Good Luck!" : "Oops!");
+	printf("*****************************EXIT*****************************\n\n");
+}
+
 int main()
 {
 	Test_BinaryTree_01();
 	Test_BinaryTree_02();
+	Test_BinaryTree_03();
+	Test_BinaryTree_04();
 	return 0;
 }
\ No newline at end of file
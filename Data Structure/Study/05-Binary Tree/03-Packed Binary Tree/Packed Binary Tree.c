@@ -0,0 +1,333 @@
+#include "Packed Binary Tree.h"
+
+//定义结构体类型(可增长的下标数组)
+typedef struct IndexArray
+{
+	uint32_t* data;
+	size_t size;
+	size_t capacity;
+} IndexArray;
+
+//向下标数组末尾追加一个下标
+static void Append_IndexArray(IndexArray* ptr, uint32_t index)
+{
+	if (ptr->size == ptr->capacity)
+	{
+		size_t newCapacity = ptr->capacity == 0 ? 64 : ptr->capacity * 2;
+		uint32_t* tmp = (uint32_t*)realloc(ptr->data, sizeof(uint32_t) * newCapacity);
+		if (tmp == NULL)
+		{
+			perror("Append_IndexArray");
+			exit(EXIT_FAILURE);
+		}
+		ptr->data = tmp;
+		ptr->capacity = newCapacity;
+	}
+	ptr->data[ptr->size++] = index;
+}
+
+//按层排布：以数组本身作为队列，孩子的下标即为其入队位置
+static void Build_BFS(PBTree* ptr, BTNode* root)
+{
+	size_t capacity = 1024;
+	BTNode** queue = (BTNode**)malloc(sizeof(BTNode*) * capacity);
+	PackedNode* nodes = (PackedNode*)malloc(sizeof(PackedNode) * capacity);
+	if (queue == NULL || nodes == NULL)
+	{
+		perror("Build_BFS");
+		exit(EXIT_FAILURE);
+	}
+	size_t size = 1, levelEnd = 1;
+	queue[0] = root;
+	ptr->height = 0;
+	for (size_t i = 0; i < size; ++i)
+	{
+		if (size + 2 > capacity)
+		{
+			capacity *= 2;
+			BTNode** newQueue = (BTNode**)realloc(queue, sizeof(BTNode*) * capacity);
+			PackedNode* newNodes = (PackedNode*)realloc(nodes, sizeof(PackedNode) * capacity);
+			if (newQueue == NULL || newNodes == NULL)
+			{
+				perror("Build_BFS");
+				exit(EXIT_FAILURE);
+			}
+			queue = newQueue;
+			nodes = newNodes;
+		}
+		assert(size + 2 < PACKED_NIL);
+		BTNode* cur = queue[i];
+		nodes[i].data = cur->data;
+		nodes[i].left = nodes[i].right = PACKED_NIL;
+		if (cur->left != NULL)
+		{
+			nodes[i].left = (uint32_t)size;
+			queue[size++] = cur->left;
+		}
+		if (cur->right != NULL)
+		{
+			nodes[i].right = (uint32_t)size;
+			queue[size++] = cur->right;
+		}
+		//当前层的最后一个节点出队时，下一层已全部入队
+		if (i + 1 == levelEnd)
+		{
+			++ptr->height;
+			levelEnd = size;
+		}
+	}
+	free(queue);
+	ptr->nodes = nodes;
+	ptr->size = size;
+}
+
+//van Emde Boas排布：将以"root"为根、只保留"levels"层的子树按顺序写入"order"
+static void Layout_VEB(const PackedNode* nodes, uint32_t root, size_t levels, IndexArray* order, IndexArray* scratch)
+{
+	if (levels == 1)
+	{
+		Append_IndexArray(order, root);
+		return;
+	}
+	size_t top = levels / 2;
+	Layout_VEB(nodes, root, top, order, scratch);
+	//逐层展开得到第"top"层(底部子树的根)，从左到右依次排布底部子树
+	size_t mark = scratch->size;
+	Append_IndexArray(scratch, root);
+	size_t begin = mark, end = scratch->size;
+	for (size_t level = 0; level < top && begin < end; ++level)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			uint32_t cur = scratch->data[i];
+			if (nodes[cur].left != PACKED_NIL)
+			{
+				Append_IndexArray(scratch, nodes[cur].left);
+			}
+			if (nodes[cur].right != PACKED_NIL)
+			{
+				Append_IndexArray(scratch, nodes[cur].right);
+			}
+		}
+		begin = end;
+		end = scratch->size;
+	}
+	for (size_t i = begin; i < end; ++i)
+	{
+		Layout_VEB(nodes, scratch->data[i], levels - top, order, scratch);
+	}
+	scratch->size = mark;
+}
+
+//由按层排布重新排布为van Emde Boas排布
+static void Build_VEB(PBTree* ptr)
+{
+	IndexArray order = { NULL, 0, 0 };
+	IndexArray scratch = { NULL, 0, 0 };
+	Layout_VEB(ptr->nodes, 0, ptr->height, &order, &scratch);
+	assert(order.size == ptr->size);
+	//"position[i]"为按层排布中第"i"个节点的新下标
+	uint32_t* position = (uint32_t*)malloc(sizeof(uint32_t) * ptr->size);
+	PackedNode* nodes = (PackedNode*)malloc(sizeof(PackedNode) * ptr->size);
+	if (position == NULL || nodes == NULL)
+	{
+		perror("Build_VEB");
+		exit(EXIT_FAILURE);
+	}
+	for (size_t i = 0; i < order.size; ++i)
+	{
+		position[order.data[i]] = (uint32_t)i;
+	}
+	for (size_t i = 0; i < order.size; ++i)
+	{
+		PackedNode node = ptr->nodes[order.data[i]];
+		node.left = node.left == PACKED_NIL ? PACKED_NIL : position[node.left];
+		node.right = node.right == PACKED_NIL ? PACKED_NIL : position[node.right];
+		nodes[i] = node;
+	}
+	free(ptr->nodes);
+	free(position);
+	free(order.data);
+	free(scratch.data);
+	ptr->nodes = nodes;
+}
+
+//由二叉树建立紧凑二叉树
+void Build_PackedBinaryTree(PBTree* ptr, BTNode* root, PackedLayout layout)
+{
+	assert(ptr);
+	ptr->nodes = NULL;
+	ptr->size = ptr->height = 0;
+	ptr->layout = layout;
+	if (root == NULL)
+	{
+		return;
+	}
+	Build_BFS(ptr, root);
+	if (layout == PACKED_VEB)
+	{
+		Build_VEB(ptr);
+	}
+}
+
+//先序(头左右)遍历紧凑二叉树(非递归实现)
+void Preorder_PackedBinaryTree(PBTree* ptr, void (*Visit)(BTDataType data, void* arg), void* arg)
+{
+	assert(ptr && Visit);
+	if (ptr->size == 0)
+	{
+		return;
+	}
+	//栈中保存尚未访问的右孩子，栈深度不超过树的高度
+	uint32_t* stack = (uint32_t*)malloc(sizeof(uint32_t) * ptr->height);
+	if (stack == NULL)
+	{
+		perror("Preorder_PackedBinaryTree");
+		exit(EXIT_FAILURE);
+	}
+	size_t top = 0;
+	uint32_t cur = 0;
+	while (cur != PACKED_NIL || top > 0)
+	{
+		if (cur == PACKED_NIL)
+		{
+			cur = stack[--top];
+		}
+		const PackedNode* node = &ptr->nodes[cur];
+		Visit(node->data, arg);
+		if (node->right != PACKED_NIL)
+		{
+			stack[top++] = node->right;
+		}
+		cur = node->left;
+	}
+	free(stack);
+}
+
+//中序(左头右)遍历紧凑二叉树(非递归实现)
+void Inorder_PackedBinaryTree(PBTree* ptr, void (*Visit)(BTDataType data, void* arg), void* arg)
+{
+	assert(ptr && Visit);
+	if (ptr->size == 0)
+	{
+		return;
+	}
+	uint32_t* stack = (uint32_t*)malloc(sizeof(uint32_t) * ptr->height);
+	if (stack == NULL)
+	{
+		perror("Inorder_PackedBinaryTree");
+		exit(EXIT_FAILURE);
+	}
+	size_t top = 0;
+	uint32_t cur = 0;
+	while (cur != PACKED_NIL || top > 0)
+	{
+		if (cur != PACKED_NIL)
+		{
+			stack[top++] = cur;
+			cur = ptr->nodes[cur].left;
+		}
+		else
+		{
+			cur = stack[--top];
+			Visit(ptr->nodes[cur].data, arg);
+			cur = ptr->nodes[cur].right;
+		}
+	}
+	free(stack);
+}
+
+//获取紧凑二叉树的节点个数
+size_t Size_PackedBinaryTree(PBTree* ptr)
+{
+	assert(ptr);
+	return ptr->size;
+}
+
+//获取紧凑二叉树的叶子节点个数
+size_t Size_Leaf_PackedBinaryTree(PBTree* ptr)
+{
+	assert(ptr);
+	size_t count = 0;
+	for (size_t i = 0; i < ptr->size; ++i)
+	{
+		count += ptr->nodes[i].left == PACKED_NIL && ptr->nodes[i].right == PACKED_NIL;
+	}
+	return count;
+}
+
+//获取紧凑二叉树的高度
+size_t Height_PackedBinaryTree(PBTree* ptr)
+{
+	assert(ptr);
+	return ptr->height;
+}
+
+//获取紧凑二叉树第"k"层的节点个数
+size_t K_Layer_PackedBinaryTree(PBTree* ptr, size_t k)
+{
+	assert(ptr);
+	assert(k > 0);
+	if (k > ptr->height)
+	{
+		return 0;
+	}
+	//父节点总是排在孩子之前，顺序扫描一遍即可得到每个节点的层数
+	uint32_t* layer = (uint32_t*)malloc(sizeof(uint32_t) * ptr->size);
+	if (layer == NULL)
+	{
+		perror("K_Layer_PackedBinaryTree");
+		exit(EXIT_FAILURE);
+	}
+	size_t count = 0;
+	layer[0] = 1;
+	for (size_t i = 0; i < ptr->size; ++i)
+	{
+		count += layer[i] == k;
+		if (ptr->nodes[i].left != PACKED_NIL)
+		{
+			layer[ptr->nodes[i].left] = layer[i] + 1;
+		}
+		if (ptr->nodes[i].right != PACKED_NIL)
+		{
+			layer[ptr->nodes[i].right] = layer[i] + 1;
+		}
+	}
+	free(layer);
+	return count;
+}
+
+//查找紧凑二叉树节点(返回下标，不存在时返回"PACKED_NIL")
+uint32_t Find_PackedBinaryTree(PBTree* ptr, BTDataType data)
+{
+	assert(ptr);
+	for (size_t i = 0; i < ptr->size; ++i)
+	{
+		if (ptr->nodes[i].data == data)
+		{
+			return (uint32_t)i;
+		}
+	}
+	return PACKED_NIL;
+}
+
+//在作为二叉搜索树的紧凑二叉树中查找节点(返回下标，不存在时返回"PACKED_NIL")
+uint32_t Search_PackedBinaryTree(PBTree* ptr, BTDataType data)
+{
+	assert(ptr);
+	uint32_t cur = ptr->size == 0 ? PACKED_NIL : 0;
+	while (cur != PACKED_NIL && ptr->nodes[cur].data != data)
+	{
+		cur = data < ptr->nodes[cur].data ? ptr->nodes[cur].left : ptr->nodes[cur].right;
+	}
+	return cur;
+}
+
+//销毁紧凑二叉树
+void Destroy_PackedBinaryTree(PBTree* ptr)
+{
+	assert(ptr);
+	free(ptr->nodes);
+	ptr->nodes = NULL;
+	ptr->size = ptr->height = 0;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+//引用二叉树头文件
+#include "../02-Binary Tree/Binary Tree.h"
+
+//引用头文件
+#include <string.h>
+#include <stdint.h>
+
+/*
+ * 静态紧凑二叉树(Packed Binary Tree)
+ * 1. 将以"BTNode"指针相连的二叉树重新排布到一块连续数组中，孩子以"32"位下标表示(空孩子为"PACKED_NIL")，每个节点只占"12"字节。
+ * 2. 支持两种排布：按层(BFS/Eytzinger)排布，上层节点集中在数组开头；van Emde Boas排布，将高度为"h"的树分为高度约为"h/2"的顶部子树与若干底部子树并递归排布，
+ *    使任意一条自顶向下的路径只访问"O(logB(N))"个缓存行，与缓存行大小"B"无关(Cache-Oblivious)。
+ * 3. 两种排布中根节点的下标均为"0"，且父节点总是排在孩子之前，因此部分查询只需顺序扫描一遍数组。
+ * 4. 节点个数、高度为：O(1)，叶子节点个数、第"k"层节点个数、按值查找为：O(N)的顺序扫描，二叉搜索树查找为：O(h)，遍历均为非递归实现。
+ * 5. 建立后为只读结构，原二叉树修改后需要重新建立。
+ */
+
+//定义标识符
+#define PACKED_NIL UINT32_MAX
+
+//定义枚举类型(排布方式)
+typedef enum PackedLayout
+{
+	PACKED_BFS,
+	PACKED_VEB
+} PackedLayout;
+
+//定义结构体类型(紧凑二叉树节点)
+typedef struct PackedNode
+{
+	BTDataType data;
+	uint32_t left;
+	uint32_t right;
+} PackedNode;
+
+//定义结构体类型(紧凑二叉树)
+typedef struct PackedBinaryTree
+{
+	PackedNode* nodes;
+	size_t size;
+	size_t height;
+	PackedLayout layout;
+} PBTree;
+
+//由二叉树建立紧凑二叉树
+void Build_PackedBinaryTree(PBTree* ptr, BTNode* root, PackedLayout layout);
+
+//先序(头左右)遍历紧凑二叉树(非递归实现)
+void Preorder_PackedBinaryTree(PBTree* ptr, void (*Visit)(BTDataType data, void* arg), void* arg);
+
+//中序(左头右)遍历紧凑二叉树(非递归实现)
+void Inorder_PackedBinaryTree(PBTree* ptr, void (*Visit)(BTDataType data, void* arg), void* arg);
+
+//获取紧凑二叉树的节点个数
+size_t Size_PackedBinaryTree(PBTree* ptr);
+
+//获取紧凑二叉树的叶子节点个数
+size_t Size_Leaf_PackedBinaryTree(PBTree* ptr);
+
+//获取紧凑二叉树的高度
+size_t Height_PackedBinaryTree(PBTree* ptr);
+
+//获取紧凑二叉树第"k"层的节点个数
+size_t K_Layer_PackedBinaryTree(PBTree* ptr, size_t k);
+
+//查找紧凑二叉树节点(返回下标，不存在时返回"PACKED_NIL")
+uint32_t Find_PackedBinaryTree(PBTree* ptr, BTDataType data);
+
+//在作为二叉搜索树的紧凑二叉树中查找节点(返回下标，不存在时返回"PACKED_NIL")
+uint32_t Search_PackedBinaryTree(PBTree* ptr, BTDataType data);
+
+//销毁紧凑二叉树
+void Destroy_PackedBinaryTree(PBTree* ptr);
\ No newline at end of file
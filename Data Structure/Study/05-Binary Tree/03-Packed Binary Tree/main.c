@@ -0,0 +1,226 @@
+#include "Packed Binary Tree.h"
+
+#include <time.h>
+
+//定义标识符
+#define BENCH_SIZE 10000000
+#define BENCH_LOOKUPS 2000000
+
+//打印紧凑二叉树的数组
+static void Print_Packed(PBTree* ptr)
+{
+	for (size_t i = 0; i < ptr->size; ++i)
+	{
+		printf("[%zu]%d(", i, ptr->nodes[i].data);
+		ptr->nodes[i].left == PACKED_NIL ? printf("-,") : printf("%u,", ptr->nodes[i].left);
+		ptr->nodes[i].right == PACKED_NIL ? printf("-) ") : printf("%u) ", ptr->nodes[i].right);
+	}
+	printf("\n");
+}
+
+//访问函数：打印数据
+static void Visit_Print(BTDataType data, void* arg)
+{
+	printf("%d ", data);
+}
+
+//访问函数：累加校验和
+static void Visit_Sum(BTDataType data, void* arg)
+{
+	*(long long*)arg = *(long long*)arg * 31 + data;
+}
+
+//访问函数：检查是否为升序
+static void Visit_Sorted(BTDataType data, void* arg)
+{
+	BTDataType* last = (BTDataType*)arg;
+	last[1] = last[1] && last[0] <= data;
+	last[0] = data;
+}
+
+//先序遍历指针二叉树并累加校验和
+static void Preorder_Sum(BTNode* root, long long* sum)
+{
+	if (root == NULL)
+	{
+		return;
+	}
+	Visit_Sum(root->data, sum);
+	Preorder_Sum(root->left, sum);
+	Preorder_Sum(root->right, sum);
+}
+
+//在作为二叉搜索树的指针二叉树中查找节点
+static BTNode* Search_BinaryTree(BTNode* root, BTDataType data)
+{
+	while (root != NULL && root->data != data)
+	{
+		root = data < root->data ? root->left : root->right;
+	}
+	return root;
+}
+
+//计算两个时刻之间的耗时(单位：毫秒)
+static double Elapsed(clock_t begin, clock_t end)
+{
+	return (double)(end - begin) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void Test_PackedBinaryTree_01()
+{
+	printf("******************************01******************************\n");
+	BTNode* root = Create_BinaryTreeNode(1);
+	root->left = Create_BinaryTreeNode(2);
+	root->right = Create_BinaryTreeNode(3);
+	root->left->left = Create_BinaryTreeNode(4);
+	root->left->right = Create_BinaryTreeNode(5);
+	root->right->left = Create_BinaryTreeNode(6);
+	root->right->right = Create_BinaryTreeNode(7);
+	root->left->left->right = Create_BinaryTreeNode(8);
+	root->left->left->right->left = Create_BinaryTreeNode(9);
+
+	bool good = true;
+	for (int layout = PACKED_BFS; layout <= PACKED_VEB; ++layout)
+	{
+		PBTree tree;
+		Build_PackedBinaryTree(&tree, root, (PackedLayout)layout);
+		printf(layout == PACKED_BFS ? "BFS: " : "vEB: ");
+		Print_Packed(&tree);
+		Preorder_PackedBinaryTree(&tree, Visit_Print, NULL);
+		printf("\n");
+		Inorder_PackedBinaryTree(&tree, Visit_Print, NULL);
+		printf("\n");
+		printf("Size = %zu, Leaf = %zu, Height = %zu\n", Size_PackedBinaryTree(&tree), Size_Leaf_PackedBinaryTree(&tree), Height_PackedBinaryTree(&tree));
+		good = good && Size_PackedBinaryTree(&tree) == Size_BinaryTree(root);
+		good = good && Size_Leaf_PackedBinaryTree(&tree) == Size_Leaf_BinaryTree(root);
+		good = good && Height_PackedBinaryTree(&tree) == Height_BinaryTree(root);
+		for (size_t k = 1; k <= Height_BinaryTree(root) + 1; ++k)
+		{
+			good = good && K_Layer_PackedBinaryTree(&tree, k) == K_Layer_BinaryTree(root, k);
+		}
+		for (BTDataType data = 0; data <= 10; ++data)
+		{
+			uint32_t index = Find_PackedBinaryTree(&tree, data);
+			good = good && (index == PACKED_NIL) == (Find_BinaryTree(root, data) == NULL);
+			good = good && (index == PACKED_NIL || tree.nodes[index].data == data);
+		}
+		Destroy_PackedBinaryTree(&tree);
+	}
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+
+	Destroy_BinaryTree(root);
+	root = NULL;
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_PackedBinaryTree_02()
+{
+	printf("******************************02******************************\n");
+	//以随机顺序插入"0 ~ BENCH_SIZE - 1"建立二叉搜索树，节点在内存中的顺序与树的结构无关
+	BTDataType* order = (BTDataType*)malloc(sizeof(BTDataType) * BENCH_SIZE);
+	if (order == NULL)
+	{
+		perror("Test_PackedBinaryTree_02");
+		exit(EXIT_FAILURE);
+	}
+	srand(0);
+	for (size_t i = 0; i < BENCH_SIZE; ++i)
+	{
+		order[i] = (BTDataType)i;
+	}
+	for (size_t i = BENCH_SIZE - 1; i > 0; --i)
+	{
+		size_t j = ((size_t)rand() << 15 ^ (size_t)rand()) % (i + 1);
+		BTDataType temp = order[i];
+		order[i] = order[j];
+		order[j] = temp;
+	}
+	BTNode* root = NULL;
+	for (size_t i = 0; i < BENCH_SIZE; ++i)
+	{
+		BTNode** link = &root;
+		while (*link != NULL)
+		{
+			link = order[i] < (*link)->data ? &(*link)->left : &(*link)->right;
+		}
+		*link = Create_BinaryTreeNode(order[i]);
+	}
+	free(order);
+	//一半的查找命中
+	BTDataType* keys = (BTDataType*)malloc(sizeof(BTDataType) * BENCH_LOOKUPS);
+	if (keys == NULL)
+	{
+		perror("Test_PackedBinaryTree_02");
+		exit(EXIT_FAILURE);
+	}
+	for (size_t i = 0; i < BENCH_LOOKUPS; ++i)
+	{
+		keys[i] = (BTDataType)(((unsigned)rand() << 15 ^ (unsigned)rand()) % (2u * BENCH_SIZE));
+	}
+
+	PBTree bfs, veb;
+	clock_t begin = clock();
+	Build_PackedBinaryTree(&bfs, root, PACKED_BFS);
+	clock_t middle = clock();
+	Build_PackedBinaryTree(&veb, root, PACKED_VEB);
+	clock_t end = clock();
+	printf("Nodes = %zu, Height = %zu\n", Size_PackedBinaryTree(&bfs), Height_PackedBinaryTree(&bfs));
+	printf("Build BFS: %.1lfms, Build vEB: %.1lfms\n\n", Elapsed(begin, middle), Elapsed(middle, end));
+
+	printf("%-12s%-16s%-16s%-16s%-16s%s\n", "Layout", "Lookup(ms)", "Preorder(ms)", "Find(ms)", "Queries(ms)", "Hits");
+	//指针二叉树
+	size_t hits = 0;
+	long long sum = 0;
+	begin = clock();
+	for (size_t i = 0; i < BENCH_LOOKUPS; ++i)
+	{
+		hits += Search_BinaryTree(root, keys[i]) != NULL;
+	}
+	clock_t lookup = clock();
+	Preorder_Sum(root, &sum);
+	clock_t preorder = clock();
+	BTNode* found = Find_BinaryTree(root, -1);
+	clock_t find = clock();
+	size_t queries = Size_BinaryTree(root) + Size_Leaf_BinaryTree(root) + Height_BinaryTree(root) + K_Layer_BinaryTree(root, 20);
+	end = clock();
+	printf("%-12s%-16.1lf%-16.1lf%-16.1lf%-16.1lf%zu\n", "Pointer", Elapsed(begin, lookup), Elapsed(lookup, preorder), Elapsed(preorder, find), Elapsed(find, end), hits);
+
+	bool good = found == NULL;
+	PBTree* trees[2] = { &bfs, &veb };
+	for (size_t t = 0; t < 2; ++t)
+	{
+		size_t packedHits = 0;
+		long long packedSum = 0;
+		begin = clock();
+		for (size_t i = 0; i < BENCH_LOOKUPS; ++i)
+		{
+			packedHits += Search_PackedBinaryTree(trees[t], keys[i]) != PACKED_NIL;
+		}
+		lookup = clock();
+		Preorder_PackedBinaryTree(trees[t], Visit_Sum, &packedSum);
+		preorder = clock();
+		uint32_t index = Find_PackedBinaryTree(trees[t], -1);
+		find = clock();
+		size_t packedQueries = Size_PackedBinaryTree(trees[t]) + Size_Leaf_PackedBinaryTree(trees[t]) + Height_PackedBinaryTree(trees[t]) + K_Layer_PackedBinaryTree(trees[t], 20);
+		end = clock();
+		printf("%-12s%-16.1lf%-16.1lf%-16.1lf%-16.1lf%zu\n", t == 0 ? "BFS" : "vEB", Elapsed(begin, lookup), Elapsed(lookup, preorder), Elapsed(preorder, find), Elapsed(find, end), packedHits);
+		BTDataType last[2] = { -1, 1 };
+		Inorder_PackedBinaryTree(trees[t], Visit_Sorted, last);
+		good = good && packedHits == hits && packedSum == sum && index == PACKED_NIL && packedQueries == queries && last[1];
+	}
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+
+	free(keys);
+	Destroy_PackedBinaryTree(&bfs);
+	Destroy_PackedBinaryTree(&veb);
+	Destroy_BinaryTree(root);
+	root = NULL;
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_PackedBinaryTree_01();
+	Test_PackedBinaryTree_02();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,447 @@
+#include "Red Black Tree.h"
+
+//初始化红黑树
+void Init_RBTree(RBTree* ptr)
+{
+	assert(ptr);
+	ptr->root = NULL;
+	ptr->size = 0;
+	Init_Pool(&ptr->pool, sizeof(RBTNode), 0, false);
+}
+
+//判断节点是否为红色(空节点为黑色)
+static bool Is_Red(RBTNode* node)
+{
+	return node != NULL && node->color == RBT_RED;
+}
+
+//用"v"替换"u"在父节点中的位置
+static void Replace_RBTree(RBTree* ptr, RBTNode* u, RBTNode* v)
+{
+	if (u->parent == NULL)
+	{
+		ptr->root = v;
+	}
+	else if (u == u->parent->left)
+	{
+		u->parent->left = v;
+	}
+	else
+	{
+		u->parent->right = v;
+	}
+	if (v != NULL)
+	{
+		v->parent = u->parent;
+	}
+}
+
+//左旋
+static void Rotate_Left(RBTree* ptr, RBTNode* x)
+{
+	RBTNode* y = x->right;
+	x->right = y->left;
+	if (y->left != NULL)
+	{
+		y->left->parent = x;
+	}
+	Replace_RBTree(ptr, x, y);
+	y->left = x;
+	x->parent = y;
+}
+
+//右旋
+static void Rotate_Right(RBTree* ptr, RBTNode* x)
+{
+	RBTNode* y = x->left;
+	x->left = y->right;
+	if (y->right != NULL)
+	{
+		y->right->parent = x;
+	}
+	Replace_RBTree(ptr, x, y);
+	y->right = x;
+	x->parent = y;
+}
+
+//获取子树中键最小的节点
+static RBTNode* Minimum_RBTree(RBTNode* node)
+{
+	while (node->left != NULL)
+	{
+		node = node->left;
+	}
+	return node;
+}
+
+//获取子树中键最大的节点
+static RBTNode* Maximum_RBTree(RBTNode* node)
+{
+	while (node->right != NULL)
+	{
+		node = node->right;
+	}
+	return node;
+}
+
+//插入后的调整：消除连续的红色节点
+static void Insert_Fixup(RBTree* ptr, RBTNode* z)
+{
+	while (Is_Red(z->parent))
+	{
+		RBTNode* parent = z->parent;
+		RBTNode* grand = parent->parent;
+		if (parent == grand->left)
+		{
+			RBTNode* uncle = grand->right;
+			//叔叔为红色：父、叔变黑，祖父变红，继续向上调整
+			if (Is_Red(uncle))
+			{
+				parent->color = uncle->color = RBT_BLACK;
+				grand->color = RBT_RED;
+				z = grand;
+				continue;
+			}
+			//叔叔为黑色：先转为同侧，再旋转祖父
+			if (z == parent->right)
+			{
+				Rotate_Left(ptr, parent);
+				z = parent;
+				parent = z->parent;
+			}
+			parent->color = RBT_BLACK;
+			grand->color = RBT_RED;
+			Rotate_Right(ptr, grand);
+		}
+		else
+		{
+			RBTNode* uncle = grand->left;
+			if (Is_Red(uncle))
+			{
+				parent->color = uncle->color = RBT_BLACK;
+				grand->color = RBT_RED;
+				z = grand;
+				continue;
+			}
+			if (z == parent->left)
+			{
+				Rotate_Right(ptr, parent);
+				z = parent;
+				parent = z->parent;
+			}
+			parent->color = RBT_BLACK;
+			grand->color = RBT_RED;
+			Rotate_Left(ptr, grand);
+		}
+	}
+	ptr->root->color = RBT_BLACK;
+}
+
+//插入键值对(键已存在时更新值并返回"false")
+bool Insert_RBTree(RBTree* ptr, RBTKeyType key, RBTValueType value)
+{
+	assert(ptr);
+	RBTNode* parent = NULL;
+	RBTNode** link = &ptr->root;
+	while (*link != NULL)
+	{
+		parent = *link;
+		if (key < parent->key)
+		{
+			link = &parent->left;
+		}
+		else if (parent->key < key)
+		{
+			link = &parent->right;
+		}
+		else
+		{
+			parent->value = value;
+			return false;
+		}
+	}
+	RBTNode* newNode = (RBTNode*)Alloc_Pool(&ptr->pool);
+	newNode->key = key;
+	newNode->value = value;
+	newNode->color = RBT_RED;
+	newNode->parent = parent;
+	newNode->left = newNode->right = NULL;
+	*link = newNode;
+	++ptr->size;
+	Insert_Fixup(ptr, newNode);
+	return true;
+}
+
+//删除后的调整："x"所在的一侧少了一个黑色节点("x"可能为空，因此同时传入其父节点)
+static void Erase_Fixup(RBTree* ptr, RBTNode* x, RBTNode* parent)
+{
+	while (x != ptr->root && !Is_Red(x))
+	{
+		if (x == parent->left)
+		{
+			RBTNode* sibling = parent->right;
+			//兄弟为红色：转为兄弟为黑色的情况
+			if (Is_Red(sibling))
+			{
+				sibling->color = RBT_BLACK;
+				parent->color = RBT_RED;
+				Rotate_Left(ptr, parent);
+				sibling = parent->right;
+			}
+			//兄弟的孩子均为黑色：兄弟变红，缺少的黑色节点上移
+			if (!Is_Red(sibling->left) && !Is_Red(sibling->right))
+			{
+				sibling->color = RBT_RED;
+				x = parent;
+				parent = x->parent;
+				continue;
+			}
+			//兄弟的远侧孩子为黑色：先转为远侧孩子为红色的情况
+			if (!Is_Red(sibling->right))
+			{
+				sibling->left->color = RBT_BLACK;
+				sibling->color = RBT_RED;
+				Rotate_Right(ptr, sibling);
+				sibling = parent->right;
+			}
+			sibling->color = parent->color;
+			parent->color = RBT_BLACK;
+			sibling->right->color = RBT_BLACK;
+			Rotate_Left(ptr, parent);
+			x = ptr->root;
+		}
+		else
+		{
+			RBTNode* sibling = parent->left;
+			if (Is_Red(sibling))
+			{
+				sibling->color = RBT_BLACK;
+				parent->color = RBT_RED;
+				Rotate_Right(ptr, parent);
+				sibling = parent->left;
+			}
+			if (!Is_Red(sibling->left) && !Is_Red(sibling->right))
+			{
+				sibling->color = RBT_RED;
+				x = parent;
+				parent = x->parent;
+				continue;
+			}
+			if (!Is_Red(sibling->left))
+			{
+				sibling->right->color = RBT_BLACK;
+				sibling->color = RBT_RED;
+				Rotate_Left(ptr, sibling);
+				sibling = parent->left;
+			}
+			sibling->color = parent->color;
+			parent->color = RBT_BLACK;
+			sibling->left->color = RBT_BLACK;
+			Rotate_Right(ptr, parent);
+			x = ptr->root;
+		}
+	}
+	if (x != NULL)
+	{
+		x->color = RBT_BLACK;
+	}
+}
+
+//删除键(键不存在时返回"false")
+bool Erase_RBTree(RBTree* ptr, RBTKeyType key)
+{
+	assert(ptr);
+	RBTNode* z = Find_RBTree(ptr, key);
+	if (z == NULL)
+	{
+		return false;
+	}
+	RBTNode* x = NULL;
+	RBTNode* parent = NULL;
+	RBTColor removed = z->color;
+	if (z->left == NULL || z->right == NULL)
+	{
+		//至多一个孩子：用孩子替换"z"
+		x = z->left != NULL ? z->left : z->right;
+		parent = z->parent;
+		Replace_RBTree(ptr, z, x);
+	}
+	else
+	{
+		//两个孩子：用后继"y"替换"z"，实际被移走的是"y"原来的位置
+		RBTNode* y = Minimum_RBTree(z->right);
+		removed = y->color;
+		x = y->right;
+		if (y->parent == z)
+		{
+			parent = y;
+		}
+		else
+		{
+			parent = y->parent;
+			Replace_RBTree(ptr, y, y->right);
+			y->right = z->right;
+			y->right->parent = y;
+		}
+		Replace_RBTree(ptr, z, y);
+		y->left = z->left;
+		y->left->parent = y;
+		y->color = z->color;
+	}
+	Free_Pool(&ptr->pool, z);
+	--ptr->size;
+	if (removed == RBT_BLACK)
+	{
+		Erase_Fixup(ptr, x, parent);
+	}
+	return true;
+}
+
+//查找键所在的节点(不存在时返回"NULL")
+RBTNode* Find_RBTree(RBTree* ptr, RBTKeyType key)
+{
+	assert(ptr);
+	RBTNode* cur = ptr->root;
+	while (cur != NULL && cur->key != key)
+	{
+		cur = key < cur->key ? cur->left : cur->right;
+	}
+	return cur;
+}
+
+//查找第一个键不小于"key"的节点(不存在时返回"NULL")
+RBTNode* Lower_Bound_RBTree(RBTree* ptr, RBTKeyType key)
+{
+	assert(ptr);
+	RBTNode* cur = ptr->root;
+	RBTNode* ans = NULL;
+	while (cur != NULL)
+	{
+		if (cur->key < key)
+		{
+			cur = cur->right;
+		}
+		else
+		{
+			ans = cur;
+			cur = cur->left;
+		}
+	}
+	return ans;
+}
+
+//查找第一个键大于"key"的节点(不存在时返回"NULL")
+RBTNode* Upper_Bound_RBTree(RBTree* ptr, RBTKeyType key)
+{
+	assert(ptr);
+	RBTNode* cur = ptr->root;
+	RBTNode* ans = NULL;
+	while (cur != NULL)
+	{
+		if (key < cur->key)
+		{
+			ans = cur;
+			cur = cur->left;
+		}
+		else
+		{
+			cur = cur->right;
+		}
+	}
+	return ans;
+}
+
+//获取键最小的节点
+RBTNode* First_RBTree(RBTree* ptr)
+{
+	assert(ptr);
+	return ptr->root == NULL ? NULL : Minimum_RBTree(ptr->root);
+}
+
+//获取键最大的节点
+RBTNode* Last_RBTree(RBTree* ptr)
+{
+	assert(ptr);
+	return ptr->root == NULL ? NULL : Maximum_RBTree(ptr->root);
+}
+
+//获取中序遍历的下一个节点
+RBTNode* Next_RBTree(RBTNode* node)
+{
+	assert(node);
+	if (node->right != NULL)
+	{
+		return Minimum_RBTree(node->right);
+	}
+	while (node->parent != NULL && node == node->parent->right)
+	{
+		node = node->parent;
+	}
+	return node->parent;
+}
+
+//获取中序遍历的上一个节点
+RBTNode* Prev_RBTree(RBTNode* node)
+{
+	assert(node);
+	if (node->left != NULL)
+	{
+		return Maximum_RBTree(node->left);
+	}
+	while (node->parent != NULL && node == node->parent->left)
+	{
+		node = node->parent;
+	}
+	return node->parent;
+}
+
+//获取红黑树中的键值对个数
+size_t Size_RBTree(RBTree* ptr)
+{
+	assert(ptr);
+	return ptr->size;
+}
+
+//检查子树的性质(返回黑高，不满足时返回"0")
+static size_t Check_Process(RBTNode* node, RBTNode* parent, const RBTKeyType* low, const RBTKeyType* high)
+{
+	if (node == NULL)
+	{
+		return 1;
+	}
+	if (node->parent != parent || (low != NULL && !(*low < node->key)) || (high != NULL && !(node->key < *high)))
+	{
+		return 0;
+	}
+	if (Is_Red(node) && (Is_Red(node->left) || Is_Red(node->right)))
+	{
+		return 0;
+	}
+	size_t left = Check_Process(node->left, node, low, &node->key);
+	size_t right = Check_Process(node->right, node, &node->key, high);
+	if (left == 0 || left != right)
+	{
+		return 0;
+	}
+	return left + (node->color == RBT_BLACK);
+}
+
+//检查红黑树的性质(返回黑高，不满足时返回"0")
+size_t Check_RBTree(RBTree* ptr)
+{
+	assert(ptr);
+	if (Is_Red(ptr->root))
+	{
+		return 0;
+	}
+	return Check_Process(ptr->root, NULL, NULL, NULL);
+}
+
+//销毁红黑树
+void Destroy_RBTree(RBTree* ptr)
+{
+	assert(ptr);
+	Destroy_Pool(&ptr->pool);
+	ptr->root = NULL;
+	ptr->size = 0;
+}
\ No newline at end of file
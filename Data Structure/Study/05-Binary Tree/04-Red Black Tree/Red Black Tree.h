@@ -0,0 +1,88 @@
+#pragma once
+
+//引用头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+
+//引用内存池头文件
+#include "../../07-Memory Pool/Memory Pool.h"
+
+/*
+ * 红黑树(有序映射)
+ * 1. 每个节点为红色或黑色，根节点为黑色，红色节点的孩子均为黑色，从任一节点到其所有空孩子的路径上黑色节点个数相同。
+ * 2. 以上性质保证树高不超过"2 * log(N + 1)"，查找、插入、删除、"lower_bound"与"upper_bound"的时间复杂度均为：O(logN)。
+ * 3. 节点保存父节点指针，"First_RBTree/Next_RBTree/Prev_RBTree/Last_RBTree"按中序(键的升序)遍历，单步均摊时间复杂度为：O(1)。
+ * 4. 节点从红黑树自带的内存池中申请，销毁红黑树时整块释放。
+ * 5. 键唯一，插入已存在的键时只更新值。
+ */
+
+//重命名红黑树键与值的类型
+typedef int RBTKeyType;
+typedef int RBTValueType;
+
+//定义枚举类型(节点颜色)
+typedef enum RBTColor
+{
+	RBT_RED,
+	RBT_BLACK
+} RBTColor;
+
+//定义结构体类型(红黑树节点)
+typedef struct RedBlackTreeNode
+{
+	RBTKeyType key;
+	RBTValueType value;
+	RBTColor color;
+	struct RedBlackTreeNode* parent;
+	struct RedBlackTreeNode* left;
+	struct RedBlackTreeNode* right;
+} RBTNode;
+
+//定义结构体类型(红黑树)
+typedef struct RedBlackTree
+{
+	RBTNode* root;
+	size_t size;
+	MemoryPool pool;
+} RBTree;
+
+//初始化红黑树
+void Init_RBTree(RBTree* ptr);
+
+//插入键值对(键已存在时更新值并返回"false")
+bool Insert_RBTree(RBTree* ptr, RBTKeyType key, RBTValueType value);
+
+//删除键(键不存在时返回"false")
+bool Erase_RBTree(RBTree* ptr, RBTKeyType key);
+
+//查找键所在的节点(不存在时返回"NULL")
+RBTNode* Find_RBTree(RBTree* ptr, RBTKeyType key);
+
+//查找第一个键不小于"key"的节点(不存在时返回"NULL")
+RBTNode* Lower_Bound_RBTree(RBTree* ptr, RBTKeyType key);
+
+//查找第一个键大于"key"的节点(不存在时返回"NULL")
+RBTNode* Upper_Bound_RBTree(RBTree* ptr, RBTKeyType key);
+
+//获取键最小的节点
+RBTNode* First_RBTree(RBTree* ptr);
+
+//获取键最大的节点
+RBTNode* Last_RBTree(RBTree* ptr);
+
+//获取中序遍历的下一个节点
+RBTNode* Next_RBTree(RBTNode* node);
+
+//获取中序遍历的上一个节点
+RBTNode* Prev_RBTree(RBTNode* node);
+
+//获取红黑树中的键值对个数
+size_t Size_RBTree(RBTree* ptr);
+
+//检查红黑树的性质(返回黑高，不满足时返回"0")
+size_t Check_RBTree(RBTree* ptr);
+
+//销毁红黑树
+void Destroy_RBTree(RBTree* ptr);
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "Red Black Tree.h"
+
+#include <time.h>
+
+//打印红黑树(按中序)
+static void Print_RBTree(RBTree* ptr)
+{
+	for (RBTNode* cur = First_RBTree(ptr); cur != NULL; cur = Next_RBTree(cur))
+	{
+		printf("%d:%d%s ", cur->key, cur->value, cur->color == RBT_RED ? "(R)" : "");
+	}
+	printf("\n");
+}
+
+//计算两个时刻之间的耗时(单位：毫秒)
+static double Elapsed(clock_t begin, clock_t end)
+{
+	return (double)(end - begin) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void Test_RBTree_01()
+{
+	printf("******************************01******************************\n");
+	RBTree tree;
+	Init_RBTree(&tree);
+
+	for (int i = 1; i <= 10; ++i)
+	{
+		Insert_RBTree(&tree, i * 10, i);
+	}
+	Print_RBTree(&tree);
+	printf("Size = %zu, Black Height = %zu\n", Size_RBTree(&tree), Check_RBTree(&tree));
+	printf("Insert 50 again -> %s\n", Insert_RBTree(&tree, 50, 500) ? "True" : "False");
+	printf("Find 50 -> %d\n", Find_RBTree(&tree, 50)->value);
+	printf("Lower Bound 35 -> %d, Upper Bound 40 -> %d\n", Lower_Bound_RBTree(&tree, 35)->key, Upper_Bound_RBTree(&tree, 40)->key);
+	printf("Upper Bound 100 -> %p\n", (void*)Upper_Bound_RBTree(&tree, 100));
+
+	Erase_RBTree(&tree, 40);
+	Erase_RBTree(&tree, 10);
+	Erase_RBTree(&tree, 100);
+	printf("Erase 7 -> %s\n", Erase_RBTree(&tree, 7) ? "True" : "False");
+	Print_RBTree(&tree);
+	for (RBTNode* cur = Last_RBTree(&tree); cur != NULL; cur = Prev_RBTree(cur))
+	{
+		printf("%d ", cur->key);
+	}
+	printf("\n");
+	printf("Size = %zu, Black Height = %zu\n", Size_RBTree(&tree), Check_RBTree(&tree));
+
+	Destroy_RBTree(&tree);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_RBTree_02()
+{
+	printf("******************************02******************************\n");
+	RBTree tree;
+	Init_RBTree(&tree);
+
+	//以数组作为参照("value[key]"为"-1"表示不存在)，随机插入、删除后比较
+	enum { RANGE = 2000 };
+	static int value[RANGE];
+	for (int i = 0; i < RANGE; ++i)
+	{
+		value[i] = -1;
+	}
+	srand(0);
+	bool good = true;
+	size_t size = 0;
+	for (int i = 0; i < 200000 && good; ++i)
+	{
+		int key = rand() % RANGE;
+		if (rand() % 3 != 0)
+		{
+			good = good && Insert_RBTree(&tree, key, i) == (value[key] == -1);
+			size += value[key] == -1;
+			value[key] = i;
+		}
+		else
+		{
+			good = good && Erase_RBTree(&tree, key) == (value[key] != -1);
+			size -= value[key] != -1;
+			value[key] = -1;
+		}
+		if (i % 1000 == 0)
+		{
+			good = good && Check_RBTree(&tree) != 0 && Size_RBTree(&tree) == size;
+			int probe = rand() % (RANGE + 2) - 1;
+			RBTNode* lower = Lower_Bound_RBTree(&tree, probe);
+			RBTNode* upper = Upper_Bound_RBTree(&tree, probe);
+			int expectLower = probe < 0 ? 0 : probe, expectUpper = probe + 1;
+			while (expectLower < RANGE && value[expectLower] == -1)
+			{
+				++expectLower;
+			}
+			while (expectUpper < RANGE && value[expectUpper] == -1)
+			{
+				++expectUpper;
+			}
+			good = good && (lower == NULL ? expectLower >= RANGE : lower->key == expectLower);
+			good = good && (upper == NULL ? expectUpper >= RANGE : upper->key == expectUpper);
+		}
+	}
+	int key = -1;
+	for (RBTNode* cur = First_RBTree(&tree); cur != NULL && good; cur = Next_RBTree(cur))
+	{
+		while (value[++key] == -1)
+		{
+		}
+		good = cur->key == key && cur->value == value[key];
+	}
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+
+	Destroy_RBTree(&tree);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_RBTree_03()
+{
+	printf("******************************03******************************\n");
+	printf("%-12s%-16s%-16s%-16s%-16s\n", "Size", "Insert(ms)", "Find(ms)", "Iterate(ms)", "Erase(ms)");
+	for (size_t size = 1000000; size <= 10000000; size *= 10)
+	{
+		int* keys = (int*)malloc(sizeof(int) * size);
+		if (keys == NULL)
+		{
+			perror("Test_RBTree_03");
+			exit(EXIT_FAILURE);
+		}
+		srand(0);
+		for (size_t i = 0; i < size; ++i)
+		{
+			keys[i] = (int)((unsigned)rand() << 15 ^ (unsigned)rand());
+		}
+		RBTree tree;
+		Init_RBTree(&tree);
+		clock_t begin = clock();
+		for (size_t i = 0; i < size; ++i)
+		{
+			Insert_RBTree(&tree, keys[i], (int)i);
+		}
+		clock_t insert = clock();
+		size_t hits = 0;
+		for (size_t i = 0; i < size; ++i)
+		{
+			hits += Find_RBTree(&tree, keys[i]) != NULL;
+		}
+		clock_t find = clock();
+		long long sum = 0;
+		for (RBTNode* cur = First_RBTree(&tree); cur != NULL; cur = Next_RBTree(cur))
+		{
+			sum += cur->value;
+		}
+		clock_t iterate = clock();
+		for (size_t i = 0; i < size; ++i)
+		{
+			Erase_RBTree(&tree, keys[i]);
+		}
+		clock_t end = clock();
+		printf("%-12zu%-16.1lf%-16.1lf%-16.1lf%-16.1lf%s\n", size, Elapsed(begin, insert), Elapsed(insert, find), Elapsed(find, iterate), Elapsed(iterate, end),
+				hits == size && Size_RBTree(&tree) == 0 && sum >= 0 ? "" : "Oops!");
+		Destroy_RBTree(&tree);
+		free(keys);
+	}
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_RBTree_01();
+	Test_RBTree_02();
+	Test_RBTree_03();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,511 @@
+#include "External.h"
+
+//获取当前时间(单位：秒)
+double Now_External()
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//后台读取任务(按字节读取，以发现文件末尾不足一个元素的字节)
+static int Read_Task(void* arg)
+{
+	Transfer* task = (Transfer*)arg;
+	size_t bytes = fread(task->buffer, 1, sizeof(int) * task->count, task->file);
+	task->done = bytes / sizeof(int);
+	task->partial = bytes % sizeof(int) != 0;
+	task->failed = task->partial || (bytes < sizeof(int) * task->count && ferror(task->file));
+	return 0;
+}
+
+//打印读取失败的原因
+static void Report_Read(const char* name, FILE* file)
+{
+	fprintf(stderr, "%s: %s\n", name, ferror(file) ? "read error" : "file size is not a multiple of sizeof(int)");
+}
+
+//后台写入任务
+static int Write_Task(void* arg)
+{
+	Transfer* task = (Transfer*)arg;
+	task->done = fwrite(task->buffer, sizeof(int), task->count, task->file);
+	return 0;
+}
+
+//分配读写缓冲区
+static int* Alloc_Buffer(size_t capacity)
+{
+	int* buffer = (int*)malloc(sizeof(int) * capacity);
+	if (buffer == NULL)
+	{
+		perror("Alloc_Buffer");
+		exit(EXIT_FAILURE);
+	}
+	return buffer;
+}
+
+//在后台线程中将下一块数据读入空闲缓冲区(无法创建线程时直接读取)
+static void Start_Read(InputStream* ptr)
+{
+	ptr->task.buffer = ptr->buffer[1 - ptr->current];
+	ptr->task.count = ptr->capacity;
+	ptr->task.done = 0;
+	ptr->pending = thrd_create(&ptr->thread, Read_Task, &ptr->task) == thrd_success;
+	if (!ptr->pending)
+	{
+		Read_Task(&ptr->task);
+	}
+}
+
+//打开双缓冲输入流("capacity"为每个缓冲区的元素个数)
+bool Open_InputStream(InputStream* ptr, const char* path, size_t capacity)
+{
+	assert(ptr && path && capacity);
+	ptr->file = fopen(path, "rb");
+	if (ptr->file == NULL)
+	{
+		perror("Open_InputStream");
+		return false;
+	}
+	ptr->buffer[0] = Alloc_Buffer(capacity);
+	ptr->buffer[1] = Alloc_Buffer(capacity);
+	ptr->capacity = capacity;
+	ptr->current = 0;
+	ptr->pos = 0;
+	ptr->pending = false;
+	ptr->task.file = ptr->file;
+	ptr->task.buffer = ptr->buffer[0];
+	ptr->task.count = capacity;
+	Read_Task(&ptr->task);
+	ptr->size = ptr->task.done;
+	ptr->failed = ptr->task.failed;
+	if (ptr->size == capacity)
+	{
+		Start_Read(ptr);
+	}
+	return true;
+}
+
+//从输入流中读取一个元素，流结束或读取失败时返回"false"
+bool Read_InputStream(InputStream* ptr, int* value)
+{
+	assert(ptr && value);
+	if (ptr->pos == ptr->size)
+	{
+		//上一次读取未填满缓冲区，说明文件已读完或读取失败。
+		if (ptr->size < ptr->capacity)
+		{
+			return false;
+		}
+		if (ptr->pending)
+		{
+			thrd_join(ptr->thread, NULL);
+			ptr->pending = false;
+		}
+		ptr->current = 1 - ptr->current;
+		ptr->size = ptr->task.done;
+		ptr->pos = 0;
+		ptr->failed = ptr->failed || ptr->task.failed;
+		if (ptr->size == 0)
+		{
+			return false;
+		}
+		if (ptr->size == ptr->capacity)
+		{
+			Start_Read(ptr);
+		}
+	}
+	*value = ptr->buffer[ptr->current][ptr->pos++];
+	return true;
+}
+
+//关闭输入流，读取失败时返回"false"
+bool Close_InputStream(InputStream* ptr)
+{
+	assert(ptr);
+	if (ptr->pending)
+	{
+		thrd_join(ptr->thread, NULL);
+		ptr->pending = false;
+	}
+	if (ptr->failed)
+	{
+		Report_Read("Close_InputStream", ptr->file);
+	}
+	fclose(ptr->file);
+	free(ptr->buffer[0]);
+	free(ptr->buffer[1]);
+	ptr->file = NULL;
+	ptr->buffer[0] = ptr->buffer[1] = NULL;
+	return !ptr->failed;
+}
+
+//等待上一次后台写入完成，并检查写入结果
+static void Finish_Write(OutputStream* ptr)
+{
+	if (ptr->pending)
+	{
+		thrd_join(ptr->thread, NULL);
+		ptr->pending = false;
+	}
+	if (ptr->task.done != ptr->task.count)
+	{
+		ptr->failed = true;
+	}
+}
+
+//在后台线程中写出当前缓冲区，并切换到另一个缓冲区(无法创建线程时直接写入)
+static void Flush_OutputStream(OutputStream* ptr)
+{
+	Finish_Write(ptr);
+	ptr->task.buffer = ptr->buffer[ptr->current];
+	ptr->task.count = ptr->size;
+	ptr->task.done = 0;
+	ptr->pending = thrd_create(&ptr->thread, Write_Task, &ptr->task) == thrd_success;
+	if (!ptr->pending)
+	{
+		Write_Task(&ptr->task);
+		Finish_Write(ptr);
+	}
+	ptr->current = 1 - ptr->current;
+	ptr->size = 0;
+}
+
+//以"mode"方式打开双缓冲输出流
+static bool Open_Output(OutputStream* ptr, const char* path, size_t capacity, const char* mode)
+{
+	assert(ptr && path && capacity);
+	ptr->file = fopen(path, mode);
+	if (ptr->file == NULL)
+	{
+		perror("Open_OutputStream");
+		return false;
+	}
+	ptr->buffer[0] = Alloc_Buffer(capacity);
+	ptr->buffer[1] = Alloc_Buffer(capacity);
+	ptr->capacity = capacity;
+	ptr->size = 0;
+	ptr->current = 0;
+	ptr->pending = false;
+	ptr->failed = false;
+	ptr->task.file = ptr->file;
+	ptr->task.count = ptr->task.done = 0;
+	ptr->task.failed = ptr->task.partial = false;
+	return true;
+}
+
+//打开双缓冲输出流("capacity"为每个缓冲区的元素个数)
+bool Open_OutputStream(OutputStream* ptr, const char* path, size_t capacity)
+{
+	return Open_Output(ptr, path, capacity, "wb");
+}
+
+//向输出流中写入一个元素
+void Write_OutputStream(OutputStream* ptr, int value)
+{
+	assert(ptr);
+	ptr->buffer[ptr->current][ptr->size++] = value;
+	if (ptr->size == ptr->capacity)
+	{
+		Flush_OutputStream(ptr);
+	}
+}
+
+//关闭输出流，写入失败时返回"false"
+bool Close_OutputStream(OutputStream* ptr)
+{
+	assert(ptr);
+	if (ptr->size > 0)
+	{
+		Flush_OutputStream(ptr);
+	}
+	Finish_Write(ptr);
+	if (fclose(ptr->file) != 0)
+	{
+		ptr->failed = true;
+	}
+	free(ptr->buffer[0]);
+	free(ptr->buffer[1]);
+	ptr->file = NULL;
+	ptr->buffer[0] = ptr->buffer[1] = NULL;
+	if (ptr->failed)
+	{
+		perror("Close_OutputStream");
+	}
+	return !ptr->failed;
+}
+
+//进程内的排序序号(同一进程中同时进行的排序各不相同)
+static atomic_ulong External_Sequence = 0;
+
+//生成归并段临时文件的路径(包含进程号与排序序号)
+static void Run_Path(char* path, const char* tempDir, unsigned long id, size_t run)
+{
+	snprintf(path, EXTERNAL_MAX_PATH, "%s/External_%lu_%lu_%zu.tmp", tempDir == NULL ? "." : tempDir, (unsigned long)getpid(), id, run);
+}
+
+//删除编号为"[first, last)"的归并段临时文件
+static void Remove_Runs(const char* tempDir, unsigned long id, size_t first, size_t last)
+{
+	char path[EXTERNAL_MAX_PATH];
+	for (size_t i = first; i < last; ++i)
+	{
+		Run_Path(path, tempDir, id, i);
+		remove(path);
+	}
+}
+
+//生成归并段(读取下一块与排序、写出当前块同时进行)，返回归并段个数，失败时返回"(size_t)-1"
+static size_t Create_Runs(const char* input, size_t chunk, const char* tempDir, unsigned long id, size_t* count)
+{
+	FILE* in = fopen(input, "rb");
+	if (in == NULL)
+	{
+		perror("Create_Runs");
+		return (size_t)-1;
+	}
+	int* buffer[2] = { Alloc_Buffer(chunk), Alloc_Buffer(chunk) };
+	Transfer task = { in, buffer[0], chunk, 0, false, false };
+	Read_Task(&task);
+	char path[EXTERNAL_MAX_PATH];
+	size_t runs = 0;
+	int current = 0;
+	bool succeed = true;
+	*count = 0;
+	while (task.done > 0 && !task.failed)
+	{
+		size_t size = task.done;
+		thrd_t thread;
+		bool pending = false;
+		task.done = 0;
+		if (size == chunk)
+		{
+			task.buffer = buffer[1 - current];
+			pending = thrd_create(&thread, Read_Task, &task) == thrd_success;
+			if (!pending)
+			{
+				Read_Task(&task);
+			}
+		}
+		Intro_Sort(buffer[current], size);
+		Run_Path(path, tempDir, id, runs);
+		//独占创建：同名文件已存在时失败，而不是覆盖其他排序的归并段
+		FILE* run = fopen(path, "wbx");
+		if (run == NULL || fwrite(buffer[current], sizeof(int), size, run) != size)
+		{
+			perror("Create_Runs");
+			succeed = false;
+		}
+		if (run != NULL && fclose(run) != 0)
+		{
+			succeed = false;
+		}
+		if (pending)
+		{
+			thrd_join(thread, NULL);
+		}
+		if (run != NULL)
+		{
+			++runs;
+		}
+		if (!succeed)
+		{
+			break;
+		}
+		*count += size;
+		current = 1 - current;
+	}
+	//读取错误或末尾多出不足一个元素的字节时，不能把已读到的部分当作整个文件
+	if (succeed && task.failed)
+	{
+		Report_Read("Create_Runs", in);
+		succeed = false;
+	}
+	fclose(in);
+	free(buffer[0]);
+	free(buffer[1]);
+	if (!succeed)
+	{
+		Remove_Runs(tempDir, id, 0, runs);
+		return (size_t)-1;
+	}
+	return runs;
+}
+
+//以小根堆归并编号为"[first, last)"的归并段并写入输出流(每个输入流的缓冲区为"capacity"个元素)
+static bool Merge_Group(OutputStream* out, size_t capacity, const char* tempDir, unsigned long id, size_t first, size_t last)
+{
+	size_t runs = last - first;
+	InputStream* streams = (InputStream*)malloc(sizeof(InputStream) * (runs == 0 ? 1 : runs));
+	if (streams == NULL)
+	{
+		perror("Merge_Group");
+		exit(EXIT_FAILURE);
+	}
+	Heap heap;
+	Init_Heap(&heap);
+	char path[EXTERNAL_MAX_PATH];
+	size_t opened = 0;
+	bool succeed = true;
+	for (; opened < runs; ++opened)
+	{
+		Run_Path(path, tempDir, id, first + opened);
+		if (!Open_InputStream(&streams[opened], path, capacity))
+		{
+			succeed = false;
+			break;
+		}
+		RunCursor cursor = { 0, opened };
+		if (Read_InputStream(&streams[opened], &cursor.value))
+		{
+			Push_Heap(&heap, cursor, Insert_Min_Heap);
+		}
+	}
+	while (succeed && !Empty_Heap(&heap))
+	{
+		RunCursor* top = &heap.array_ptr[0];
+		Write_OutputStream(out, top->value);
+		if (Read_InputStream(&streams[top->run], &top->value))
+		{
+			Ify_Min_Heap(heap.array_ptr, 0, heap.size);
+		}
+		else
+		{
+			Pop_Heap(&heap, Ify_Min_Heap);
+		}
+	}
+	for (size_t i = 0; i < opened; ++i)
+	{
+		succeed = Close_InputStream(&streams[i]) && succeed;
+	}
+	Destroy_Heap(&heap);
+	free(streams);
+	return succeed;
+}
+
+//多路归并所有归并段("fanIn"返回路数，"created"返回创建过的归并段总数，"merges"返回归并次数)
+static bool Merge_Runs(const char* output, size_t memory, const char* tempDir, unsigned long id, size_t runs, size_t* fanIn, size_t* created, size_t* merges)
+{
+	//"路数 + 1"个流各有两个缓冲区，每个缓冲区至少"EXTERNAL_MIN_BUFFER"个元素，总量不超过"memory"
+	size_t total = memory / sizeof(int);
+	size_t ways = total / (2 * EXTERNAL_MIN_BUFFER) - 1;
+	ways = ways < EXTERNAL_MAX_FANIN ? ways : EXTERNAL_MAX_FANIN;
+	size_t capacity = total / (2 * (ways + 1));
+	*fanIn = ways;
+	*merges = 0;
+	//编号为"[first, next)"的归并段尚未归并，每次将最早的"ways"个段归并为编号为"next"的新段
+	size_t first = 0, next = runs;
+	bool succeed = true;
+	char path[EXTERNAL_MAX_PATH];
+	while (succeed && next - first > ways)
+	{
+		OutputStream out;
+		Run_Path(path, tempDir, id, next);
+		//独占创建：同名文件已存在时失败，而不是覆盖其他排序的归并段
+		if (!Open_Output(&out, path, capacity, "wbx"))
+		{
+			succeed = false;
+			break;
+		}
+		++next;
+		++*merges;
+		succeed = Merge_Group(&out, capacity, tempDir, id, first, first + ways);
+		succeed = Close_OutputStream(&out) && succeed;
+		Remove_Runs(tempDir, id, first, first + ways);
+		first += ways;
+	}
+	*created = next;
+	if (!succeed)
+	{
+		return false;
+	}
+	OutputStream out;
+	if (!Open_OutputStream(&out, output, capacity))
+	{
+		return false;
+	}
+	++*merges;
+	succeed = Merge_Group(&out, capacity, tempDir, id, first, next);
+	return Close_OutputStream(&out) && succeed;
+}
+
+//外部排序("memory"为可使用的内存大小(单位：字节)，"tempDir"为临时文件目录，"stat"可为空)
+bool External_Sort(const char* input, const char* output, size_t memory, const char* tempDir, ExternalStat* stat)
+{
+	assert(input && output);
+	if (memory < EXTERNAL_MIN_MEMORY)
+	{
+		fprintf(stderr, "External_Sort: memory must be at least %zu bytes\n", (size_t)EXTERNAL_MIN_MEMORY);
+		return false;
+	}
+	size_t chunk = memory / 2 / sizeof(int);
+	unsigned long id = atomic_fetch_add(&External_Sequence, 1);
+	size_t count = 0;
+	double begin = Now_External();
+	size_t runs = Create_Runs(input, chunk, tempDir, id, &count);
+	if (runs == (size_t)-1)
+	{
+		return false;
+	}
+	double middle = Now_External();
+	size_t fanIn = 0, created = runs, merges = 0;
+	bool succeed = Merge_Runs(output, memory, tempDir, id, runs, &fanIn, &created, &merges);
+	Remove_Runs(tempDir, id, 0, created);
+	if (stat != NULL)
+	{
+		stat->count = count;
+		stat->runs = runs;
+		stat->fanIn = fanIn;
+		stat->merges = merges;
+		stat->runTime = middle - begin;
+		stat->mergeTime = Now_External() - middle;
+	}
+	return succeed;
+}
+
+//生成包含"count"个随机整数的二进制文件
+bool Generate_External(const char* path, size_t count)
+{
+	OutputStream out;
+	if (!Open_OutputStream(&out, path, 1 << 20))
+	{
+		return false;
+	}
+	unsigned long long state = (unsigned long long)time(NULL) * 2654435761ULL + 1;
+	for (size_t i = 0; i < count; ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		Write_OutputStream(&out, (int)(unsigned int)(state >> 32));
+	}
+	return Close_OutputStream(&out);
+}
+
+//判断二进制文件是否为升序
+bool Is_Sorted_External(const char* path, size_t* count)
+{
+	InputStream in;
+	if (!Open_InputStream(&in, path, 1 << 20))
+	{
+		return false;
+	}
+	bool sorted = true;
+	int prev = 0, value = 0;
+	size_t n = 0;
+	while (Read_InputStream(&in, &value))
+	{
+		if (n++ > 0 && value < prev)
+		{
+			sorted = false;
+		}
+		prev = value;
+	}
+	sorted = Close_InputStream(&in) && sorted;
+	if (count != NULL)
+	{
+		*count = n;
+	}
+	return sorted;
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+//引用头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <stdbool.h>
+#include <threads.h>
+#include <stdatomic.h>
+#if defined(_WIN32)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+//引用排序头文件(以实现归并段的内部排序)
+#include "../Sort.h"
+
+//引用堆头文件(以实现多路归并)
+#include "./Heap/Heap.h"
+
+/*
+ * 外部排序(升序)
+ * 1. 待排序文件为"int"类型的二进制文件(本机字节序)，不要求文件能一次性装入内存。
+ * 2. 生成归并段：每次读取"memory"字节的一半到内存，使用内省排序("Intro_Sort")排序后写入临时文件；读取下一块与排序当前块同时进行(双缓冲)。
+ * 3. 多路归并：每个归并段使用一个双缓冲输入流，以小根堆选出当前最小值写入双缓冲输出流。
+ *    同时归并的段数(路数)不超过"EXTERNAL_MAX_FANIN"，且"(路数 + 1) * 2"个缓冲区(每个至少"EXTERNAL_MIN_BUFFER"个元素)不超过"memory"。
+ *    归并段多于路数时，依次将最早的若干段归并为一个新的段并删除原来的段，直到剩余的段可以一次归并到输出文件。
+ * 4. 双缓冲流在后台线程中读写一个缓冲区，同时前台线程处理另一个缓冲区。
+ * 5. 时间复杂度为：O(N * logN)，归并段不多于路数时，磁盘读写量为：两次读、两次写整个文件；否则每多一层归并，多读写一次。
+ * 6. 归并段临时文件名包含进程号与进程内的排序序号，并以独占方式("wbx")创建，同时进行的多个排序不会覆盖彼此的归并段。
+ * 7. 读取时区分文件结束与读取错误("ferror")，读取错误或文件末尾不足一个"int"时排序失败，而不会截断输出。
+ * 8. "memory"不足"EXTERNAL_MIN_MEMORY"时排序失败，而不是超出限制使用内存。
+ */
+
+//定义标识符
+#define EXTERNAL_MIN_BUFFER 4096
+#define EXTERNAL_MAX_FANIN 256
+#define EXTERNAL_MIN_MEMORY (2 * 3 * EXTERNAL_MIN_BUFFER * sizeof(int))
+#define EXTERNAL_MAX_PATH 512
+
+//定义结构体类型(后台读写任务)
+typedef struct Transfer
+{
+	FILE* file;
+	int* buffer;
+	size_t count;
+	size_t done;
+	bool failed;
+	bool partial; //文件末尾不足一个元素
+} Transfer;
+
+//定义结构体类型(双缓冲输入流)
+typedef struct InputStream
+{
+	FILE* file;
+	int* buffer[2];
+	size_t capacity;
+	size_t size;
+	size_t pos;
+	int current;
+	bool pending;
+	bool failed;
+	Transfer task;
+	thrd_t thread;
+} InputStream;
+
+//定义结构体类型(双缓冲输出流)
+typedef struct OutputStream
+{
+	FILE* file;
+	int* buffer[2];
+	size_t capacity;
+	size_t size;
+	int current;
+	bool pending;
+	bool failed;
+	Transfer task;
+	thrd_t thread;
+} OutputStream;
+
+//定义结构体类型(外部排序统计信息)
+typedef struct ExternalStat
+{
+	size_t count;
+	size_t runs;
+	size_t fanIn;
+	size_t merges;
+	double runTime;
+	double mergeTime;
+} ExternalStat;
+
+//获取当前时间(单位：秒)
+double Now_External();
+
+//打开双缓冲输入流("capacity"为每个缓冲区的元素个数)
+bool Open_InputStream(InputStream* ptr, const char* path, size_t capacity);
+
+//从输入流中读取一个元素，流结束或读取失败时返回"false"
+bool Read_InputStream(InputStream* ptr, int* value);
+
+//关闭输入流，读取失败时返回"false"
+bool Close_InputStream(InputStream* ptr);
+
+//打开双缓冲输出流("capacity"为每个缓冲区的元素个数)
+bool Open_OutputStream(OutputStream* ptr, const char* path, size_t capacity);
+
+//向输出流中写入一个元素
+void Write_OutputStream(OutputStream* ptr, int value);
+
+//关闭输出流，写入失败时返回"false"
+bool Close_OutputStream(OutputStream* ptr);
+
+//外部排序("memory"为可使用的内存大小(单位：字节)，"tempDir"为临时文件目录，"stat"可为空)
+bool External_Sort(const char* input, const char* output, size_t memory, const char* tempDir, ExternalStat* stat);
+
+//生成包含"count"个随机整数的二进制文件
+bool Generate_External(const char* path, size_t count);
+
+//判断二进制文件是否为升序
+bool Is_Sorted_External(const char* path, size_t* count);
\ No newline at end of file
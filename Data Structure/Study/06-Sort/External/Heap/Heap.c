@@ -0,0 +1,114 @@
+#include "Heap.h"
+
+//初始化堆
+void Init_Heap(Heap* ptr)
+{
+	assert(ptr);
+	ptr->array_ptr = NULL;
+	ptr->size = ptr->capacity = 0;
+}
+
+//检查堆容量
+void Check_Heap(Heap* ptr)
+{
+	assert(ptr);
+	if (ptr->size == ptr->capacity)
+	{
+		ptr->capacity = ptr->capacity == 0 ? 4 : ptr->capacity * 2;
+		HeapDataType* tmp = (HeapDataType*)realloc(ptr->array_ptr, sizeof(HeapDataType) * ptr->capacity);
+		if (tmp == NULL)
+		{
+			perror("Check_Heap");
+			exit(EXIT_FAILURE);
+		}
+		ptr->array_ptr = tmp;
+	}
+}
+
+//交换元素
+void Swap_Heap(HeapDataType* array_ptr, size_t x, size_t y)
+{
+	HeapDataType tmp = array_ptr[x];
+	array_ptr[x] = array_ptr[y];
+	array_ptr[y] = tmp;
+}
+
+//适用于小根堆的向上调整函数
+void Insert_Min_Heap(HeapDataType* array_ptr, size_t index)
+{
+	size_t father = index == 0 ? 0 : (index - 1) / 2;
+	while (array_ptr[index].value < array_ptr[father].value)
+	{
+		Swap_Heap(array_ptr, index, (index - 1) / 2);
+		index = father;
+		father = index == 0 ? 0 : (index - 1) / 2;
+	}
+}
+
+//适用于小根堆的向下调整函数
+void Ify_Min_Heap(HeapDataType* array_ptr, size_t index, size_t size)
+{
+	size_t left = index * 2 + 1;
+	while (left < size)
+	{
+		size_t smallest = left + 1 < size && array_ptr[left + 1].value < array_ptr[left].value ? left + 1 : left;
+		smallest = array_ptr[smallest].value < array_ptr[index].value ? smallest : index;
+		if (index == smallest)
+		{
+			break;
+		}
+		Swap_Heap(array_ptr, index, smallest);
+		index = smallest;
+		left = smallest * 2 + 1;
+	}
+}
+
+//插入元素到堆中
+void Push_Heap(Heap* ptr, HeapDataType data, void (* Adjustment)(HeapDataType*, size_t))
+{
+	assert(ptr);
+	Check_Heap(ptr);
+	ptr->array_ptr[ptr->size] = data;
+	Adjustment(ptr->array_ptr, ptr->size++);
+}
+
+//删除堆顶元素
+HeapDataType Pop_Heap(Heap* ptr, void (* Adjustment)(HeapDataType*, size_t, size_t))
+{
+	assert(ptr && !Empty_Heap(ptr));
+	HeapDataType ans = ptr->array_ptr[0];
+	Swap_Heap(ptr->array_ptr, 0, --ptr->size);
+	Adjustment(ptr->array_ptr, 0, ptr->size);
+	return ans;
+}
+
+//获取堆顶元素数据
+HeapDataType Top_Heap(Heap* ptr)
+{
+	assert(ptr);
+	assert(!Empty_Heap(ptr));
+	return ptr->array_ptr[0];
+}
+
+//判断堆是否为空堆
+bool Empty_Heap(Heap* ptr)
+{
+	assert(ptr);
+	return ptr->size == 0;
+}
+
+//获取堆中的元素个数
+size_t Size_Heap(Heap* ptr)
+{
+	assert(ptr);
+	return ptr->size;
+}
+
+//销毁堆
+void Destroy_Heap(Heap* ptr)
+{
+	assert(ptr);
+	free(ptr->array_ptr);
+	ptr->array_ptr = NULL;
+	ptr->size = ptr->capacity = 0;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+//引用头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+
+/*
+ * 本堆源自"05-Binary Tree/01-Heap"，用于外部排序的多路归并。
+ * 1. 堆数据元素为归并段游标(当前值与所属归并段序号)，按当前值比较。
+ * 2. 多路归并只需要小根堆，故仅保留小根堆相关函数，交换函数更名为"Swap_Heap"以免与排序模块的"Swap"函数重名。
+ */
+
+//定义结构体类型(归并段游标)
+typedef struct RunCursor
+{
+	int value;
+	size_t run;
+} RunCursor;
+
+//重命名堆数据元素类型
+typedef RunCursor HeapDataType;
+
+//定义结构体类型(数组实现堆)
+typedef struct Heap
+{
+	HeapDataType* array_ptr;
+	size_t size;
+	size_t capacity;
+} Heap;
+
+//初始化堆
+void Init_Heap(Heap* ptr);
+
+//检查堆容量
+void Check_Heap(Heap* ptr);
+
+//交换元素
+void Swap_Heap(HeapDataType* array_ptr, size_t x, size_t y);
+
+//适用于小根堆的向上调整函数
+void Insert_Min_Heap(HeapDataType* array_ptr, size_t index);
+
+//适用于小根堆的向下调整函数
+void Ify_Min_Heap(HeapDataType* array_ptr, size_t index, size_t size);
+
+//插入元素到堆中
+void Push_Heap(Heap* ptr, HeapDataType data, void (* Adjustment)(HeapDataType*, size_t));
+
+//删除堆顶元素
+HeapDataType Pop_Heap(Heap* ptr, void (* Adjustment)(HeapDataType*, size_t, size_t));
+
+//获取堆顶元素数据
+HeapDataType Top_Heap(Heap* ptr);
+
+//判断堆是否为空堆
+bool Empty_Heap(Heap* ptr);
+
+//获取堆中的元素个数
+size_t Size_Heap(Heap* ptr);
+
+//销毁堆
+void Destroy_Heap(Heap* ptr);
\ No newline at end of file
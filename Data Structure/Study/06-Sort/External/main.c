@@ -0,0 +1,98 @@
+#include "External.h"
+
+/*
+ * 外部排序命令行工具
+ * 1. generate <file> <count>：生成包含"count"个随机整数的二进制文件。
+ * 2. sort <input> <output> [memoryMB] [tempDir]：外部排序，默认使用"256MB"内存，临时文件默认存放于当前目录。
+ * 3. verify <file>：检查二进制文件是否为升序。
+ * 4. bench [sizeGB] [memoryMB] [tempDir]：生成"sizeGB"大小(默认"10GB")的文件并排序、检查，输出各阶段耗时与吞吐量。
+ */
+
+#define DEFAULT_MEMORY_MB 256
+#define DEFAULT_BENCH_GB 10
+
+//打印用法
+void Usage(const char* name)
+{
+	printf("Usage:\n");
+	printf("  %s generate <file> <count>\n", name);
+	printf("  %s sort <input> <output> [memoryMB] [tempDir]\n", name);
+	printf("  %s verify <file>\n", name);
+	printf("  %s bench [sizeGB] [memoryMB] [tempDir]\n", name);
+}
+
+//排序并打印统计信息
+bool Run_Sort(const char* input, const char* output, size_t memoryMB, const char* tempDir)
+{
+	ExternalStat stat;
+	if (!External_Sort(input, output, memoryMB << 20, tempDir, &stat))
+	{
+		printf("External_Sort：Failed!\n");
+		return false;
+	}
+	double megabytes = (double)stat.count * sizeof(int) / (1 << 20);
+	printf("Count：%zu\n", stat.count);
+	printf("Runs：%zu\n", stat.runs);
+	printf("Fan-in：%zu，Merges：%zu\n", stat.fanIn, stat.merges);
+	printf("Run Time：%lfs\n", stat.runTime);
+	printf("Merge Time：%lfs\n", stat.mergeTime);
+	printf("Throughput：%lfMB/s\n", megabytes / (stat.runTime + stat.mergeTime));
+	return true;
+}
+
+//检查并打印结果
+bool Run_Verify(const char* path)
+{
+	size_t count = 0;
+	double begin = Now_External();
+	bool sorted = Is_Sorted_External(path, &count);
+	printf("Verify：%zu elements, %lfs\n", count, Now_External() - begin);
+	sorted ? printf("Good Luck!\n") : printf("Oops!\n");
+	return sorted;
+}
+
+//基准测试
+bool Run_Bench(double sizeGB, size_t memoryMB, const char* tempDir)
+{
+	char input[EXTERNAL_MAX_PATH], output[EXTERNAL_MAX_PATH];
+	snprintf(input, sizeof(input), "%s/External_Bench_Input.bin", tempDir == NULL ? "." : tempDir);
+	snprintf(output, sizeof(output), "%s/External_Bench_Output.bin", tempDir == NULL ? "." : tempDir);
+	size_t count = (size_t)(sizeGB * (1 << 30) / sizeof(int));
+	printf("Size：%lfGB，Memory：%zuMB\n", sizeGB, memoryMB);
+
+	double begin = Now_External();
+	if (!Generate_External(input, count))
+	{
+		return false;
+	}
+	printf("Generate Time：%lfs\n", Now_External() - begin);
+	bool succeed = Run_Sort(input, output, memoryMB, tempDir) && Run_Verify(output);
+	remove(input);
+	remove(output);
+	return succeed;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc >= 4 && strcmp(argv[1], "generate") == 0)
+	{
+		return Generate_External(argv[2], strtoull(argv[3], NULL, 10)) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	if (argc >= 4 && strcmp(argv[1], "sort") == 0)
+	{
+		size_t memoryMB = argc >= 5 ? strtoull(argv[4], NULL, 10) : DEFAULT_MEMORY_MB;
+		return Run_Sort(argv[2], argv[3], memoryMB, argc >= 6 ? argv[5] : NULL) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	if (argc >= 3 && strcmp(argv[1], "verify") == 0)
+	{
+		return Run_Verify(argv[2]) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	if (argc >= 2 && strcmp(argv[1], "bench") == 0)
+	{
+		double sizeGB = argc >= 3 ? strtod(argv[2], NULL) : DEFAULT_BENCH_GB;
+		size_t memoryMB = argc >= 4 ? strtoull(argv[3], NULL, 10) : DEFAULT_MEMORY_MB;
+		return Run_Bench(sizeGB, memoryMB, argc >= 5 ? argv[4] : NULL) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	Usage(argv[0]);
+	return EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,511 @@
+#include "Network.h"
+
+#if NETWORK_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define NETWORK_TARGET_AVX2
+#define NETWORK_TARGET_SSE4
+#else
+#include <immintrin.h>
+#define NETWORK_TARGET_AVX2 __attribute__((target("avx2")))
+#define NETWORK_TARGET_SSE4 __attribute__((target("sse4.1")))
+#endif
+#endif
+
+//比较并交换(无分支)
+#define COMPARE_EXCHANGE(a, b) do { int min_ = (a) < (b) ? (a) : (b); int max_ = (a) < (b) ? (b) : (a); (a) = min_; (b) = max_; } while (0)
+
+//将长度不足"block"的数组复制到缓冲区，并以"INT_MAX"补齐
+static size_t Load_Block(int* buffer, const int* arr, size_t size)
+{
+	size_t block = size <= 8 ? 8 : size <= 16 ? 16 : 32;
+	memcpy(buffer, arr, sizeof(int) * size);
+	for (size_t i = size; i < block; ++i)
+	{
+		buffer[i] = INT_MAX;
+	}
+	return block;
+}
+
+//排序网络(标量实现)
+static void Sort_Network_Scalar(int* arr, size_t size)
+{
+	int buffer[NETWORK_MAX_SIZE];
+	size_t block = Load_Block(buffer, arr, size);
+	for (size_t length = 1; length < block; length <<= 1)
+	{
+		for (size_t base = 0; base < block; base += length * 2)
+		{
+			for (size_t i = 0; i < length; ++i)
+			{
+				COMPARE_EXCHANGE(buffer[base + i], buffer[base + length * 2 - 1 - i]);
+			}
+			for (size_t distance = length >> 1; distance > 0; distance >>= 1)
+			{
+				for (size_t i = base; i < base + length * 2; ++i)
+				{
+					if ((i & distance) == 0)
+					{
+						COMPARE_EXCHANGE(buffer[i], buffer[i + distance]);
+					}
+				}
+			}
+		}
+	}
+	memcpy(arr, buffer, sizeof(int) * size);
+}
+
+//分区内核(标量实现，无分支的"Lomuto"分区)
+static size_t Partition_Kernel_Scalar(int* arr, size_t size, int pivot)
+{
+	size_t less = 0;
+	for (size_t i = 0; i < size; ++i)
+	{
+		int tmp = arr[i];
+		arr[i] = arr[less];
+		arr[less] = tmp;
+		less += tmp < pivot;
+	}
+	return less;
+}
+
+#if NETWORK_X86
+
+//掩码中"1"的个数
+static unsigned char Count_Mask[256];
+
+//"AVX2"分区所用的置换表，"Permute_AVX2[mask]"将掩码为"1"的元素按原顺序排列至前部，其余元素排列至后部。
+static int Permute_AVX2[256][8];
+
+//"SSE4.1"分区所用的字节重排表，含义同上。
+static unsigned char Shuffle_SSE4[16][16];
+
+//以一个掩码对(向量内)相邻元素进行比较交换，"mask"中为"1"的位置取较大值。
+NETWORK_TARGET_AVX2 static __m256i Exchange_AVX2(__m256i vec, __m256i index, int mask)
+{
+	__m256i perm = _mm256_permutevar8x32_epi32(vec, index);
+	__m256i min = _mm256_min_epi32(vec, perm);
+	__m256i max = _mm256_max_epi32(vec, perm);
+	switch (mask)
+	{
+	case 0xAA:
+		return _mm256_blend_epi32(min, max, 0xAA);
+	case 0xCC:
+		return _mm256_blend_epi32(min, max, 0xCC);
+	default:
+		return _mm256_blend_epi32(min, max, 0xF0);
+	}
+}
+
+//反转向量
+NETWORK_TARGET_AVX2 static __m256i Reverse_AVX2(__m256i vec)
+{
+	return _mm256_permutevar8x32_epi32(vec, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+//对单个向量内的"8"个元素排序
+NETWORK_TARGET_AVX2 static __m256i Sort_Vector_AVX2(__m256i vec)
+{
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6), 0xAA);
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(3, 2, 1, 0, 7, 6, 5, 4), 0xCC);
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6), 0xAA);
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0), 0xF0);
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5), 0xCC);
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6), 0xAA);
+	return vec;
+}
+
+//将单个双调向量整理为有序向量
+NETWORK_TARGET_AVX2 static __m256i Clean_Vector_AVX2(__m256i vec)
+{
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3), 0xF0);
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5), 0xCC);
+	vec = Exchange_AVX2(vec, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6), 0xAA);
+	return vec;
+}
+
+//排序网络("AVX2"实现，每个向量"8"个元素，"8/16/32"分别对应"1/2/4"个向量)
+NETWORK_TARGET_AVX2 static void Sort_Network_AVX2(int* arr, size_t size)
+{
+	int buffer[NETWORK_MAX_SIZE];
+	size_t count = Load_Block(buffer, arr, size) / 8;
+	__m256i vec[NETWORK_MAX_SIZE / 8];
+	for (size_t i = 0; i < count; ++i)
+	{
+		vec[i] = Sort_Vector_AVX2(_mm256_loadu_si256((const __m256i*)(buffer + i * 8)));
+	}
+	for (size_t length = 1; length < count; length <<= 1)
+	{
+		for (size_t base = 0; base < count; base += length * 2)
+		{
+			for (size_t i = 0; i < length; ++i)
+			{
+				__m256i low = vec[base + i];
+				__m256i high = Reverse_AVX2(vec[base + length * 2 - 1 - i]);
+				vec[base + i] = _mm256_min_epi32(low, high);
+				vec[base + length * 2 - 1 - i] = Reverse_AVX2(_mm256_max_epi32(low, high));
+			}
+			for (size_t distance = length >> 1; distance > 0; distance >>= 1)
+			{
+				for (size_t i = base; i < base + length * 2; ++i)
+				{
+					if ((i & distance) == 0)
+					{
+						__m256i low = vec[i];
+						vec[i] = _mm256_min_epi32(low, vec[i + distance]);
+						vec[i + distance] = _mm256_max_epi32(low, vec[i + distance]);
+					}
+				}
+			}
+			for (size_t i = base; i < base + length * 2; ++i)
+			{
+				vec[i] = Clean_Vector_AVX2(vec[i]);
+			}
+		}
+	}
+	for (size_t i = 0; i < count; ++i)
+	{
+		_mm256_storeu_si256((__m256i*)(buffer + i * 8), vec[i]);
+	}
+	memcpy(arr, buffer, sizeof(int) * size);
+}
+
+//分区单个向量，并同时写入左右两端
+NETWORK_TARGET_AVX2 static void Partition_Vector_AVX2(int* arr, __m256i vec, __m256i pivot, size_t* pleft, size_t* pright)
+{
+	int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, vec)));
+	unsigned int less = Count_Mask[mask];
+	vec = _mm256_permutevar8x32_epi32(vec, _mm256_loadu_si256((const __m256i*)Permute_AVX2[mask]));
+	_mm256_storeu_si256((__m256i*)(arr + *pleft), vec);
+	_mm256_storeu_si256((__m256i*)(arr + *pright - 8), vec);
+	*pleft += less;
+	*pright -= 8 - less;
+}
+
+/*
+ * 分区内核("AVX2"实现)
+ * 1. 先保存首尾两个向量，使数组中始终留有"16"个元素的空位。
+ * 2. 每次从空位较少的一端读取一个向量，保证左右两端的写入都不会覆盖尚未读取的元素。
+ */
+NETWORK_TARGET_AVX2 static size_t Partition_Kernel_AVX2(int* arr, size_t size, int pivot)
+{
+	if (size < 16)
+	{
+		return Partition_Kernel_Scalar(arr, size, pivot);
+	}
+	__m256i vecPivot = _mm256_set1_epi32(pivot);
+	__m256i first = _mm256_loadu_si256((const __m256i*)arr);
+	__m256i last = _mm256_loadu_si256((const __m256i*)(arr + size - 8));
+	size_t readLeft = 8, readRight = size - 8;
+	size_t writeLeft = 0, writeRight = size;
+	while (readRight - readLeft >= 8)
+	{
+		__m256i vec;
+		if (readLeft - writeLeft <= writeRight - readRight)
+		{
+			vec = _mm256_loadu_si256((const __m256i*)(arr + readLeft));
+			readLeft += 8;
+		}
+		else
+		{
+			readRight -= 8;
+			vec = _mm256_loadu_si256((const __m256i*)(arr + readRight));
+		}
+		Partition_Vector_AVX2(arr, vec, vecPivot, &writeLeft, &writeRight);
+	}
+	int rest[8];
+	size_t restSize = readRight - readLeft;
+	memcpy(rest, arr + readLeft, sizeof(int) * restSize);
+	for (size_t i = 0; i < restSize; ++i)
+	{
+		rest[i] < pivot ? (arr[writeLeft++] = rest[i]) : (arr[--writeRight] = rest[i]);
+	}
+	Partition_Vector_AVX2(arr, first, vecPivot, &writeLeft, &writeRight);
+	Partition_Vector_AVX2(arr, last, vecPivot, &writeLeft, &writeRight);
+	return writeLeft;
+}
+
+//以一个掩码对(向量内)相邻元素进行比较交换，"mask"中为"1"的位置取较大值。
+NETWORK_TARGET_SSE4 static __m128i Exchange_SSE4(__m128i vec, int shuffle, int mask)
+{
+	__m128i perm;
+	switch (shuffle)
+	{
+	case 0xB1:
+		perm = _mm_shuffle_epi32(vec, 0xB1);
+		break;
+	case 0x4E:
+		perm = _mm_shuffle_epi32(vec, 0x4E);
+		break;
+	default:
+		perm = _mm_shuffle_epi32(vec, 0x1B);
+		break;
+	}
+	__m128i min = _mm_min_epi32(vec, perm);
+	__m128i max = _mm_max_epi32(vec, perm);
+	return mask == 0xCC ? _mm_blend_epi16(min, max, 0xCC) : _mm_blend_epi16(min, max, 0xF0);
+}
+
+//反转向量
+NETWORK_TARGET_SSE4 static __m128i Reverse_SSE4(__m128i vec)
+{
+	return _mm_shuffle_epi32(vec, 0x1B);
+}
+
+//对单个向量内的"4"个元素排序
+NETWORK_TARGET_SSE4 static __m128i Sort_Vector_SSE4(__m128i vec)
+{
+	vec = Exchange_SSE4(vec, 0xB1, 0xCC);
+	vec = Exchange_SSE4(vec, 0x1B, 0xF0);
+	vec = Exchange_SSE4(vec, 0xB1, 0xCC);
+	return vec;
+}
+
+//将单个双调向量整理为有序向量
+NETWORK_TARGET_SSE4 static __m128i Clean_Vector_SSE4(__m128i vec)
+{
+	vec = Exchange_SSE4(vec, 0x4E, 0xF0);
+	vec = Exchange_SSE4(vec, 0xB1, 0xCC);
+	return vec;
+}
+
+//排序网络("SSE4.1"实现，每个向量"4"个元素，"8/16/32"分别对应"2/4/8"个向量)
+NETWORK_TARGET_SSE4 static void Sort_Network_SSE4(int* arr, size_t size)
+{
+	int buffer[NETWORK_MAX_SIZE];
+	size_t count = Load_Block(buffer, arr, size) / 4;
+	__m128i vec[NETWORK_MAX_SIZE / 4];
+	for (size_t i = 0; i < count; ++i)
+	{
+		vec[i] = Sort_Vector_SSE4(_mm_loadu_si128((const __m128i*)(buffer + i * 4)));
+	}
+	for (size_t length = 1; length < count; length <<= 1)
+	{
+		for (size_t base = 0; base < count; base += length * 2)
+		{
+			for (size_t i = 0; i < length; ++i)
+			{
+				__m128i low = vec[base + i];
+				__m128i high = Reverse_SSE4(vec[base + length * 2 - 1 - i]);
+				vec[base + i] = _mm_min_epi32(low, high);
+				vec[base + length * 2 - 1 - i] = Reverse_SSE4(_mm_max_epi32(low, high));
+			}
+			for (size_t distance = length >> 1; distance > 0; distance >>= 1)
+			{
+				for (size_t i = base; i < base + length * 2; ++i)
+				{
+					if ((i & distance) == 0)
+					{
+						__m128i low = vec[i];
+						vec[i] = _mm_min_epi32(low, vec[i + distance]);
+						vec[i + distance] = _mm_max_epi32(low, vec[i + distance]);
+					}
+				}
+			}
+			for (size_t i = base; i < base + length * 2; ++i)
+			{
+				vec[i] = Clean_Vector_SSE4(vec[i]);
+			}
+		}
+	}
+	for (size_t i = 0; i < count; ++i)
+	{
+		_mm_storeu_si128((__m128i*)(buffer + i * 4), vec[i]);
+	}
+	memcpy(arr, buffer, sizeof(int) * size);
+}
+
+//分区单个向量，并同时写入左右两端
+NETWORK_TARGET_SSE4 static void Partition_Vector_SSE4(int* arr, __m128i vec, __m128i pivot, size_t* pleft, size_t* pright)
+{
+	int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(pivot, vec)));
+	unsigned int less = Count_Mask[mask];
+	vec = _mm_shuffle_epi8(vec, _mm_loadu_si128((const __m128i*)Shuffle_SSE4[mask]));
+	_mm_storeu_si128((__m128i*)(arr + *pleft), vec);
+	_mm_storeu_si128((__m128i*)(arr + *pright - 4), vec);
+	*pleft += less;
+	*pright -= 4 - less;
+}
+
+//分区内核("SSE4.1"实现，思路同"AVX2"实现)
+NETWORK_TARGET_SSE4 static size_t Partition_Kernel_SSE4(int* arr, size_t size, int pivot)
+{
+	if (size < 8)
+	{
+		return Partition_Kernel_Scalar(arr, size, pivot);
+	}
+	__m128i vecPivot = _mm_set1_epi32(pivot);
+	__m128i first = _mm_loadu_si128((const __m128i*)arr);
+	__m128i last = _mm_loadu_si128((const __m128i*)(arr + size - 4));
+	size_t readLeft = 4, readRight = size - 4;
+	size_t writeLeft = 0, writeRight = size;
+	while (readRight - readLeft >= 4)
+	{
+		__m128i vec;
+		if (readLeft - writeLeft <= writeRight - readRight)
+		{
+			vec = _mm_loadu_si128((const __m128i*)(arr + readLeft));
+			readLeft += 4;
+		}
+		else
+		{
+			readRight -= 4;
+			vec = _mm_loadu_si128((const __m128i*)(arr + readRight));
+		}
+		Partition_Vector_SSE4(arr, vec, vecPivot, &writeLeft, &writeRight);
+	}
+	int rest[4];
+	size_t restSize = readRight - readLeft;
+	memcpy(rest, arr + readLeft, sizeof(int) * restSize);
+	for (size_t i = 0; i < restSize; ++i)
+	{
+		rest[i] < pivot ? (arr[writeLeft++] = rest[i]) : (arr[--writeRight] = rest[i]);
+	}
+	Partition_Vector_SSE4(arr, first, vecPivot, &writeLeft, &writeRight);
+	Partition_Vector_SSE4(arr, last, vecPivot, &writeLeft, &writeRight);
+	return writeLeft;
+}
+
+//生成分区所用的置换表与字节重排表
+static void Init_Table()
+{
+	for (int mask = 1; mask < 256; ++mask)
+	{
+		Count_Mask[mask] = (unsigned char)(Count_Mask[mask >> 1] + (mask & 1));
+	}
+	for (int mask = 0; mask < 256; ++mask)
+	{
+		int front = 0, back = Count_Mask[mask];
+		for (int i = 0; i < 8; ++i)
+		{
+			Permute_AVX2[mask][(mask >> i) & 1 ? front++ : back++] = i;
+		}
+	}
+	for (int mask = 0; mask < 16; ++mask)
+	{
+		int front = 0, back = Count_Mask[mask];
+		for (int i = 0; i < 4; ++i)
+		{
+			int pos = (mask >> i) & 1 ? front++ : back++;
+			for (int j = 0; j < 4; ++j)
+			{
+				Shuffle_SSE4[mask][pos * 4 + j] = (unsigned char)(i * 4 + j);
+			}
+		}
+	}
+}
+
+//检测"CPU"是否支持指定指令集
+static bool Support_AVX2()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+	{
+		return false;
+	}
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+	{
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static bool Support_SSE4()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	return (info[2] & (1 << 19)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+#endif
+
+//当前所使用的实现
+static void (* Sort_Network_Impl)(int*, size_t) = NULL;
+static size_t (* Partition_Kernel_Impl)(int*, size_t, int) = NULL;
+static const char* Name_Network_Impl = NULL;
+
+//运行时分派(选择当前"CPU"所支持的最快实现)
+static void Init_Network()
+{
+	Sort_Network_Impl = Sort_Network_Scalar;
+	Partition_Kernel_Impl = Partition_Kernel_Scalar;
+	Name_Network_Impl = "Scalar";
+#if NETWORK_X86
+	Init_Table();
+	if (Support_AVX2())
+	{
+		Sort_Network_Impl = Sort_Network_AVX2;
+		Partition_Kernel_Impl = Partition_Kernel_AVX2;
+		Name_Network_Impl = "AVX2";
+	}
+	else if (Support_SSE4())
+	{
+		Sort_Network_Impl = Sort_Network_SSE4;
+		Partition_Kernel_Impl = Partition_Kernel_SSE4;
+		Name_Network_Impl = "SSE4.1";
+	}
+#endif
+}
+
+//排序网络(升序，"size"不超过"NETWORK_MAX_SIZE")
+void Sort_Network(int* arr, size_t size)
+{
+	if (arr == NULL || size < 2)
+	{
+		return;
+	}
+	if (Sort_Network_Impl == NULL)
+	{
+		Init_Network();
+	}
+	Sort_Network_Impl(arr, size);
+}
+
+//分区内核(返回小于"pivot"的元素个数)
+size_t Partition_Kernel(int* arr, size_t size, int pivot)
+{
+	if (arr == NULL || size == 0)
+	{
+		return 0;
+	}
+	if (Partition_Kernel_Impl == NULL)
+	{
+		Init_Network();
+	}
+	return Partition_Kernel_Impl(arr, size, pivot);
+}
+
+//获取排序网络的比较器个数(按补齐后的长度计算)
+size_t Comparators_Network(size_t size)
+{
+	if (size < 2)
+	{
+		return 0;
+	}
+	size_t block = size <= 8 ? 8 : size <= 16 ? 16 : 32;
+	size_t level = block == 8 ? 3 : block == 16 ? 4 : 5;
+	return block / 2 * (level * (level + 1) / 2);
+}
+
+//获取当前所使用的指令集名称
+const char* Name_Network()
+{
+	if (Name_Network_Impl == NULL)
+	{
+		Init_Network();
+	}
+	return Name_Network_Impl;
+}
\ No newline at end of file
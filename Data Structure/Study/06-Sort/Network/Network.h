@@ -0,0 +1,38 @@
+#pragma once
+
+//引用头文件
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+/*
+ * 排序网络与分区内核(仅适用于"int"类型)
+ * 1. 排序网络为双调排序网络(Bitonic Sorting Network)，适用于长度不超过"NETWORK_MAX_SIZE"的小规模数组，不足"8/16/32"的部分以"INT_MAX"补齐。
+ * 2. 分区内核为无分支二路分区，将数组划分为"小于基准值"与"大于等于基准值"两部分，并返回"小于基准值"的元素个数。
+ * 3. 包含"AVX2"、"SSE4.1"与标量三种实现，首次调用时根据运行时检测到的指令集选择实现(运行时分派)。
+ * 4. 非"x86"平台或不支持上述指令集的编译器只使用标量实现。
+ */
+
+//定义标识符
+#define NETWORK_MAX_SIZE 32
+
+//判断是否为"x86"平台
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define NETWORK_X86 1
+#else
+#define NETWORK_X86 0
+#endif
+
+//排序网络(升序，"size"不超过"NETWORK_MAX_SIZE")
+void Sort_Network(int* arr, size_t size);
+
+//分区内核(返回小于"pivot"的元素个数)
+size_t Partition_Kernel(int* arr, size_t size, int pivot);
+
+//获取排序网络的比较器个数(按补齐后的长度计算)
+size_t Comparators_Network(size_t size);
+
+//获取当前所使用的指令集名称
+const char* Name_Network();
\ No newline at end of file
@@ -1,14 +1,20 @@
 #include "Sort.h"
 
+#ifdef SORT_COUNT
+unsigned long long Compare_Count = 0;
+unsigned long long Swap_Count = 0;
+#endif
+
 //比较器
 int Compare_Int(const void* p1, const void* p2)
 {
-	return *(int*)p1 - *(int*)p2;
+	return (*(int*)p1 > *(int*)p2) - (*(int*)p1 < *(int*)p2);
 }
 
 //交换元素
 void Swap(SortDataType* ptr1, SortDataType* ptr2)
 {
+	COUNT_SWAP();
 	(*ptr1 ^ *ptr2) && (*ptr2 ^= *ptr1 ^= *ptr2, *ptr1 ^= *ptr2);
 }
 
@@ -24,7 +30,7 @@ void Bubble_Sort(SortDataType* arr, size_t size)
 		bool flag = false;
 		for (size_t j = 0; j < i; ++j)
 		{
-			if (arr[j] > arr[j + 1])
+			if (LESS(arr[j + 1], arr[j]))
 			{
 				flag = true;
 				Swap(&arr[j], &arr[j + 1]);
@@ -49,7 +55,7 @@ void Selection_Sort(SortDataType* arr, size_t size)
 		size_t minIndex = i;
 		for (size_t j = i + 1; j < size; ++j)
 		{
-			minIndex = arr[minIndex] < arr[j] ? minIndex : j;
+			minIndex = LESS(arr[minIndex], arr[j]) ? minIndex : j;
 		}
 		Swap(&arr[minIndex], &arr[i]);
 	}
@@ -66,7 +72,7 @@ void Insertion_Sort(SortDataType* arr, size_t size)
 	{
 		size_t j = i;
 		SortDataType tmp = arr[i];
-		for (; j > 0 && tmp < arr[j - 1]; --j)
+		for (; j > 0 && LESS(tmp, arr[j - 1]); --j)
 		{
 			arr[j] = arr[j - 1];
 		}
@@ -90,7 +96,7 @@ void Shell_Sort(SortDataType* arr, size_t size)
 	{
 		for (size_t i = gap; i < size; ++i)
 		{
-			for (size_t j = i; j >= gap && arr[j] < arr[j - gap]; j -= gap)
+			for (size_t j = i; j >= gap && LESS(arr[j], arr[j - gap]); j -= gap)
 			{
 				Swap(&arr[j], &arr[j - gap]);
 			}
@@ -105,8 +111,8 @@ void Ify_Max_Heap(SortDataType* arr, size_t index, size_t size)
 	size_t left = index * 2 + 1;
 	while (left < size)
 	{
-		size_t largest = left + 1 < size && arr[left + 1] > arr[left] ? left + 1 : left;
-		largest = arr[index] < arr[largest] ? largest : index;
+		size_t largest = left + 1 < size && LESS(arr[left], arr[left + 1]) ? left + 1 : left;
+		largest = LESS(arr[index], arr[largest]) ? largest : index;
 		if (index == largest)
 		{
 			break;
@@ -145,7 +151,7 @@ void Merge(SortDataType* arr, size_t left, size_t middle, size_t right)
 	size_t p1 = left, p2 = middle + 1;
 	while (p1 <= middle && p2 <= right)
 	{
-		help[i++] = arr[p1] <= arr[p2] ? arr[p1++] : arr[p2++];
+		help[i++] = !LESS(arr[p2], arr[p1]) ? arr[p1++] : arr[p2++];
 	}
 	while (p1 <= middle)
 	{
@@ -165,8 +171,9 @@ void Merge(SortDataType* arr, size_t left, size_t middle, size_t right)
 //归并排序递归过程函数
 void Merge_Sort_Recursive_Process(SortDataType* arr, size_t left, size_t right)
 {
-	if (left == right)
+	if (right - left + 1 <= NETWORK_MAX_SIZE)
 	{
+		Insertion_Sort(arr + left, right - left + 1);
 		return;
 	}
 	size_t middle = left + ((right - left) >> 1);
@@ -233,17 +240,17 @@ void Partition(SortDataType* arr, int left, int right, int* pkeyLight, int* pkey
 	int index = left;
 	while (index < more)
 	{
-		if (arr[index] == arr[right])
+		if (LESS(arr[index], arr[right]))
 		{
-			index++;
+			Swap(&arr[index++], &arr[++less]);
 		}
-		else if (arr[index] < arr[right])
+		else if (LESS(arr[right], arr[index]))
 		{
-			Swap(&arr[index++], &arr[++less]);
+			Swap(&arr[index], &arr[--more]);
 		}
 		else
 		{
-			Swap(&arr[index], &arr[--more]);
+			index++;
 		}
 	}
 	Swap(&arr[more], &arr[right]);
@@ -257,6 +264,12 @@ void Quick_Sort_Recursive_Process(SortDataType* arr, int left, int right)
 	{
 		return;
 	}
+	if (right - left + 1 <= NETWORK_MAX_SIZE)
+	{
+		Sort_Network(arr + left, right - left + 1);
+		COUNT_COMPARE(Comparators_Network(right - left + 1));
+		return;
+	}
 	Swap(&arr[left + (rand() % (right - left + 1))], &arr[right]);
 	int keyLeft, keyRight;
 	Partition(arr, left, right, &keyLeft, &keyRight);
@@ -281,32 +294,283 @@ void Quick_Sort_UnRecursive(SortDataType* arr, size_t size)
 	{
 		return;
 	}
+	//栈中保存待处理区间(栈帧)，先压入较大的区间，使栈深度不超过"O(logN)"(栈帧通常都在内联缓冲区中)
 	Stack help;
 	Init_Stack(&help);
-	Swap(&arr[rand() % size], &arr[size - 1]);
-	int keyLeft, keyRight;
-	Partition(arr, 0, (int)size - 1, &keyLeft, &keyRight);
-	Push_Stack(&help, 0);
-	Push_Stack(&help, keyLeft - 1);
-	Push_Stack(&help, keyRight + 1);
-	Push_Stack(&help, (int)size - 1);
+	Push_Frame_Stack(&help, 0, (int)size - 1);
 	while (!Empty_Stack(&help))
 	{
-		int right = Pop_Stack(&help);
-		int left = Pop_Stack(&help);
-		if (left < right)
+		StackFrame frame = Pop_Frame_Stack(&help);
+		int left = frame.left, right = frame.right;
+		if (left < right && right - left + 1 <= NETWORK_MAX_SIZE)
+		{
+			Sort_Network(arr + left, right - left + 1);
+			COUNT_COMPARE(Comparators_Network(right - left + 1));
+		}
+		else if (left < right)
 		{
+			int keyLeft, keyRight;
 			Swap(&arr[left + (rand() % (right - left + 1))], &arr[right]);
 			Partition(arr, left, right, &keyLeft, &keyRight);
-			Push_Stack(&help, left);
-			Push_Stack(&help, keyLeft - 1);
-			Push_Stack(&help, keyRight + 1);
-			Push_Stack(&help, right);
+			if (keyLeft - left > right - keyRight)
+			{
+				Push_Frame_Stack(&help, left, keyLeft - 1);
+				Push_Frame_Stack(&help, keyRight + 1, right);
+			}
+			else
+			{
+				Push_Frame_Stack(&help, keyRight + 1, right);
+				Push_Frame_Stack(&help, left, keyLeft - 1);
+			}
 		}
 	}
 	Destroy_Stack(&help);
 }
 
+//三数取中
+static inline SortDataType Median_Of_Three(SortDataType a, SortDataType b, SortDataType c)
+{
+	return LESS(a, b) ? (LESS(b, c) ? b : (LESS(a, c) ? c : a)) : (LESS(a, c) ? a : (LESS(b, c) ? c : b));
+}
+
+//内省排序递归过程函数
+void Intro_Sort_Process(SortDataType* arr, size_t size, size_t depth)
+{
+	while (size > NETWORK_MAX_SIZE)
+	{
+		if (depth-- == 0)
+		{
+			Heap_Sort(arr, size);
+			return;
+		}
+		SortDataType pivot = Median_Of_Three(arr[0], arr[size / 2], arr[size - 1]);
+		if (size > INTRO_NINTHER_SIZE)
+		{
+			//大区间使用九数取中(三组三数取中的中位数)，避免分区内核打乱后的有序数据使三数取中退化
+			size_t step = size / 8, middle = size / 2;
+			pivot = Median_Of_Three(Median_Of_Three(arr[0], arr[step], arr[step * 2]),
+				Median_Of_Three(arr[middle - step], arr[middle], arr[middle + step]),
+				Median_Of_Three(arr[size - 1 - step * 2], arr[size - 1 - step], arr[size - 1]));
+		}
+		size_t less = Partition_Kernel(arr, size, pivot);
+		COUNT_COMPARE(size);
+		if (less == 0)
+		{
+			//基准值为最小值，此时再将等于基准值的元素分离出来(它们已在最终位置)。
+			if (pivot == INT_MAX)
+			{
+				return;
+			}
+			size_t equal = Partition_Kernel(arr, size, pivot + 1);
+			COUNT_COMPARE(size);
+			arr += equal;
+			size -= equal;
+			continue;
+		}
+		if (less < size - less)
+		{
+			Intro_Sort_Process(arr, less, depth);
+			arr += less;
+			size -= less;
+		}
+		else
+		{
+			Intro_Sort_Process(arr + less, size - less, depth);
+			size = less;
+		}
+	}
+	Sort_Network(arr, size);
+	COUNT_COMPARE(Comparators_Network(size));
+}
+
+//内省排序
+void Intro_Sort(SortDataType* arr, size_t size)
+{
+	if (arr == NULL || size < 2)
+	{
+		return;
+	}
+	//整体已为升序时直接返回，整体为降序时逆置即可
+	size_t ascending = 1, descending = 1;
+	while (ascending < size && !LESS(arr[ascending], arr[ascending - 1]))
+	{
+		++ascending;
+	}
+	if (ascending == size)
+	{
+		return;
+	}
+	while (ascending == 1 && descending < size && !LESS(arr[descending - 1], arr[descending]))
+	{
+		++descending;
+	}
+	if (descending == size)
+	{
+		for (size_t i = 0, j = size - 1; i < j; ++i, --j)
+		{
+			Swap(&arr[i], &arr[j]);
+		}
+		return;
+	}
+	size_t depth = 0;
+	for (size_t i = size; i > 1; i >>= 1)
+	{
+		++depth;
+	}
+	Intro_Sort_Process(arr, size, depth * 2);
+}
+
+//适用于小根堆的向下调整函数(仅供流式前"k"大使用)
+static void Ify_Min_Heap(SortDataType* arr, size_t index, size_t size)
+{
+	size_t left = index * 2 + 1;
+	while (left < size)
+	{
+		size_t smallest = left + 1 < size && LESS(arr[left + 1], arr[left]) ? left + 1 : left;
+		smallest = LESS(arr[smallest], arr[index]) ? smallest : index;
+		if (index == smallest)
+		{
+			break;
+		}
+		Swap(&arr[index], &arr[smallest]);
+		index = smallest;
+		left = index * 2 + 1;
+	}
+}
+
+//将数组调整为第"k"小的元素位于下标"k"处，其左侧元素均不大于它，右侧元素均不小于它
+void Nth_Element(SortDataType* arr, size_t size, size_t k)
+{
+	if (arr == NULL || k >= size)
+	{
+		return;
+	}
+	int left = 0, right = (int)size - 1;
+	while (left < right)
+	{
+		Swap(&arr[left + (rand() % (right - left + 1))], &arr[right]);
+		int keyLeft, keyRight;
+		Partition(arr, left, right, &keyLeft, &keyRight);
+		if ((int)k < keyLeft)
+		{
+			right = keyLeft - 1;
+		}
+		else if ((int)k > keyRight)
+		{
+			left = keyRight + 1;
+		}
+		else
+		{
+			return;
+		}
+	}
+}
+
+//获取数组中第"k"小的元素(数组会被重新排列)
+SortDataType Quick_Select(SortDataType* arr, size_t size, size_t k)
+{
+	assert(arr && k < size);
+	Nth_Element(arr, size, k);
+	return arr[k];
+}
+
+//将数组中最小的"k"个元素按升序排列至数组前部，其余元素顺序不定
+void Partial_Sort(SortDataType* arr, size_t size, size_t k)
+{
+	if (arr == NULL || k == 0)
+	{
+		return;
+	}
+	k = k < size ? k : size;
+	for (int i = (int)k - 1; i >= 0; --i)
+	{
+		Ify_Max_Heap(arr, i, k);
+	}
+	for (size_t i = k; i < size; ++i)
+	{
+		if (LESS(arr[i], arr[0]))
+		{
+			Swap(&arr[i], &arr[0]);
+			Ify_Max_Heap(arr, 0, k);
+		}
+	}
+	for (size_t heapSize = k; heapSize > 1;)
+	{
+		Swap(&arr[0], &arr[--heapSize]);
+		Ify_Max_Heap(arr, 0, heapSize);
+	}
+}
+
+//初始化流式前"k"大
+void Init_TopK(TopK* ptr, size_t k)
+{
+	assert(ptr && k > 0);
+	ptr->heap = (SortDataType*)malloc(sizeof(SortDataType) * k);
+	if (ptr->heap == NULL)
+	{
+		perror("Init_TopK");
+		exit(EXIT_FAILURE);
+	}
+	ptr->size = 0;
+	ptr->k = k;
+}
+
+//向流式前"k"大中加入一批数据
+void Push_TopK(TopK* ptr, const SortDataType* arr, size_t size)
+{
+	assert(ptr && (arr || size == 0));
+	size_t i = 0;
+	for (; i < size && ptr->size < ptr->k; ++i)
+	{
+		ptr->heap[ptr->size++] = arr[i];
+		if (ptr->size == ptr->k)
+		{
+			for (int j = (int)ptr->k - 1; j >= 0; --j)
+			{
+				Ify_Min_Heap(ptr->heap, j, ptr->k);
+			}
+		}
+	}
+	for (; i < size; ++i)
+	{
+		if (LESS(ptr->heap[0], arr[i]))
+		{
+			ptr->heap[0] = arr[i];
+			Ify_Min_Heap(ptr->heap, 0, ptr->k);
+		}
+	}
+}
+
+//获取当前最大的"k"个元素(降序)，返回元素个数
+size_t Result_TopK(TopK* ptr, SortDataType* result)
+{
+	assert(ptr && result);
+	size_t size = ptr->size;
+	for (size_t i = 0; i < size; ++i)
+	{
+		result[i] = ptr->heap[i];
+	}
+	for (int i = (int)size - 1; i >= 0; --i)
+	{
+		Ify_Min_Heap(result, i, size);
+	}
+	for (size_t heapSize = size; heapSize > 1;)
+	{
+		Swap(&result[0], &result[--heapSize]);
+		Ify_Min_Heap(result, 0, heapSize);
+	}
+	return size;
+}
+
+//销毁流式前"k"大
+void Destroy_TopK(TopK* ptr)
+{
+	assert(ptr);
+	free(ptr->heap);
+	ptr->heap = NULL;
+	ptr->size = ptr->k = 0;
+}
+
 //计数排序
 void Count_Sort(SortDataType* arr, size_t size)
 {
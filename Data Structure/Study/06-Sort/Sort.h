@@ -3,14 +3,37 @@
 //引用头文件
 #include <math.h>
 #include <stdio.h>
+#include <assert.h>
 #include <stdlib.h>
 
 //引用栈头文件(以实现快速排序的非递归实现)
 #include "./Stack/Stack.h"
 
+//引用排序网络头文件(以实现小规模区间的排序与快速排序的分区)
+#include "./Network/Network.h"
+
 //重命名需要排序的数组的数据元素类型
 typedef int SortDataType;
 
+/*
+ * 比较与交换计数(编译时定义"SORT_COUNT"标识符后启用，例如"-DSORT_COUNT")
+ * 1. 基于比较的排序算法通过"LESS"宏比较元素，通过"Swap"函数交换元素，启用计数后分别累加到"Compare_Count"与"Swap_Count"中。
+ * 2. 排序网络与分区内核中的比较按比较器个数与元素个数累加。
+ * 3. 未启用计数时"LESS"宏即为"<"运算符，不产生额外开销。
+ */
+#ifdef SORT_COUNT
+extern unsigned long long Compare_Count;
+extern unsigned long long Swap_Count;
+#define COUNT_COMPARE(n) ((void)(Compare_Count += (n)))
+#define COUNT_SWAP() ((void)(++Swap_Count))
+#else
+#define COUNT_COMPARE(n) ((void)0)
+#define COUNT_SWAP() ((void)0)
+#endif
+
+//比较元素(是否小于)
+#define LESS(a, b) (COUNT_COMPARE(1), (a) < (b))
+
 /*
  * 工具函数
  * 1.此处比较器适用于"qsort"库函数，本项目中所实现的排序算法都为升序，并未改造成库函数的形式，故本项目实现的排序算法无需比较器。
@@ -71,7 +94,8 @@ void Heap_Sort(SortDataType* arr, size_t size);
  * 1. 时间复杂度为：O(N * logN)，空间复杂度为：递归实现O(N + logN)、非递归实现O(N)。("log"符号表示以"2"为底的对数)
  * 2. 包含递归与非递归实现归并排序。
  * 3. 递归与非递归实现共用"Merge"核心函数。
- * 4. 稳定性：稳定排序。
+ * 4. 递归实现中区间长度不超过"NETWORK_MAX_SIZE"时改用插入排序，不再继续递归(插入排序为稳定排序，排序网络则不是)。
+ * 5. 稳定性：稳定排序。
  */
 
 //归并排序核心函数
@@ -92,7 +116,8 @@ void Merge_Sort_UnRecursive(SortDataType* arr, size_t size);
  * 2. 包含递归与非递归实现快速排序。
  * 3. 递归与非递归实现共用"Partition"核心函数。
  * 4. 快速排序的非递归实现使用栈来模拟递归过程。
- * 5. 稳定性：不稳定排序。
+ * 5. 区间长度不超过"NETWORK_MAX_SIZE"时直接使用排序网络排序，不再继续递归。
+ * 6. 稳定性：不稳定排序。
  */
 
 //快速排序核心函数
@@ -107,6 +132,62 @@ void Quick_Sort_Recursive(SortDataType* arr, size_t size);
 //快速排序(非递归实现)
 void Quick_Sort_UnRecursive(SortDataType* arr, size_t size);
 
+/*
+ * 内省排序(升序)
+ * 1. 时间复杂度为：O(N * logN)，空间复杂度为：O(logN)。("log"符号表示以"2"为底的对数)
+ * 2. 以三数取中选取基准值(区间长度超过"INTRO_NINTHER_SIZE"时使用九数取中)，并使用无分支的分区内核("Partition_Kernel")进行二路分区。
+ * 3. 排序前先检查整体是否已为升序或降序，升序直接返回，降序逆置后返回。
+ * 4. 递归深度超过"2 * logN"时改用堆排序，保证最坏情况下的时间复杂度。
+ * 5. 区间长度不超过"NETWORK_MAX_SIZE"时使用排序网络排序。
+ * 6. 稳定性：不稳定排序。
+ */
+
+//定义标识符
+#define INTRO_NINTHER_SIZE 128
+
+//内省排序递归过程函数
+void Intro_Sort_Process(SortDataType* arr, size_t size, size_t depth);
+
+//内省排序
+void Intro_Sort(SortDataType* arr, size_t size);
+
+/*
+ * 选择算法
+ * 1. 快速选择("Quick_Select"/"Nth_Element")：基于三路划分"Partition"，只向第"k"小元素所在的一侧继续划分，期望时间复杂度为：O(N)，空间复杂度为：O(1)。
+ * 2. 部分排序("Partial_Sort")：以大根堆维护当前最小的"k"个元素，最后将其调整为升序，时间复杂度为：O(N * logK)，空间复杂度为：O(1)。
+ * 3. 流式前"k"大("TopK")：以大小为"k"的小根堆维护已到达数据中最大的"k"个元素，数据可分批到达，无需保存全部数据，空间复杂度为：O(K)。
+ * 4. "k"均从"0"开始计数。
+ */
+
+//定义结构体类型(流式前"k"大)
+typedef struct TopK
+{
+	SortDataType* heap;
+	size_t size;
+	size_t k;
+} TopK;
+
+//将数组调整为第"k"小的元素位于下标"k"处，其左侧元素均不大于它，右侧元素均不小于它
+void Nth_Element(SortDataType* arr, size_t size, size_t k);
+
+//获取数组中第"k"小的元素(数组会被重新排列)
+SortDataType Quick_Select(SortDataType* arr, size_t size, size_t k);
+
+//将数组中最小的"k"个元素按升序排列至数组前部，其余元素顺序不定
+void Partial_Sort(SortDataType* arr, size_t size, size_t k);
+
+//初始化流式前"k"大
+void Init_TopK(TopK* ptr, size_t k);
+
+//向流式前"k"大中加入一批数据
+void Push_TopK(TopK* ptr, const SortDataType* arr, size_t size);
+
+//获取当前最大的"k"个元素(降序)，返回元素个数
+size_t Result_TopK(TopK* ptr, SortDataType* result);
+
+//销毁流式前"k"大
+void Destroy_TopK(TopK* ptr);
+
 /*
  * 计数排序(升序)
  * 1. 时间复杂度为：O(N + K)，空间复杂度为：O(K)，其中"K"为数值范围的最大值。
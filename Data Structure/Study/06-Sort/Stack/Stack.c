@@ -4,33 +4,46 @@
 void Init_Stack(Stack* ptr)
 {
 	assert(ptr);
-	ptr->size = 0;
-	ptr->head = ptr->tail = NULL;
+	ptr->array_ptr = ptr->buffer;
+	ptr->top = 0;
+	ptr->capacity = STACK_INLINE_SIZE;
 }
 
-//将一个元素压入栈中
-void Push_Stack(Stack* ptr, StackDataType data)
+//保证栈至少还能容纳"count"个元素
+static void Reserve_Stack(Stack* ptr, size_t count)
 {
-	assert(ptr);
-	StackNode* newNode = (StackNode*)malloc(sizeof(StackNode));
-	if (newNode == NULL)
+	if (ptr->top + count <= ptr->capacity)
 	{
-		perror("Push_Stack");
-		exit(EXIT_FAILURE);
+		return;
 	}
-	newNode->data = data;
-	newNode->prev = newNode->next = NULL;
-	if (ptr->head == NULL)
+	size_t newCapacity = ptr->capacity * 2;
+	while (newCapacity < ptr->top + count)
 	{
-		ptr->head = ptr->tail = newNode;
+		newCapacity *= 2;
+	}
+	//第一次扩容时从内联缓冲区复制到堆上，之后使用"realloc"
+	StackDataType* tmp = ptr->array_ptr == ptr->buffer ?
+		(StackDataType*)malloc(sizeof(StackDataType) * newCapacity) :
+		(StackDataType*)realloc(ptr->array_ptr, sizeof(StackDataType) * newCapacity);
+	if (tmp == NULL)
+	{
+		perror("Reserve_Stack");
+		exit(EXIT_FAILURE);
 	}
-	else
+	if (ptr->array_ptr == ptr->buffer)
 	{
-		ptr->head->prev = newNode;
-		newNode->next = ptr->head;
-		ptr->head = newNode;
+		memcpy(tmp, ptr->buffer, sizeof(StackDataType) * ptr->top);
 	}
-	++ptr->size;
+	ptr->array_ptr = tmp;
+	ptr->capacity = newCapacity;
+}
+
+//将一个元素压入栈中
+void Push_Stack(Stack* ptr, StackDataType data)
+{
+	assert(ptr);
+	Reserve_Stack(ptr, 1);
+	ptr->array_ptr[ptr->top++] = data;
 }
 
 //将一个元素从栈中弹出
@@ -38,56 +51,58 @@ StackDataType Pop_Stack(Stack* ptr)
 {
 	assert(ptr);
 	assert(!Empty_Stack(ptr));
-	StackDataType ans = ptr->head->data;
-	if (ptr->head == ptr->tail)
-	{
-		free(ptr->head);
-		ptr->head = ptr->tail = NULL;
-	}
-	else
-	{
-		ptr->head = ptr->head->next;
-		free(ptr->head->prev);
-		ptr->head->prev = NULL;
-	}
-	--ptr->size;
-	return ans;
+	return ptr->array_ptr[--ptr->top];
+}
+
+//将一个栈帧压入栈中
+void Push_Frame_Stack(Stack* ptr, StackDataType left, StackDataType right)
+{
+	assert(ptr);
+	Reserve_Stack(ptr, 2);
+	ptr->array_ptr[ptr->top] = left;
+	ptr->array_ptr[ptr->top + 1] = right;
+	ptr->top += 2;
+}
+
+//将一个栈帧从栈中弹出
+StackFrame Pop_Frame_Stack(Stack* ptr)
+{
+	assert(ptr);
+	assert(Size_Stack(ptr) >= 2);
+	ptr->top -= 2;
+	StackFrame frame = { ptr->array_ptr[ptr->top], ptr->array_ptr[ptr->top + 1] };
+	return frame;
 }
 
 //获取栈的栈顶元素数据
 StackDataType Top_Stack(Stack* ptr)
 {
 	assert(ptr);
-	return ptr->head->data;
+	assert(!Empty_Stack(ptr));
+	return ptr->array_ptr[ptr->top - 1];
 }
 
 //判断栈是否为空栈
 bool Empty_Stack(Stack* ptr)
 {
 	assert(ptr);
-	return ptr->size == 0;
+	return ptr->top == 0;
 }
 
 //获取栈中的元素个数
 size_t Size_Stack(Stack* ptr)
 {
 	assert(ptr);
-	return ptr->size;
+	return ptr->top;
 }
 
 //销毁栈
 void Destroy_Stack(Stack* ptr)
 {
 	assert(ptr);
-	while (ptr->head)
+	if (ptr->array_ptr != ptr->buffer)
 	{
-		if (ptr->head->next == NULL)
-		{
-			free(ptr->head);
-			break;
-		}
-		ptr->head = ptr->head->next;
-		free(ptr->head->prev);
+		free(ptr->array_ptr);
 	}
-	ptr->head = ptr->tail = NULL;
+	Init_Stack(ptr);
 }
\ No newline at end of file
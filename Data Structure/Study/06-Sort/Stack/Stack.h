@@ -3,26 +3,38 @@
 //引用头文件
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <stdbool.h>
 
+/*
+ * 栈(数组实现，带内联缓冲区)
+ * 1. 栈结构体内含一个可容纳"STACK_INLINE_SIZE"个元素的内联缓冲区，元素个数不超过该值时不申请堆内存(快速排序的栈深度通常很浅)。
+ * 2. 内联缓冲区用尽后改为在堆上申请连续数组，容量按两倍增长，压栈、弹栈的均摊时间复杂度为：O(1)。
+ * 3. "Push_Frame_Stack"与"Pop_Frame_Stack"一次压入、弹出一对"left/right"(栈帧)，只检查一次容量。
+ * 4. 使用内联缓冲区时数组指针指向栈结构体自身，因此初始化后不能按值复制或移动栈结构体。
+ */
+
+//定义标识符
+#define STACK_INLINE_SIZE 128
+
 //重命名栈数据元素类型
 typedef int StackDataType;
 
-//定义结构体类型(栈节点(双向链表节点))
-typedef struct StackNode
+//定义结构体类型(栈帧(待处理区间))
+typedef struct StackFrame
 {
-	StackDataType data;
-	struct StackNode* prev;
-	struct StackNode* next;
-} StackNode;
+	StackDataType left;
+	StackDataType right;
+} StackFrame;
 
-//定义结构体类型(双端链表实现栈)
+//定义结构体类型(数组实现栈)
 typedef struct Stack
 {
-	size_t size;
-	StackNode* head;
-	StackNode* tail;
+	StackDataType* array_ptr;
+	size_t top;
+	size_t capacity;
+	StackDataType buffer[STACK_INLINE_SIZE];
 } Stack;
 
 //初始化栈
@@ -34,6 +46,12 @@ void Push_Stack(Stack* ptr, StackDataType data);
 //将一个元素从栈中弹出
 StackDataType Pop_Stack(Stack* ptr);
 
+//将一个栈帧压入栈中
+void Push_Frame_Stack(Stack* ptr, StackDataType left, StackDataType right);
+
+//将一个栈帧从栈中弹出
+StackFrame Pop_Frame_Stack(Stack* ptr);
+
 //获取栈的栈顶元素数据
 StackDataType Top_Stack(Stack* ptr);
 
@@ -0,0 +1,258 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "Bench.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+//获取单调时钟的当前时间(单位：毫秒)
+double Now_Bench()
+{
+#if defined(_WIN32)
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart * 1e3 / (double)frequency.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+#endif
+}
+
+//生成下一个64位伪随机数
+unsigned long long Next_Random(BenchRandom* random)
+{
+	unsigned long long z = (random->state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+//生成器：均匀分布的随机数(覆盖"SortDataType"的全部取值范围)
+void Generate_Random(SortDataType* arr, size_t size, BenchRandom* random)
+{
+	for (size_t i = 0; i < size; ++i)
+	{
+		arr[i] = (SortDataType)Next_Random(random);
+	}
+}
+
+//生成器：升序
+void Generate_Sorted(SortDataType* arr, size_t size, BenchRandom* random)
+{
+	(void)random;
+	for (size_t i = 0; i < size; ++i)
+	{
+		arr[i] = (SortDataType)i;
+	}
+}
+
+//生成器：降序
+void Generate_Reversed(SortDataType* arr, size_t size, BenchRandom* random)
+{
+	(void)random;
+	for (size_t i = 0; i < size; ++i)
+	{
+		arr[i] = (SortDataType)(size - i);
+	}
+}
+
+//生成器：锯齿(由"16"段升序序列组成)
+void Generate_Sawtooth(SortDataType* arr, size_t size, BenchRandom* random)
+{
+	(void)random;
+	size_t period = size / 16 == 0 ? 1 : size / 16;
+	for (size_t i = 0; i < size; ++i)
+	{
+		arr[i] = (SortDataType)(i % period);
+	}
+}
+
+//生成器：少量不同值(只有"16"种取值)
+void Generate_Few_Unique(SortDataType* arr, size_t size, BenchRandom* random)
+{
+	for (size_t i = 0; i < size; ++i)
+	{
+		arr[i] = (SortDataType)(Next_Random(random) % 16);
+	}
+}
+
+//生成器：齐夫分布(参数"s = 1"，取值范围为"[1, 65536]")
+void Generate_Zipf(SortDataType* arr, size_t size, BenchRandom* random)
+{
+	enum { ZIPF_RANGE = 65536 };
+	static double cumulative[ZIPF_RANGE];
+	static bool ready = false;
+	if (!ready)
+	{
+		double sum = 0;
+		for (size_t k = 0; k < ZIPF_RANGE; ++k)
+		{
+			sum += 1.0 / (double)(k + 1);
+			cumulative[k] = sum;
+		}
+		for (size_t k = 0; k < ZIPF_RANGE; ++k)
+		{
+			cumulative[k] /= sum;
+		}
+		ready = true;
+	}
+	for (size_t i = 0; i < size; ++i)
+	{
+		double u = (double)(Next_Random(random) >> 11) / 9007199254740992.0;
+		size_t left = 0, right = ZIPF_RANGE - 1;
+		while (left < right)
+		{
+			size_t middle = left + ((right - left) >> 1);
+			cumulative[middle] < u ? (left = middle + 1) : (right = middle);
+		}
+		arr[i] = (SortDataType)(left + 1);
+	}
+}
+
+//判断数组是否为升序
+bool Is_Sorted(const SortDataType* arr, size_t size)
+{
+	for (size_t i = 1; i < size; ++i)
+	{
+		if (arr[i] < arr[i - 1])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//比较器(用于对耗时排序)
+static int Compare_Double(const void* p1, const void* p2)
+{
+	return (*(double*)p1 > *(double*)p2) - (*(double*)p1 < *(double*)p2);
+}
+
+//运行一个基准测试
+BenchResult Run_Bench(const BenchSort* sort, const BenchGenerator* generator, size_t size, size_t warmup, size_t runs, unsigned long long seed)
+{
+	BenchResult result = { sort->name, generator->name, size, runs, 0, 0, 0, 0, true };
+	SortDataType* input = (SortDataType*)malloc(sizeof(SortDataType) * (size == 0 ? 1 : size));
+	SortDataType* arr = (SortDataType*)malloc(sizeof(SortDataType) * (size == 0 ? 1 : size));
+	double* times = (double*)malloc(sizeof(double) * (runs == 0 ? 1 : runs));
+	if (input == NULL || arr == NULL || times == NULL)
+	{
+		perror("Run_Bench");
+		exit(EXIT_FAILURE);
+	}
+	BenchRandom random = { seed };
+	generator->Generate(input, size, &random);
+	for (size_t i = 0; i < warmup + runs; ++i)
+	{
+		memcpy(arr, input, sizeof(SortDataType) * size);
+		double begin = Now_Bench();
+		sort->Sort(arr, size);
+		double elapsed = Now_Bench() - begin;
+		result.correct = result.correct && Is_Sorted(arr, size);
+		if (i >= warmup)
+		{
+			times[i - warmup] = elapsed;
+			result.mean += elapsed / (double)runs;
+		}
+	}
+	if (runs > 0)
+	{
+		qsort(times, runs, sizeof(double), Compare_Double);
+		result.min = times[0];
+		result.median = runs % 2 == 1 ? times[runs / 2] : (times[runs / 2 - 1] + times[runs / 2]) / 2;
+		result.p95 = times[(size_t)ceil(0.95 * (double)runs) - 1];
+	}
+	free(input);
+	free(arr);
+	free(times);
+	return result;
+}
+
+//打印基准测试结果表格
+void Print_Bench(const BenchResult* results, size_t count)
+{
+	printf("%-24s%-14s%-12s%-8s%-12s%-12s%-12s%-12s%s\n", "Sort", "Generator", "Size", "Runs", "Min(ms)", "Median(ms)", "P95(ms)", "Mean(ms)", "Correct");
+	for (size_t i = 0; i < count; ++i)
+	{
+		printf("%-24s%-14s%-12zu%-8zu%-12.3lf%-12.3lf%-12.3lf%-12.3lf%s\n",
+				results[i].sort,
+				results[i].generator,
+				results[i].size,
+				results[i].runs,
+				results[i].min,
+				results[i].median,
+				results[i].p95,
+				results[i].mean,
+				results[i].correct ? "Yes" : "No"
+		);
+	}
+}
+
+//保存基准测试结果为"CSV"文件
+bool Save_Bench_CSV(const char* path, const BenchResult* results, size_t count)
+{
+	FILE* file = fopen(path, "w");
+	if (file == NULL)
+	{
+		perror("Save_Bench_CSV");
+		return false;
+	}
+	fprintf(file, "sort,generator,size,runs,min_ms,median_ms,p95_ms,mean_ms,correct\n");
+	for (size_t i = 0; i < count; ++i)
+	{
+		fprintf(file, "%s,%s,%zu,%zu,%.6lf,%.6lf,%.6lf,%.6lf,%d\n",
+				results[i].sort,
+				results[i].generator,
+				results[i].size,
+				results[i].runs,
+				results[i].min,
+				results[i].median,
+				results[i].p95,
+				results[i].mean,
+				results[i].correct
+		);
+	}
+	return fclose(file) == 0;
+}
+
+//保存基准测试结果为"JSON"文件
+bool Save_Bench_JSON(const char* path, const BenchResult* results, size_t count)
+{
+	FILE* file = fopen(path, "w");
+	if (file == NULL)
+	{
+		perror("Save_Bench_JSON");
+		return false;
+	}
+	fprintf(file, "[\n");
+	for (size_t i = 0; i < count; ++i)
+	{
+		fprintf(file, "\t{ \"sort\": \"%s\", \"generator\": \"%s\", \"size\": %zu, \"runs\": %zu, \"min_ms\": %.6lf, \"median_ms\": %.6lf, \"p95_ms\": %.6lf, \"mean_ms\": %.6lf, \"correct\": %s }%s\n",
+				results[i].sort,
+				results[i].generator,
+				results[i].size,
+				results[i].runs,
+				results[i].min,
+				results[i].median,
+				results[i].p95,
+				results[i].mean,
+				results[i].correct ? "true" : "false",
+				i + 1 < count ? "," : ""
+		);
+	}
+	fprintf(file, "]\n");
+	return fclose(file) == 0;
+}
+
+//库函数"qsort"的包装(以便作为被测排序算法)
+void Qsort_Bench(SortDataType* arr, size_t size)
+{
+	qsort(arr, size, sizeof(SortDataType), Compare_Int);
+}
\ No newline at end of file
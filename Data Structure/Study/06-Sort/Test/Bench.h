@@ -0,0 +1,96 @@
+#pragma once
+
+//引用基准测试所需头文件
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+//引用排序头文件
+#include "../Sort.h"
+
+/*
+ * 排序算法基准测试
+ * 1. 使用单调高精度时钟计时(Windows下为"QueryPerformanceCounter"，其他平台为"clock_gettime(CLOCK_MONOTONIC)")，只统计排序函数本身的耗时。
+ * 2. 每个测试先预热"warmup"次，再重复"runs"次，统计最小值、平均值、中位数与"p95"(单位：毫秒)。
+ * 3. 输入数据由可替换的生成器产生，随机数由64位伪随机数生成器(SplitMix64)产生，不受"RAND_MAX"限制，相同种子产生相同输入。
+ * 4. 每次排序后检查结果是否为升序。
+ * 5. 结果可保存为"CSV"或"JSON"文件，以便比较不同构建之间的性能变化。
+ */
+
+//定义结构体类型(64位伪随机数生成器)
+typedef struct BenchRandom
+{
+	unsigned long long state;
+} BenchRandom;
+
+//定义结构体类型(输入数据生成器)
+typedef struct BenchGenerator
+{
+	const char* name;
+	void (* Generate)(SortDataType* arr, size_t size, BenchRandom* random);
+} BenchGenerator;
+
+//定义结构体类型(被测排序算法)
+typedef struct BenchSort
+{
+	const char* name;
+	void (* Sort)(SortDataType* arr, size_t size);
+} BenchSort;
+
+//定义结构体类型(基准测试结果)
+typedef struct BenchResult
+{
+	const char* sort;
+	const char* generator;
+	size_t size;
+	size_t runs;
+	double min;
+	double mean;
+	double median;
+	double p95;
+	bool correct;
+} BenchResult;
+
+//获取单调时钟的当前时间(单位：毫秒)
+double Now_Bench();
+
+//生成下一个64位伪随机数
+unsigned long long Next_Random(BenchRandom* random);
+
+//生成器：均匀分布的随机数(覆盖"SortDataType"的全部取值范围)
+void Generate_Random(SortDataType* arr, size_t size, BenchRandom* random);
+
+//生成器：升序
+void Generate_Sorted(SortDataType* arr, size_t size, BenchRandom* random);
+
+//生成器：降序
+void Generate_Reversed(SortDataType* arr, size_t size, BenchRandom* random);
+
+//生成器：锯齿(由"16"段升序序列组成)
+void Generate_Sawtooth(SortDataType* arr, size_t size, BenchRandom* random);
+
+//生成器：少量不同值(只有"16"种取值)
+void Generate_Few_Unique(SortDataType* arr, size_t size, BenchRandom* random);
+
+//生成器：齐夫分布(参数"s = 1"，取值范围为"[1, 65536]")
+void Generate_Zipf(SortDataType* arr, size_t size, BenchRandom* random);
+
+//判断数组是否为升序
+bool Is_Sorted(const SortDataType* arr, size_t size);
+
+//运行一个基准测试
+BenchResult Run_Bench(const BenchSort* sort, const BenchGenerator* generator, size_t size, size_t warmup, size_t runs, unsigned long long seed);
+
+//打印基准测试结果表格
+void Print_Bench(const BenchResult* results, size_t count);
+
+//保存基准测试结果为"CSV"文件
+bool Save_Bench_CSV(const char* path, const BenchResult* results, size_t count);
+
+//保存基准测试结果为"JSON"文件
+bool Save_Bench_JSON(const char* path, const BenchResult* results, size_t count);
+
+//库函数"qsort"的包装(以便作为被测排序算法)
+void Qsort_Bench(SortDataType* arr, size_t size);
\ No newline at end of file
@@ -0,0 +1,150 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "Perf.h"
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+//打开一个硬件计数器，失败时返回"-1"
+static int Open_Perf(unsigned int type, unsigned long long config)
+{
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+//打开所有硬件计数器
+static void Open_All_Perf(int* fds)
+{
+	fds[PERF_CYCLES] = Open_Perf(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+	fds[PERF_INSTRUCTIONS] = Open_Perf(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+	fds[PERF_BRANCH_MISSES] = Open_Perf(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+	fds[PERF_L1D_MISSES] = Open_Perf(PERF_TYPE_HW_CACHE,
+			PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+	fds[PERF_LLC_MISSES] = Open_Perf(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+}
+
+//启用或停用所有硬件计数器
+static void Switch_All_Perf(const int* fds, bool enable)
+{
+	for (int i = 0; i < PERF_EVENT_COUNT; ++i)
+	{
+		if (fds[i] != -1)
+		{
+			if (enable)
+			{
+				ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+			}
+			ioctl(fds[i], enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, 0);
+		}
+	}
+}
+
+//读取并关闭所有硬件计数器
+static void Close_All_Perf(const int* fds, unsigned long long* events)
+{
+	for (int i = 0; i < PERF_EVENT_COUNT; ++i)
+	{
+		events[i] = PERF_UNAVAILABLE;
+		if (fds[i] != -1)
+		{
+			unsigned long long value = 0;
+			if (read(fds[i], &value, sizeof(value)) == sizeof(value))
+			{
+				events[i] = value;
+			}
+			close(fds[i]);
+		}
+	}
+}
+#else
+static void Open_All_Perf(int* fds)
+{
+	for (int i = 0; i < PERF_EVENT_COUNT; ++i)
+	{
+		fds[i] = -1;
+	}
+}
+
+static void Switch_All_Perf(const int* fds, bool enable)
+{
+	(void)fds;
+	(void)enable;
+}
+
+static void Close_All_Perf(const int* fds, unsigned long long* events)
+{
+	(void)fds;
+	for (int i = 0; i < PERF_EVENT_COUNT; ++i)
+	{
+		events[i] = PERF_UNAVAILABLE;
+	}
+}
+#endif
+
+//统计排序算法的时间与硬件性能计数
+PerfResult Perf_Sort(const char* name, SortDataType* arr, size_t size, void (* Sort)(SortDataType*, size_t))
+{
+	PerfResult result;
+	int fds[PERF_EVENT_COUNT];
+	result.name = name;
+	result.compares = result.swaps = PERF_UNAVAILABLE;
+	Open_All_Perf(fds);
+#ifdef SORT_COUNT
+	Compare_Count = Swap_Count = 0;
+#endif
+	Switch_All_Perf(fds, true);
+	result.seconds = Clock_Sort(arr, size, Sort);
+	Switch_All_Perf(fds, false);
+#ifdef SORT_COUNT
+	result.compares = Compare_Count;
+	result.swaps = Swap_Count;
+#endif
+	Close_All_Perf(fds, result.events);
+	return result;
+}
+
+//打印一个计数值(不可用时打印"-")
+static void Print_Count(unsigned long long value)
+{
+	value == PERF_UNAVAILABLE ? printf("%-16s", "-") : printf("%-16llu", value);
+}
+
+//打印性能计数结果表格
+void Print_Perf(const PerfResult* results, size_t count)
+{
+	printf("%-24s%-12s%-16s%-16s%-8s%-16s%-16s%-16s%-16s%-16s\n",
+			"Sort", "Time(s)", "Cycles", "Instructions", "IPC", "Branch Misses", "L1D Misses", "LLC Misses", "Compares", "Swaps");
+	for (size_t i = 0; i < count; ++i)
+	{
+		const unsigned long long* events = results[i].events;
+		printf("%-24s%-12.6lf", results[i].name, results[i].seconds);
+		Print_Count(events[PERF_CYCLES]);
+		Print_Count(events[PERF_INSTRUCTIONS]);
+		if (events[PERF_CYCLES] == PERF_UNAVAILABLE || events[PERF_INSTRUCTIONS] == PERF_UNAVAILABLE || events[PERF_CYCLES] == 0)
+		{
+			printf("%-8s", "-");
+		}
+		else
+		{
+			printf("%-8.2lf", (double)events[PERF_INSTRUCTIONS] / (double)events[PERF_CYCLES]);
+		}
+		Print_Count(events[PERF_BRANCH_MISSES]);
+		Print_Count(events[PERF_L1D_MISSES]);
+		Print_Count(events[PERF_LLC_MISSES]);
+		Print_Count(results[i].compares);
+		Print_Count(results[i].swaps);
+		printf("\n");
+	}
+}
\ No newline at end of file
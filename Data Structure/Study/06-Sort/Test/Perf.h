@@ -0,0 +1,47 @@
+#pragma once
+
+//引用性能计数所需头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+//引用测试头文件
+#include "Test.h"
+
+/*
+ * 硬件性能计数
+ * 1. 在"Clock_Sort"外层通过"perf_event_open"系统调用统计周期数、指令数、分支预测失败次数、L1数据缓存读未命中次数与末级缓存未命中次数(仅统计用户态)。
+ * 2. 仅"Linux"平台可用，其他平台或权限不足(见"/proc/sys/kernel/perf_event_paranoid")时对应计数器不可用，表格中显示为"-"。
+ * 3. 编译时定义"SORT_COUNT"标识符后同时统计比较次数与交换次数，否则表格中显示为"-"。
+ */
+
+//定义标识符
+#define PERF_UNAVAILABLE ((unsigned long long)-1)
+
+//定义枚举类型(硬件计数器)
+enum PerfEvent
+{
+	PERF_CYCLES,
+	PERF_INSTRUCTIONS,
+	PERF_BRANCH_MISSES,
+	PERF_L1D_MISSES,
+	PERF_LLC_MISSES,
+	PERF_EVENT_COUNT
+};
+
+//定义结构体类型(性能计数结果)
+typedef struct PerfResult
+{
+	const char* name;
+	double seconds;
+	unsigned long long events[PERF_EVENT_COUNT];
+	unsigned long long compares;
+	unsigned long long swaps;
+} PerfResult;
+
+//统计排序算法的时间与硬件性能计数
+PerfResult Perf_Sort(const char* name, SortDataType* arr, size_t size, void (* Sort)(SortDataType*, size_t));
+
+//打印性能计数结果表格
+void Print_Perf(const PerfResult* results, size_t count);
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Sort.h"
 #include "Test/Test.h"
+#include "Test/Bench.h"
+#include "Test/Perf.h"
 
 void Test_Sort_01()
 {
@@ -15,9 +17,11 @@ void Test_Sort_01()
 		SortDataType* arr = Generate_Integer_Random_Array(size);
 		SortDataType* arr1 = Copy_Array(arr, size);
 		SortDataType* arr2 = Copy_Array(arr, size);
+		SortDataType* arr3 = Copy_Array(arr, size);
 		Quick_Sort_UnRecursive(arr1, size);
 		Contrast(arr2, size, Compare_Int);
-		if (!Is_Equal(arr1, arr2, size))
+		Intro_Sort(arr3, size);
+		if (!Is_Equal(arr1, arr2, size) || !Is_Equal(arr3, arr2, size))
 		{
 			succeed = false;
 			for (int j = 0; j < size; j++)
@@ -30,6 +34,7 @@ void Test_Sort_01()
 		free(arr);
 		free(arr1);
 		free(arr2);
+		free(arr3);
 	}
 	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
 
@@ -53,7 +58,9 @@ void Test_Sort_02()
 	SortDataType* arr8 = Copy_Array(arr1, size);
 	SortDataType* arr9 = Copy_Array(arr1, size);
 	SortDataType* arr10 = Copy_Array(arr1, size);
+	SortDataType* arr11 = Copy_Array(arr1, size);
 
+	printf("Sort_Network：%s\n", Name_Network());
 	clock_t begin = clock();
 	printf("Insertion_Sort：%lfs\n", Clock_Sort(arr1, size, Insertion_Sort));
 	printf("Selection_Sort：%lfs\n", Clock_Sort(arr2, size, Selection_Sort));
@@ -64,6 +71,7 @@ void Test_Sort_02()
 	printf("Merge_Sort_UnRecursive：%lfs\n", Clock_Sort(arr7, size, Merge_Sort_UnRecursive));
 	printf("Quick_Sort_Recursive：%lfs\n", Clock_Sort(arr8, size, Quick_Sort_Recursive));
 	printf("Quick_Sort_UnRecursive：%lfs\n", Clock_Sort(arr9, size, Quick_Sort_UnRecursive));
+	printf("Intro_Sort：%lfs\n", Clock_Sort(arr11, size, Intro_Sort));
 	printf("qsort：%lfs\n", Contrast(arr10, size, Compare_Int));
 	printf("Total Time：%lfs\n", (double)(clock() - begin) / CLOCKS_PER_SEC);
 
@@ -77,6 +85,7 @@ void Test_Sort_02()
 	free(arr8);
 	free(arr9);
 	free(arr10);
+	free(arr11);
 
 	printf("*****************************EXIT*****************************\n\n");
 }
@@ -142,6 +151,184 @@ void Test_Sort_04()
 	printf("*****************************EXIT*****************************\n\n");
 }
 
+void Test_Sort_05()
+{
+	printf("******************************05******************************\n");
+
+	BenchSort sorts[] =
+	{
+		{ "Shell_Sort", Shell_Sort },
+		{ "Heap_Sort", Heap_Sort },
+		{ "Merge_Sort_Recursive", Merge_Sort_Recursive },
+		{ "Merge_Sort_UnRecursive", Merge_Sort_UnRecursive },
+		{ "Quick_Sort_Recursive", Quick_Sort_Recursive },
+		{ "Quick_Sort_UnRecursive", Quick_Sort_UnRecursive },
+		{ "Intro_Sort", Intro_Sort },
+		{ "qsort", Qsort_Bench }
+	};
+	BenchGenerator generators[] =
+	{
+		{ "Random", Generate_Random },
+		{ "Sorted", Generate_Sorted },
+		{ "Reversed", Generate_Reversed },
+		{ "Sawtooth", Generate_Sawtooth },
+		{ "Few_Unique", Generate_Few_Unique },
+		{ "Zipf", Generate_Zipf }
+	};
+	size_t sortCount = sizeof(sorts) / sizeof(sorts[0]);
+	size_t generatorCount = sizeof(generators) / sizeof(generators[0]);
+	size_t size = 100000;
+	size_t warmup = 1, runs = 11;
+	unsigned long long seed = 20231019;
+
+	BenchResult* results = (BenchResult*)malloc(sizeof(BenchResult) * sortCount * generatorCount);
+	size_t count = 0;
+	for (size_t i = 0; i < generatorCount; ++i)
+	{
+		for (size_t j = 0; j < sortCount; ++j)
+		{
+			results[count++] = Run_Bench(&sorts[j], &generators[i], size, warmup, runs, seed);
+		}
+	}
+	Print_Bench(results, count);
+	Save_Bench_CSV("Bench.csv", results, count);
+	Save_Bench_JSON("Bench.json", results, count);
+	free(results);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Sort_06()
+{
+	printf("******************************06******************************\n");
+
+	srand((unsigned int)time(NULL));
+
+	size_t size = 1000000;
+	struct
+	{
+		const char* name;
+		void (* Sort)(SortDataType*, size_t);
+	} sorts[] =
+	{
+		{ "Shell_Sort", Shell_Sort },
+		{ "Heap_Sort", Heap_Sort },
+		{ "Merge_Sort_Recursive", Merge_Sort_Recursive },
+		{ "Merge_Sort_UnRecursive", Merge_Sort_UnRecursive },
+		{ "Quick_Sort_Recursive", Quick_Sort_Recursive },
+		{ "Quick_Sort_UnRecursive", Quick_Sort_UnRecursive },
+		{ "Intro_Sort", Intro_Sort }
+	};
+	size_t count = sizeof(sorts) / sizeof(sorts[0]);
+	PerfResult results[sizeof(sorts) / sizeof(sorts[0])];
+	SortDataType* arr = Generate_Integer_Random_Array(size);
+	for (size_t i = 0; i < count; ++i)
+	{
+		SortDataType* copy = Copy_Array(arr, size);
+		results[i] = Perf_Sort(sorts[i].name, copy, size, sorts[i].Sort);
+		free(copy);
+	}
+	Print_Perf(results, count);
+	free(arr);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Sort_07()
+{
+	printf("******************************07******************************\n");
+
+	srand((unsigned int)time(NULL));
+
+	//正确性
+	size_t testTime = 10000;
+	size_t maxSize = 1000;
+	bool succeed = true;
+	for (size_t i = 0; i < testTime && succeed; i++)
+	{
+		size_t size = rand() % maxSize + 1;
+		size_t k = rand() % size;
+		SortDataType* arr = Generate_Natural_Random_Array(size, 100);
+		SortDataType* arr1 = Copy_Array(arr, size);
+		SortDataType* arr2 = Copy_Array(arr, size);
+		SortDataType* result = (SortDataType*)malloc(sizeof(SortDataType) * (k + 1));
+		Contrast(arr, size, Compare_Int);
+		succeed = Quick_Select(arr1, size, k) == arr[k];
+		Partial_Sort(arr2, size, k + 1);
+		succeed = succeed && Is_Equal(arr, arr2, k + 1);
+		TopK topK;
+		Init_TopK(&topK, k + 1);
+		Push_TopK(&topK, arr1, size / 2);
+		Push_TopK(&topK, arr1 + size / 2, size - size / 2);
+		Result_TopK(&topK, result);
+		for (size_t j = 0; j <= k && succeed; ++j)
+		{
+			succeed = result[j] == arr[size - 1 - j];
+		}
+		Destroy_TopK(&topK);
+		free(arr);
+		free(arr1);
+		free(arr2);
+		free(result);
+	}
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
+
+	//性能(从"size"个元素中选出最大的"k"个)
+	size_t size = 10000000;
+	size_t k = 1000;
+	size_t chunk = 65536;
+	SortDataType* arr1 = (SortDataType*)malloc(sizeof(SortDataType) * size);
+	BenchRandom random = { (unsigned long long)time(NULL) };
+	Generate_Random(arr1, size, &random);
+	SortDataType* arr2 = Copy_Array(arr1, size);
+	SortDataType* arr3 = Copy_Array(arr1, size);
+	SortDataType* arr4 = Copy_Array(arr1, size);
+	SortDataType* result = (SortDataType*)malloc(sizeof(SortDataType) * k);
+
+	double begin = Now_Bench();
+	Quick_Sort_Recursive(arr1, size);
+	printf("Quick_Sort_Recursive：%lfms\n", Now_Bench() - begin);
+
+	begin = Now_Bench();
+	Nth_Element(arr2, size, size - k);
+	printf("Nth_Element：%lfms\n", Now_Bench() - begin);
+
+	//"Partial_Sort"选出最小的"k"个元素，此处对取反后的数据测试以得到最大的"k"个元素。
+	for (size_t i = 0; i < size; ++i)
+	{
+		arr3[i] = ~arr3[i];
+	}
+	begin = Now_Bench();
+	Partial_Sort(arr3, size, k);
+	printf("Partial_Sort：%lfms\n", Now_Bench() - begin);
+
+	begin = Now_Bench();
+	TopK topK;
+	Init_TopK(&topK, k);
+	for (size_t i = 0; i < size; i += chunk)
+	{
+		Push_TopK(&topK, arr4 + i, size - i < chunk ? size - i : chunk);
+	}
+	Result_TopK(&topK, result);
+	Destroy_TopK(&topK);
+	printf("Top_K：%lfms\n", Now_Bench() - begin);
+
+	succeed = arr2[size - k] == arr1[size - k];
+	for (size_t i = 0; i < k && succeed; ++i)
+	{
+		succeed = result[i] == arr1[size - 1 - i] && ~arr3[i] == arr1[size - 1 - i];
+	}
+	succeed ? printf("Good Luck!\n") : printf("Oops!\n");
+
+	free(arr1);
+	free(arr2);
+	free(arr3);
+	free(arr4);
+	free(result);
+
+	printf("*****************************EXIT*****************************\n\n");
+}
+
 int main()
 {
 	//测试基于比较的排序算法
@@ -152,5 +339,14 @@ int main()
 	Test_Sort_03();//测试排序算法的正确性。
 	Test_Sort_04();//测试排序算法的性能。
 
+	//基准测试(多种输入分布，重复测量，结果保存为"Bench.csv"与"Bench.json")
+	Test_Sort_05();
+
+	//硬件性能计数(编译时定义"SORT_COUNT"后同时统计比较次数与交换次数)
+	Test_Sort_06();
+
+	//选择算法(快速选择、部分排序、流式前"k"大)
+	Test_Sort_07();
+
 	return 0;
 }
\ No newline at end of file
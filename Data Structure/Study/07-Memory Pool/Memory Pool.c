@@ -0,0 +1,248 @@
+#include "Memory Pool.h"
+
+#include <threads.h>
+
+//定义结构体类型(互斥锁)
+struct PoolLock
+{
+	mtx_t mutex;
+};
+
+//加锁(仅线程安全的内存池)
+static void Lock_Pool(MemoryPool* ptr)
+{
+	if (ptr->threadSafe)
+	{
+		mtx_lock(&ptr->lock->mutex);
+	}
+}
+
+//解锁(仅线程安全的内存池)
+static void Unlock_Pool(MemoryPool* ptr)
+{
+	if (ptr->threadSafe)
+	{
+		mtx_unlock(&ptr->lock->mutex);
+	}
+}
+
+//申请一块新的大块内存
+static void Grow_Pool(MemoryPool* ptr)
+{
+	PoolSlab* slab = (PoolSlab*)malloc(sizeof(PoolSlab) + ptr->blockSize * ptr->slabCount);
+	if (slab == NULL)
+	{
+		perror("Grow_Pool");
+		exit(EXIT_FAILURE);
+	}
+	slab->next = ptr->slabs;
+	ptr->slabs = slab;
+	ptr->cursor = (char*)(slab + 1);
+	ptr->limit = ptr->cursor + ptr->blockSize * ptr->slabCount;
+	++ptr->slabNumber;
+}
+
+//从内存池中取出一个内存块(调用者已加锁)
+static void* Take_Pool(MemoryPool* ptr)
+{
+	if (ptr->freeList != NULL)
+	{
+		PoolBlock* block = ptr->freeList;
+		ptr->freeList = block->next;
+		return block;
+	}
+	if (ptr->cursor == ptr->limit)
+	{
+		Grow_Pool(ptr);
+	}
+	void* block = ptr->cursor;
+	ptr->cursor += ptr->blockSize;
+	return block;
+}
+
+//初始化内存池("slabCount"为每块大块内存所含的内存块个数，为"0"时使用"POOL_DEFAULT_SLAB")
+void Init_Pool(MemoryPool* ptr, size_t blockSize, size_t slabCount, bool threadSafe)
+{
+	assert(ptr);
+	assert(blockSize > 0);
+	//内存块至少能容纳一个空闲链表指针，并按指针大小对齐
+	blockSize = blockSize < sizeof(PoolBlock) ? sizeof(PoolBlock) : blockSize;
+	ptr->blockSize = (blockSize + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+	ptr->slabCount = slabCount == 0 ? POOL_DEFAULT_SLAB : slabCount;
+	ptr->freeList = NULL;
+	ptr->slabs = NULL;
+	ptr->cursor = ptr->limit = NULL;
+	ptr->used = 0;
+	ptr->slabNumber = 0;
+	ptr->threadSafe = threadSafe;
+	ptr->lock = NULL;
+	if (threadSafe)
+	{
+		ptr->lock = (struct PoolLock*)malloc(sizeof(struct PoolLock));
+		if (ptr->lock == NULL || mtx_init(&ptr->lock->mutex, mtx_plain) != thrd_success)
+		{
+			perror("Init_Pool");
+			exit(EXIT_FAILURE);
+		}
+	}
+}
+
+//从内存池中申请一个内存块
+void* Alloc_Pool(MemoryPool* ptr)
+{
+	assert(ptr);
+	Lock_Pool(ptr);
+	void* block = Take_Pool(ptr);
+	++ptr->used;
+	Unlock_Pool(ptr);
+	return block;
+}
+
+//将一个内存块归还给内存池
+void Free_Pool(MemoryPool* ptr, void* block)
+{
+	assert(ptr);
+	if (block == NULL)
+	{
+		return;
+	}
+	Lock_Pool(ptr);
+	((PoolBlock*)block)->next = ptr->freeList;
+	ptr->freeList = (PoolBlock*)block;
+	--ptr->used;
+	Unlock_Pool(ptr);
+}
+
+//回收内存池中的全部内存块(保留已申请的大块内存)
+void Reset_Pool(MemoryPool* ptr)
+{
+	assert(ptr);
+	Lock_Pool(ptr);
+	ptr->freeList = NULL;
+	ptr->cursor = ptr->limit = NULL;
+	//将每块大块内存中的内存块重新挂入空闲链表
+	for (PoolSlab* slab = ptr->slabs; slab != NULL; slab = slab->next)
+	{
+		char* begin = (char*)(slab + 1);
+		for (size_t i = ptr->slabCount; i > 0; --i)
+		{
+			PoolBlock* block = (PoolBlock*)(begin + ptr->blockSize * (i - 1));
+			block->next = ptr->freeList;
+			ptr->freeList = block;
+		}
+	}
+	ptr->used = 0;
+	Unlock_Pool(ptr);
+}
+
+//获取内存池中已分配出去的内存块个数(包括线程缓存中的内存块)
+size_t Used_Pool(MemoryPool* ptr)
+{
+	assert(ptr);
+	Lock_Pool(ptr);
+	size_t used = ptr->used;
+	Unlock_Pool(ptr);
+	return used;
+}
+
+//销毁内存池(释放全部大块内存)
+void Destroy_Pool(MemoryPool* ptr)
+{
+	assert(ptr);
+	PoolSlab* slab = ptr->slabs;
+	while (slab != NULL)
+	{
+		PoolSlab* next = slab->next;
+		free(slab);
+		slab = next;
+	}
+	if (ptr->threadSafe)
+	{
+		mtx_destroy(&ptr->lock->mutex);
+		free(ptr->lock);
+		ptr->lock = NULL;
+	}
+	ptr->freeList = NULL;
+	ptr->slabs = NULL;
+	ptr->cursor = ptr->limit = NULL;
+	ptr->used = 0;
+	ptr->slabNumber = 0;
+}
+
+//初始化线程缓存
+void Init_PoolCache(PoolCache* ptr, MemoryPool* pool)
+{
+	assert(ptr);
+	assert(pool);
+	ptr->pool = pool;
+	ptr->freeList = NULL;
+	ptr->size = 0;
+}
+
+//从线程缓存中申请一个内存块
+void* Alloc_PoolCache(PoolCache* ptr)
+{
+	assert(ptr);
+	//线程缓存为空时，加锁一次从内存池中取出一批内存块
+	if (ptr->freeList == NULL)
+	{
+		MemoryPool* pool = ptr->pool;
+		Lock_Pool(pool);
+		for (size_t i = 0; i < POOL_CACHE_BATCH; ++i)
+		{
+			PoolBlock* block = (PoolBlock*)Take_Pool(pool);
+			block->next = ptr->freeList;
+			ptr->freeList = block;
+		}
+		pool->used += POOL_CACHE_BATCH;
+		Unlock_Pool(pool);
+		ptr->size = POOL_CACHE_BATCH;
+	}
+	PoolBlock* block = ptr->freeList;
+	ptr->freeList = block->next;
+	--ptr->size;
+	return block;
+}
+
+//将一批内存块归还给内存池
+static void Flush_PoolCache(PoolCache* ptr, size_t count)
+{
+	MemoryPool* pool = ptr->pool;
+	Lock_Pool(pool);
+	for (size_t i = 0; i < count; ++i)
+	{
+		PoolBlock* block = ptr->freeList;
+		ptr->freeList = block->next;
+		block->next = pool->freeList;
+		pool->freeList = block;
+	}
+	pool->used -= count;
+	Unlock_Pool(pool);
+	ptr->size -= count;
+}
+
+//将一个内存块归还给线程缓存
+void Free_PoolCache(PoolCache* ptr, void* block)
+{
+	assert(ptr);
+	if (block == NULL)
+	{
+		return;
+	}
+	((PoolBlock*)block)->next = ptr->freeList;
+	ptr->freeList = (PoolBlock*)block;
+	++ptr->size;
+	//线程缓存已满时，加锁一次归还一批内存块
+	if (ptr->size >= 2 * POOL_CACHE_BATCH)
+	{
+		Flush_PoolCache(ptr, POOL_CACHE_BATCH);
+	}
+}
+
+//销毁线程缓存(将缓存的内存块全部归还给内存池)
+void Destroy_PoolCache(PoolCache* ptr)
+{
+	assert(ptr);
+	Flush_PoolCache(ptr, ptr->size);
+	ptr->pool = NULL;
+}
\ No newline at end of file
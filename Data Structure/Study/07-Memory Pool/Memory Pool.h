@@ -0,0 +1,89 @@
+#pragma once
+
+//引用头文件
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <assert.h>
+#include <stdbool.h>
+
+/*
+ * 定长内存池(Fixed-Size Block Pool)
+ * 1. 内存池一次向"malloc"申请一块可容纳"slabCount"个内存块的大块内存(Slab)，再从中逐个切分出大小为"blockSize"的内存块。
+ * 2. 释放的内存块不归还给系统，而是以单链表的形式挂入空闲链表(Free List)，下次申请时优先从空闲链表中取出，申请与释放的时间复杂度均为：O(1)。
+ * 3. 所有大块内存只在销毁内存池时统一释放，因此使用内存池的数据结构在销毁时可以不逐个释放节点。
+ * 4. 初始化时"threadSafe"为"true"的内存池以互斥锁保护，可被多个线程共享；每个线程可再使用一个线程缓存(PoolCache)，
+ *    线程缓存在本地保存少量空闲内存块，只在本地为空或已满时才加锁，与共享内存池成批交换"POOL_CACHE_BATCH"个内存块。
+ * 5. 互斥锁只在"Memory Pool.c"中使用，头文件中只保存指向它的指针，使用内存池的数据结构无需引用"threads.h"。
+ * 6. 带首尾指针的单链表、双向链表与双端队列均可在初始化时选择使用内存池(内存池指针保存在各自的表头中)，不使用时仍为"malloc/free"。
+ */
+
+//定义标识符
+#define POOL_DEFAULT_SLAB 1024
+#define POOL_CACHE_BATCH 32
+
+//定义结构体类型(空闲内存块)
+typedef struct PoolBlock
+{
+	struct PoolBlock* next;
+} PoolBlock;
+
+//定义结构体类型(大块内存头部)
+typedef union PoolSlab
+{
+	union PoolSlab* next;
+	max_align_t align;
+} PoolSlab;
+
+//定义结构体类型(定长内存池)
+typedef struct MemoryPool
+{
+	size_t blockSize;
+	size_t slabCount;
+	PoolBlock* freeList;
+	PoolSlab* slabs;
+	char* cursor;
+	char* limit;
+	size_t used;
+	size_t slabNumber;
+	bool threadSafe;
+	struct PoolLock* lock; //互斥锁(仅线程安全的内存池)
+} MemoryPool;
+
+//定义结构体类型(线程缓存)
+typedef struct PoolCache
+{
+	MemoryPool* pool;
+	PoolBlock* freeList;
+	size_t size;
+} PoolCache;
+
+//初始化内存池("slabCount"为每块大块内存所含的内存块个数，为"0"时使用"POOL_DEFAULT_SLAB")
+void Init_Pool(MemoryPool* ptr, size_t blockSize, size_t slabCount, bool threadSafe);
+
+//从内存池中申请一个内存块
+void* Alloc_Pool(MemoryPool* ptr);
+
+//将一个内存块归还给内存池
+void Free_Pool(MemoryPool* ptr, void* block);
+
+//回收内存池中的全部内存块(保留已申请的大块内存)
+void Reset_Pool(MemoryPool* ptr);
+
+//获取内存池中已分配出去的内存块个数(包括线程缓存中的内存块)
+size_t Used_Pool(MemoryPool* ptr);
+
+//销毁内存池(释放全部大块内存)
+void Destroy_Pool(MemoryPool* ptr);
+
+//初始化线程缓存
+void Init_PoolCache(PoolCache* ptr, MemoryPool* pool);
+
+//从线程缓存中申请一个内存块
+void* Alloc_PoolCache(PoolCache* ptr);
+
+//将一个内存块归还给线程缓存
+void Free_PoolCache(PoolCache* ptr, void* block);
+
+//销毁线程缓存(将缓存的内存块全部归还给内存池)
+void Destroy_PoolCache(PoolCache* ptr);
\ No newline at end of file
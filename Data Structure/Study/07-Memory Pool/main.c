@@ -0,0 +1,222 @@
+#include "Memory Pool.h"
+
+#include <time.h>
+#include <threads.h>
+
+//定义标识符
+#define CHURN_SLOTS 1000000
+#define CHURN_OPERATIONS 20000000
+#define CHURN_THREADS 4
+#define CHURN_BLOCK 24
+
+//定义枚举类型(分配方式)
+typedef enum ChurnMode
+{
+	CHURN_MALLOC,
+	CHURN_POOL,
+	CHURN_CACHE
+} ChurnMode;
+
+//定义结构体类型(反复申请、释放测试的参数)
+typedef struct Churn
+{
+	ChurnMode mode;
+	MemoryPool* pool;
+	size_t slots;
+	size_t operations;
+	unsigned long long seed;
+} Churn;
+
+//获取当前时间(单位：毫秒)
+static double Now()
+{
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+//生成下一个伪随机数(xorshift64)
+static unsigned long long Next(unsigned long long* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+//随机选择一个位置：为空时申请内存块，否则释放内存块
+static int Run_Churn(void* arg)
+{
+	Churn* churn = (Churn*)arg;
+	void** slots = (void**)calloc(churn->slots, sizeof(void*));
+	if (slots == NULL)
+	{
+		perror("Run_Churn");
+		exit(EXIT_FAILURE);
+	}
+	PoolCache cache;
+	if (churn->mode == CHURN_CACHE)
+	{
+		Init_PoolCache(&cache, churn->pool);
+	}
+	unsigned long long state = churn->seed;
+	for (size_t i = 0; i < churn->operations; ++i)
+	{
+		size_t index = (size_t)(Next(&state) % churn->slots);
+		if (slots[index] == NULL)
+		{
+			void* block = NULL;
+			switch (churn->mode)
+			{
+			case CHURN_MALLOC:
+				block = malloc(CHURN_BLOCK);
+				break;
+			case CHURN_POOL:
+				block = Alloc_Pool(churn->pool);
+				break;
+			case CHURN_CACHE:
+				block = Alloc_PoolCache(&cache);
+				break;
+			}
+			*(size_t*)block = index;
+			slots[index] = block;
+		}
+		else
+		{
+			switch (churn->mode)
+			{
+			case CHURN_MALLOC:
+				free(slots[index]);
+				break;
+			case CHURN_POOL:
+				Free_Pool(churn->pool, slots[index]);
+				break;
+			case CHURN_CACHE:
+				Free_PoolCache(&cache, slots[index]);
+				break;
+			}
+			slots[index] = NULL;
+		}
+	}
+	for (size_t i = 0; i < churn->slots; ++i)
+	{
+		if (slots[i] != NULL)
+		{
+			switch (churn->mode)
+			{
+			case CHURN_MALLOC:
+				free(slots[i]);
+				break;
+			case CHURN_POOL:
+				Free_Pool(churn->pool, slots[i]);
+				break;
+			case CHURN_CACHE:
+				Free_PoolCache(&cache, slots[i]);
+				break;
+			}
+		}
+	}
+	if (churn->mode == CHURN_CACHE)
+	{
+		Destroy_PoolCache(&cache);
+	}
+	free(slots);
+	return 0;
+}
+
+//使用"threads"个线程运行反复申请、释放测试，返回耗时(单位：毫秒)
+static double Bench_Churn(ChurnMode mode, MemoryPool* pool, size_t threads)
+{
+	Churn churn[CHURN_THREADS];
+	thrd_t thread[CHURN_THREADS];
+	double begin = Now();
+	for (size_t i = 0; i < threads; ++i)
+	{
+		churn[i] = (Churn){ mode, pool, CHURN_SLOTS / threads, CHURN_OPERATIONS / threads, 0x9E3779B97F4A7C15ULL * (i + 1) };
+		if (thrd_create(&thread[i], Run_Churn, &churn[i]) != thrd_success)
+		{
+			perror("Bench_Churn");
+			exit(EXIT_FAILURE);
+		}
+	}
+	for (size_t i = 0; i < threads; ++i)
+	{
+		thrd_join(thread[i], NULL);
+	}
+	return Now() - begin;
+}
+
+void Test_Pool_01()
+{
+	printf("******************************01******************************\n");
+	MemoryPool pool;
+	Init_Pool(&pool, 20, 16, false);
+	enum { COUNT = 100 };
+	void* blocks[COUNT];
+	bool good = pool.blockSize % sizeof(void*) == 0 && pool.blockSize >= 20;
+	for (int i = 0; i < COUNT; ++i)
+	{
+		blocks[i] = Alloc_Pool(&pool);
+		*(int*)blocks[i] = i;
+		good = good && (size_t)blocks[i] % sizeof(void*) == 0;
+	}
+	for (int i = 0; i < COUNT; ++i)
+	{
+		good = good && *(int*)blocks[i] == i;
+	}
+	printf("Block Size = %zu, Slabs = %zu, Used = %zu\n", pool.blockSize, pool.slabNumber, Used_Pool(&pool));
+
+	//释放后再次申请，应复用空闲链表中的内存块而不申请新的大块内存
+	size_t slabs = pool.slabNumber;
+	for (int i = 0; i < COUNT; i += 2)
+	{
+		Free_Pool(&pool, blocks[i]);
+	}
+	for (int i = 0; i < COUNT; i += 2)
+	{
+		blocks[i] = Alloc_Pool(&pool);
+	}
+	good = good && pool.slabNumber == slabs && Used_Pool(&pool) == COUNT;
+	Reset_Pool(&pool);
+	good = good && Used_Pool(&pool) == 0;
+	for (int i = 0; i < COUNT; ++i)
+	{
+		blocks[i] = Alloc_Pool(&pool);
+	}
+	good = good && pool.slabNumber == slabs;
+	printf("Block Size = %zu, Slabs = %zu, Used = %zu\n", pool.blockSize, pool.slabNumber, Used_Pool(&pool));
+	printf(good ? "Good Luck!\n" : "Oops!\n");
+
+	Destroy_Pool(&pool);
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+void Test_Pool_02()
+{
+	printf("******************************02******************************\n");
+	MemoryPool pool;
+	printf("%-10s%-28s%-12s%s\n", "Threads", "Allocator", "Time(ms)", "Used");
+	for (size_t threads = 1; threads <= CHURN_THREADS; threads *= 2)
+	{
+		printf("%-10zu%-28s%-12.1lf%s\n", threads, "malloc/free", Bench_Churn(CHURN_MALLOC, NULL, threads), "-");
+
+		//单线程时不需要加锁
+		Init_Pool(&pool, CHURN_BLOCK, 0, threads > 1);
+		double time = Bench_Churn(CHURN_POOL, &pool, threads);
+		printf("%-10zu%-28s%-12.1lf%zu\n", threads, threads > 1 ? "Pool(Mutex)" : "Pool", time, Used_Pool(&pool));
+		Destroy_Pool(&pool);
+
+		Init_Pool(&pool, CHURN_BLOCK, 0, true);
+		time = Bench_Churn(CHURN_CACHE, &pool, threads);
+		printf("%-10zu%-28s%-12.1lf%zu\n", threads, "Pool(Mutex + PoolCache)", time, Used_Pool(&pool));
+		Destroy_Pool(&pool);
+	}
+	printf("*****************************EXIT*****************************\n\n");
+}
+
+int main()
+{
+	Test_Pool_01();
+	Test_Pool_02();
+	return 0;
+}
\ No newline at end of file